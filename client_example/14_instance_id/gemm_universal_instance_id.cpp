@@ -0,0 +1,181 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm_v2.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/tensor_operation_instance/gpu/gemm_universal.hpp"
+
+using F16 = ck::half_t;
+
+using Row = ck::tensor_layout::gemm::RowMajor;
+using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+using ADataType = F16;
+using BDataType = F16;
+using CDataType = F16;
+
+using ALayout = Row;
+using BLayout = Col;
+using CLayout = Row;
+
+struct SimpleDeviceMem
+{
+    SimpleDeviceMem() = delete;
+
+    SimpleDeviceMem(std::size_t mem_size) : p_mem_{}
+    {
+        (void)hipMalloc(static_cast<void**>(&p_mem_), mem_size);
+    }
+
+    void* GetDeviceBuffer() { return p_mem_; }
+
+    ~SimpleDeviceMem() { (void)hipFree(p_mem_); }
+
+    void* p_mem_;
+};
+
+// In the actual application, the instance id is usually from the perf db. Unlike an index into
+// GetInstances() it stays valid when instances are added to or removed from the library.
+static std::string instance_id;
+
+int main(int argc, char* argv[])
+{
+    // GEMM shape
+    ck::index_t M = 3840;
+    ck::index_t N = 4096;
+    ck::index_t K = 4096;
+
+    ck::index_t StrideA = 4096;
+    ck::index_t StrideB = 4096;
+    ck::index_t StrideC = 4096;
+
+    if(argc == 1)
+    {
+        // use default case
+    }
+    else if(argc == 7)
+    {
+        M = std::stoi(argv[1]);
+        N = std::stoi(argv[2]);
+        K = std::stoi(argv[3]);
+
+        StrideA = std::stoi(argv[4]);
+        StrideB = std::stoi(argv[5]);
+        StrideC = std::stoi(argv[6]);
+    }
+    else
+    {
+        printf("arg1 to 6: M, N, K, StrideA, StrideB, StrideC\n");
+        exit(0);
+    }
+
+    SimpleDeviceMem a(sizeof(ADataType) * (static_cast<std::size_t>(M - 1) * StrideA + K));
+    SimpleDeviceMem b(sizeof(BDataType) * (static_cast<std::size_t>(N - 1) * StrideB + K));
+    SimpleDeviceMem c(sizeof(CDataType) * (static_cast<std::size_t>(M - 1) * StrideC + N));
+
+    using DeviceOp = ck::tensor_operation::device::DeviceGemmV2<ALayout,
+                                                                BLayout,
+                                                                CLayout,
+                                                                ADataType,
+                                                                BDataType,
+                                                                CDataType,
+                                                                PassThrough,
+                                                                PassThrough,
+                                                                PassThrough>;
+
+    using Factory =
+        ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<DeviceOp>;
+
+    const auto op_ptrs = Factory::GetInstances();
+
+    std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
+
+    float best_ave_time = std::numeric_limits<float>::max();
+
+    // profile device operation instances and save the id of the best performant instance
+    std::cout << "Run all instances and do timing" << std::endl;
+
+    for(const auto& op_ptr : op_ptrs)
+    {
+        auto argument_ptr = op_ptr->MakeArgumentPointer(a.GetDeviceBuffer(),
+                                                        b.GetDeviceBuffer(),
+                                                        c.GetDeviceBuffer(),
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        StrideA,
+                                                        StrideB,
+                                                        StrideC,
+                                                        1,
+                                                        PassThrough{},
+                                                        PassThrough{},
+                                                        PassThrough{});
+
+        auto invoker_ptr = op_ptr->MakeInvokerPointer();
+
+        if(op_ptr->IsSupportedArgument(argument_ptr.get()))
+        {
+            float ave_time = invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, true});
+
+            if(ave_time < best_ave_time)
+            {
+                best_ave_time = ave_time;
+                instance_id   = op_ptr->GetInstanceId();
+            }
+        }
+    }
+
+    std::cout << "Best instance: " << instance_id << std::endl;
+
+    // simulate the execution of the operation when the instance id is available: only the
+    // instance with the id is constructed
+    auto op_ptr = Factory::GetRegistry().MakeInstance(instance_id);
+
+    if(op_ptr)
+    {
+        auto argument_ptr = op_ptr->MakeArgumentPointer(a.GetDeviceBuffer(),
+                                                        b.GetDeviceBuffer(),
+                                                        c.GetDeviceBuffer(),
+                                                        M,
+                                                        N,
+                                                        K,
+                                                        StrideA,
+                                                        StrideB,
+                                                        StrideC,
+                                                        1,
+                                                        PassThrough{},
+                                                        PassThrough{},
+                                                        PassThrough{});
+
+        auto invoker_ptr = op_ptr->MakeInvokerPointer();
+
+        if(op_ptr->IsSupportedArgument(argument_ptr.get()))
+        {
+            float exec_time = invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, true});
+
+            std::size_t flop = std::size_t(2) * M * N * K;
+
+            float tflops = static_cast<float>(flop) / 1.E9 / exec_time;
+
+            std::cout << "Kernel execution time: " << std::setw(10) << exec_time << " ms, "
+                      << tflops << " TFlops, " << op_ptr->GetTypeString() << std::endl;
+        }
+    }
+    else
+    {
+        std::cout << "no instance with id " << instance_id << std::endl;
+    }
+
+    return 0;
+}
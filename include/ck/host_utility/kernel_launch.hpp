@@ -3,11 +3,73 @@
 
 #pragma once
 
+#include <iostream>
+#include <vector>
+
 #include <hip/hip_runtime.h>
 
 #include "ck/ck.hpp"
 #include "ck/stream_config.hpp"
 #include "ck/host_utility/hip_check_error.hpp"
+#include "ck/host_utility/kernel_timing.hpp"
+
+namespace ck {
+namespace detail {
+
+// time n calls of launch, each one between its own pair of consecutive events of the stream
+template <typename Launch>
+std::vector<float> time_kernel_iterations(hipStream_t stream, int n, Launch& launch)
+{
+    std::vector<hipEvent_t> events(n + 1);
+    for(auto& event : events)
+        hip_check_error(hipEventCreate(&event));
+
+    hip_check_error(hipDeviceSynchronize());
+    hip_check_error(hipEventRecord(events[0], stream));
+
+    for(int i = 0; i < n; ++i)
+    {
+        launch();
+        hip_check_error(hipEventRecord(events[i + 1], stream));
+    }
+
+    hip_check_error(hipEventSynchronize(events[n]));
+
+    std::vector<float> times(n);
+    for(int i = 0; i < n; ++i)
+        hip_check_error(hipEventElapsedTime(&times[i], events[i], events[i + 1]));
+
+    for(auto& event : events)
+        hip_check_error(hipEventDestroy(event));
+
+    return times;
+}
+
+// statistical timing of launch, returns the mean time without outliers
+template <typename Launch>
+float time_kernel_statistically(const StreamConfig& stream_config, Launch launch)
+{
+    const auto statistics = run_kernel_timing(
+        stream_config.nrepeat_,
+        stream_config.max_nrepeat_,
+        stream_config.timing_tolerance_,
+        [&](int n) { return time_kernel_iterations(stream_config.stream_id_, n, launch); });
+
+    if(ck::EnvIsEnabled(CK_ENV(CK_LOGGING)))
+    {
+        std::cout << "Timing: " << statistics << std::endl;
+    }
+
+    if(stream_config.timing_statistics_ != nullptr)
+    {
+        *stream_config.timing_statistics_ = statistics;
+    }
+
+    return statistics.mean_;
+}
+
+} // namespace detail
+} // namespace ck
 
 template <typename... Args, typename F>
 float launch_and_time_kernel(const StreamConfig& stream_config,
@@ -40,6 +102,14 @@ float launch_and_time_kernel(const StreamConfig& stream_config,
             hip_check_error(hipGetLastError());
         }
 
+        if(stream_config.statistical_timing_)
+        {
+            return ck::detail::time_kernel_statistically(stream_config, [&] {
+                kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
+                hip_check_error(hipGetLastError());
+            });
+        }
+
         const int nrepeat = stream_config.nrepeat_;
         if(ck::EnvIsEnabled(CK_ENV(CK_LOGGING)))
         {
@@ -119,6 +189,15 @@ float launch_and_time_kernel_with_preprocess(const StreamConfig& stream_config,
             hip_check_error(hipGetLastError());
         }
 
+        if(stream_config.statistical_timing_)
+        {
+            return ck::detail::time_kernel_statistically(stream_config, [&] {
+                preprocess();
+                kernel<<<grid_dim, block_dim, lds_byte, stream_config.stream_id_>>>(args...);
+                hip_check_error(hipGetLastError());
+            });
+        }
+
         const int nrepeat = stream_config.nrepeat_;
         if(ck::EnvIsEnabled(CK_ENV(CK_LOGGING)))
         {
@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+namespace ck {
+
+// Statistics of the per-iteration times of a kernel, in ms.
+//
+// The percentiles are taken over all samples, so they show jitter and clock ramp. Samples
+// further than kOutlierThreshold scaled median absolute deviations from the median are
+// outliers and are left out of the mean and the standard deviation.
+struct KernelTimingStatistics
+{
+    static constexpr float kOutlierThreshold = 3.5f;
+
+    int num_sample_  = 0;
+    int num_outlier_ = 0;
+
+    float min_    = 0;
+    float median_ = 0;
+    float p90_    = 0;
+    float p99_    = 0;
+    float max_    = 0;
+
+    float mean_   = 0;
+    float stddev_ = 0;
+
+    // the 95% confidence interval of the mean is within the tolerance of the timing run
+    bool converged_ = false;
+
+    // half width of the 95% confidence interval of the mean, relative to the mean
+    float GetRelativeError() const
+    {
+        const int num_inlier = num_sample_ - num_outlier_;
+
+        if(num_inlier < 2)
+            return INFINITY;
+
+        if(mean_ <= 0)
+            return stddev_ == 0 ? 0.f : INFINITY;
+
+        return 1.96f * stddev_ / std::sqrt(static_cast<float>(num_inlier)) / mean_;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const KernelTimingStatistics& s)
+    {
+        return os << "samples " << s.num_sample_ << " (" << s.num_outlier_ << " outliers), min "
+                  << s.min_ << " ms, median " << s.median_ << " ms, p90 " << s.p90_
+                  << " ms, p99 " << s.p99_ << " ms, max " << s.max_ << " ms, mean " << s.mean_
+                  << " ms, stddev " << s.stddev_ << " ms"
+                  << (s.converged_ ? "" : ", not converged");
+    }
+};
+
+// statistics of the per-iteration times in samples
+inline KernelTimingStatistics summarize_kernel_timing(std::vector<float> samples)
+{
+    KernelTimingStatistics s;
+
+    s.num_sample_ = static_cast<int>(samples.size());
+
+    if(samples.empty())
+        return s;
+
+    std::sort(samples.begin(), samples.end());
+
+    // nearest-rank percentile
+    auto percentile = [&](float p) {
+        const auto rank = static_cast<std::size_t>(std::ceil(p * samples.size()));
+        return samples[std::clamp<std::size_t>(rank, 1, samples.size()) - 1];
+    };
+
+    const std::size_t n = samples.size();
+
+    s.min_    = samples.front();
+    s.max_    = samples.back();
+    s.median_ = n % 2 == 1 ? samples[n / 2] : (samples[n / 2 - 1] + samples[n / 2]) / 2;
+    s.p90_    = percentile(0.90f);
+    s.p99_    = percentile(0.99f);
+
+    // median absolute deviation, scaled to estimate the standard deviation of normal samples
+    std::vector<float> deviations(n);
+    for(std::size_t i = 0; i < n; ++i)
+        deviations[i] = std::abs(samples[i] - s.median_);
+    std::nth_element(deviations.begin(), deviations.begin() + n / 2, deviations.end());
+
+    const float threshold =
+        KernelTimingStatistics::kOutlierThreshold * 1.4826f * deviations[n / 2];
+
+    // with more than half of the samples equal nothing is rejected
+    auto is_outlier = [&](float t) { return threshold > 0 && std::abs(t - s.median_) > threshold; };
+
+    double sum     = 0;
+    int num_inlier = 0;
+    for(const float t : samples)
+    {
+        if(!is_outlier(t))
+        {
+            sum += t;
+            ++num_inlier;
+        }
+    }
+
+    const double mean = sum / num_inlier;
+
+    double sum_sq = 0;
+    for(const float t : samples)
+        if(!is_outlier(t))
+            sum_sq += (t - mean) * (t - mean);
+
+    s.num_outlier_ = s.num_sample_ - num_inlier;
+    s.mean_        = static_cast<float>(mean);
+    s.stddev_      = num_inlier > 1 ? static_cast<float>(std::sqrt(sum_sq / (num_inlier - 1))) : 0;
+
+    return s;
+}
+
+// Time a kernel until its mean time converges.
+//
+// time_iterations(n) runs n iterations and returns the time of every one of them; on the GPU
+// each iteration sits between its own pair of events, tests pass a mocked timer. The first
+// min_nrepeat iterations are always run, after that the number of iterations is doubled until
+// the 95% confidence interval of the mean is within tolerance of the mean, or max_nrepeat
+// iterations are reached.
+template <typename TimeIterations>
+KernelTimingStatistics run_kernel_timing(int min_nrepeat,
+                                         int max_nrepeat,
+                                         float tolerance,
+                                         TimeIterations&& time_iterations)
+{
+    min_nrepeat = std::max(min_nrepeat, 1);
+    max_nrepeat = std::max(max_nrepeat, min_nrepeat);
+
+    std::vector<float> samples;
+    int batch = min_nrepeat;
+
+    while(true)
+    {
+        const std::vector<float> times = time_iterations(batch);
+        samples.insert(samples.end(), times.begin(), times.end());
+
+        auto s       = summarize_kernel_timing(samples);
+        s.converged_ = s.GetRelativeError() <= tolerance;
+
+        const int num_sample = static_cast<int>(samples.size());
+        if(s.converged_ || num_sample >= max_nrepeat || times.empty())
+            return s;
+
+        batch = std::min(num_sample, max_nrepeat - num_sample);
+    }
+}
+
+} // namespace ck
@@ -6,6 +6,10 @@
 #include <hip/hip_runtime.h>
 #include <hip/hip_fp16.h>
 
+namespace ck {
+struct KernelTimingStatistics;
+} // namespace ck
+
 struct StreamConfig
 {
     hipStream_t stream_id_ = nullptr;
@@ -16,4 +20,13 @@ struct StreamConfig
 
     bool flush_cache   = false;
     int rotating_count = 1;
+
+    // Opt-in statistical timing, see ck/host_utility/kernel_timing.hpp: every iteration is
+    // timed on its own, from nrepeat_ up to max_nrepeat_ iterations until the mean is known to
+    // within timing_tolerance_. The mean without outliers is returned, the full statistics are
+    // written to *timing_statistics_ if it is set.
+    bool statistical_timing_                       = false;
+    int max_nrepeat_                               = 1000;
+    float timing_tolerance_                        = 0.01f;
+    ck::KernelTimingStatistics* timing_statistics_ = nullptr;
 };
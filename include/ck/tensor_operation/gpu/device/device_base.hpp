@@ -57,6 +57,10 @@ struct BaseOperator
         return oss.str();
     };
 
+    // id of the instance that stays the same across builds and library versions, see
+    // device_instance_id.hpp; empty if the device op does not provide one
+    virtual std::string GetInstanceId() const { return ""; }
+
     virtual size_t GetWorkSpaceSize(const BaseArgument*) const { return 0; }
 
     virtual void SetWorkSpacePointer(BaseArgument* p_arg,
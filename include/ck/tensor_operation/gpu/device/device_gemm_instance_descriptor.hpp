@@ -0,0 +1,59 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <string>
+
+#include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+
+// Static metadata of a GEMM device op instance: its tiling, vector widths and pipeline.
+//
+// Instances provide it as a constexpr static GetInstanceDescriptor(), so it can be queried
+// before, or instead of, constructing the instance. Only plain values are stored, the
+// descriptor is usable in host code that does not include the device headers.
+struct DeviceGemmInstanceDescriptor
+{
+    const char* family_ = ""; // device op, e.g. "DeviceGemmXdlUniversal"
+
+    GemmSpecialization gemm_spec_ = GemmSpecialization::Default;
+
+    int block_size_  = 0;
+    int m_per_block_ = 0;
+    int n_per_block_ = 0;
+    int k_per_block_ = 0;
+    int ak1_         = 0;
+    int bk1_         = 0;
+
+    int m_per_xdl_      = 0;
+    int n_per_xdl_      = 0;
+    int m_xdl_per_wave_ = 0;
+    int n_xdl_per_wave_ = 0;
+
+    // layouts of A, B and C: RowMajor, else ColumnMajor
+    bool a_row_major_ = false;
+    bool b_row_major_ = false;
+    bool c_row_major_ = false;
+
+    // vector dimension and width of the global reads of A and B, width of the writes of C
+    int a_src_vector_dim_        = 0;
+    int a_src_scalar_per_vector_ = 0;
+    int b_src_vector_dim_        = 0;
+    int b_src_scalar_per_vector_ = 0;
+    int c_dst_scalar_per_vector_ = 0;
+
+    int pipeline_version_    = 0;     // n of BlockGemmPipelineVersion::vn
+    bool pipeline_interwave_ = false; // BlockGemmPipelineScheduler::Interwave
+    int pipeline_prefetch_   = 0;     // global prefetch stages of the pipeline
+    int lds_bytes_           = 0;     // LDS per workgroup
+
+    bool xdl_ = false; // runs only on devices with XDL instructions
+};
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
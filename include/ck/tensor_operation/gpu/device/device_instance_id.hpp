@@ -0,0 +1,125 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <type_traits>
+
+#include "ck/utility/data_type.hpp"
+#include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
+
+namespace ck {
+
+template <index_t...>
+struct Sequence;
+
+namespace tensor_operation {
+namespace device {
+
+// Canonical text of the template parameters of a device op instance, e.g.
+//   DeviceGemmXdlUniversal<RowMajor,ColumnMajor,RowMajor,fp16,...,MNKPadding,256,S<8,32,1>,...>
+//
+// Only values and fixed names go into the key, never compiler generated type names, so an
+// instance has the same key in every build. The elementwise operations have no names and are
+// left out; they are fixed by the device op interface the instances implement.
+class InstanceKeyBuilder
+{
+    public:
+    explicit InstanceKeyBuilder(const char* family) : key_(family) {}
+
+    template <typename T>
+    InstanceKeyBuilder& Add(T value)
+    {
+        // enums go in by name, their values change when enumerators are added
+        static_assert(std::is_integral_v<T>,
+                      "wrong! only integral parameters have a canonical text, add enums by name");
+
+        Separate();
+        key_ += std::to_string(static_cast<long long>(value));
+        return *this;
+    }
+
+    InstanceKeyBuilder& Add(GemmSpecialization spec)
+    {
+        return AddName(getGemmSpecializationString(spec).c_str());
+    }
+
+    template <index_t... Is>
+    InstanceKeyBuilder& Add(Sequence<Is...>)
+    {
+        Separate();
+        key_ += "S<";
+        ((key_ += std::to_string(Is) + ","), ...);
+        if(sizeof...(Is) > 0)
+            key_.pop_back();
+        key_ += '>';
+        return *this;
+    }
+
+    // e.g. the name of a tensor layout
+    InstanceKeyBuilder& AddName(const char* name)
+    {
+        Separate();
+        key_ += name;
+        return *this;
+    }
+
+    template <typename T>
+    InstanceKeyBuilder& AddDataType()
+    {
+        if constexpr(std::is_same_v<T, double>)
+            return AddName("fp64");
+        else if constexpr(std::is_same_v<T, float>)
+            return AddName("fp32");
+        else if constexpr(std::is_same_v<T, half_t>)
+            return AddName("fp16");
+        else if constexpr(std::is_same_v<T, bhalf_t>)
+            return AddName("bf16");
+        else if constexpr(std::is_same_v<T, f8_t>)
+            return AddName("fp8");
+        else if constexpr(std::is_same_v<T, bf8_t>)
+            return AddName("bf8");
+        else if constexpr(std::is_same_v<T, int8_t>)
+            return AddName("int8");
+        else if constexpr(std::is_same_v<T, int32_t>)
+            return AddName("int32");
+        else
+            static_assert(!std::is_same_v<T, T>, "wrong! data type has no canonical name");
+    }
+
+    std::string Get() const { return key_ + (has_parameter_ ? ">" : "<>"); }
+
+    private:
+    void Separate()
+    {
+        key_ += has_parameter_ ? ',' : '<';
+        has_parameter_ = true;
+    }
+
+    std::string key_;
+    bool has_parameter_ = false;
+};
+
+// Stable id of the instance with the given key: the family, i.e. the key up to its parameters,
+// and the 64-bit FNV-1a hash of the whole key, e.g. "DeviceGemmXdlUniversal-9f3a51c07d24e6b8".
+inline std::string get_instance_id(const std::string& key)
+{
+    std::uint64_t hash = 0xCBF29CE484222325;
+    for(const char c : key)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 0x100000001B3;
+    }
+
+    char digits[17];
+    std::snprintf(digits, sizeof(digits), "%016llx", static_cast<unsigned long long>(hash));
+
+    return key.substr(0, key.find('<')) + "-" + digits;
+}
+
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -11,6 +11,8 @@
 #include "ck/tensor_description/tensor_descriptor_helper.hpp"
 #include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
 #include "ck/tensor_operation/gpu/device/device_gemm_v2.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm_instance_descriptor.hpp"
+#include "ck/tensor_operation/gpu/device/device_instance_id.hpp"
 #include "ck/tensor_operation/gpu/device/gemm_specialization.hpp"
 #include "ck/tensor_operation/gpu/grid/gridwise_gemm_xdl_cshuffle_v3.hpp"
 #include "ck/host_utility/device_prop.hpp"
@@ -685,15 +687,56 @@ struct DeviceGemm_Xdl_CShuffleV3 : public DeviceGemmV2<ALayout,
         return std::make_unique<Invoker>(Invoker{});
     }
 
-    // polymorphic
-    std::string GetTypeString() const override
+    static constexpr DeviceGemmInstanceDescriptor GetInstanceDescriptor()
     {
-        auto str = std::stringstream();
+        DeviceGemmInstanceDescriptor desc;
+
+        desc.family_      = "DeviceGemmXdlUniversal";
+        desc.gemm_spec_   = GemmSpec;
+        desc.block_size_  = BlockSize;
+        desc.m_per_block_ = MPerBlock;
+        desc.n_per_block_ = NPerBlock;
+        desc.k_per_block_ = KPerBlock;
+        desc.ak1_         = AK1;
+        desc.bk1_         = BK1;
+
+        desc.m_per_xdl_      = MPerXDL;
+        desc.n_per_xdl_      = NPerXDL;
+        desc.m_xdl_per_wave_ = MXdlPerWave;
+        desc.n_xdl_per_wave_ = NXdlPerWave;
+
+        desc.a_row_major_ = is_same_v<ALayout, tensor_layout::gemm::RowMajor>;
+        desc.b_row_major_ = is_same_v<BLayout, tensor_layout::gemm::RowMajor>;
+        desc.c_row_major_ = is_same_v<CLayout, tensor_layout::gemm::RowMajor>;
+
+        desc.a_src_vector_dim_        = ABlockTransferSrcVectorDim;
+        desc.a_src_scalar_per_vector_ = ABlockTransferSrcScalarPerVector;
+        desc.b_src_vector_dim_        = BBlockTransferSrcVectorDim;
+        desc.b_src_scalar_per_vector_ = BBlockTransferSrcScalarPerVector;
+        desc.c_dst_scalar_per_vector_ = CShuffleBlockTransferScalarPerVector_NPerBlock;
+
+        desc.pipeline_version_   = static_cast<int>(BlkGemmPipelineVer) + 1;
+        desc.pipeline_interwave_ = BlkGemmPipeSched == BlockGemmPipelineScheduler::Interwave;
+        desc.pipeline_prefetch_  = GridwiseGemm::BlockwiseGemmPipe::PrefetchStages;
+        desc.lds_bytes_          = GridwiseGemm::GetSharedMemoryNumberOfByte();
+
+        desc.xdl_ = true;
+
+        return desc;
+    }
 
+    // names of the pipeline scheduler and version, in the type string and the instance key
+    static std::string GetBlkGemmPipeSchedString()
+    {
         std::map<BlockGemmPipelineScheduler, std::string> BlkGemmPipelineSchedulerToString{
             {BlockGemmPipelineScheduler::Intrawave, "Intrawave"},
             {BlockGemmPipelineScheduler::Interwave, "Interwave"}};
 
+        return BlkGemmPipelineSchedulerToString[BlkGemmPipeSched];
+    }
+
+    static std::string GetBlkGemmPipelineVerString()
+    {
         std::map<BlockGemmPipelineVersion, std::string> BlkGemmPipelineVersionToString{
             {BlockGemmPipelineVersion::v1, "v1"},
             {BlockGemmPipelineVersion::v2, "v2"},
@@ -701,6 +744,65 @@ struct DeviceGemm_Xdl_CShuffleV3 : public DeviceGemmV2<ALayout,
             {BlockGemmPipelineVersion::v4, "v4"},
             {BlockGemmPipelineVersion::v5, "v5"}};
 
+        return BlkGemmPipelineVersionToString[BlkGemmPipelineVer];
+    }
+
+    // canonical text of the template parameters, the basis of the instance id
+    static std::string GetInstanceKey()
+    {
+        return InstanceKeyBuilder("DeviceGemmXdlUniversal")
+            .AddName(ALayout::name)
+            .AddName(BLayout::name)
+            .AddName(CLayout::name)
+            .AddDataType<ADataType>()
+            .AddDataType<BDataType>()
+            .AddDataType<CDataType>()
+            .AddDataType<GemmAccDataType>()
+            .AddDataType<CShuffleDataType>()
+            .AddName(getGemmSpecializationString(GemmSpec).c_str())
+            .Add(BlockSize)
+            .Add(MPerBlock)
+            .Add(NPerBlock)
+            .Add(KPerBlock)
+            .Add(AK1)
+            .Add(BK1)
+            .Add(MPerXDL)
+            .Add(NPerXDL)
+            .Add(MXdlPerWave)
+            .Add(NXdlPerWave)
+            .Add(ABlockTransferThreadClusterLengths_AK0_M_AK1{})
+            .Add(ABlockTransferThreadClusterArrangeOrder{})
+            .Add(ABlockTransferSrcAccessOrder{})
+            .Add(ABlockTransferSrcVectorDim)
+            .Add(ABlockTransferSrcScalarPerVector)
+            .Add(ABlockTransferDstScalarPerVector_AK1)
+            .Add(ABlockLdsExtraM)
+            .Add(BBlockTransferThreadClusterLengths_BK0_N_BK1{})
+            .Add(BBlockTransferThreadClusterArrangeOrder{})
+            .Add(BBlockTransferSrcAccessOrder{})
+            .Add(BBlockTransferSrcVectorDim)
+            .Add(BBlockTransferSrcScalarPerVector)
+            .Add(BBlockTransferDstScalarPerVector_BK1)
+            .Add(BBlockLdsExtraN)
+            .Add(CShuffleMXdlPerWavePerShuffle)
+            .Add(CShuffleNXdlPerWavePerShuffle)
+            .Add(CShuffleBlockTransferClusterLengths_MBlock_MPerBlock_NBlock_NPerBlock{})
+            .Add(CShuffleBlockTransferScalarPerVector_NPerBlock)
+            .AddName(GetBlkGemmPipeSchedString().c_str())
+            .AddName(GetBlkGemmPipelineVerString().c_str())
+            .AddDataType<ComputeTypeA>()
+            .AddDataType<ComputeTypeB>()
+            .Get();
+    }
+
+    // polymorphic
+    std::string GetInstanceId() const override { return get_instance_id(GetInstanceKey()); }
+
+    // polymorphic
+    std::string GetTypeString() const override
+    {
+        auto str = std::stringstream();
+
         // clang-format off
         str << "DeviceGemmXdlUniversal"
             << "<"
@@ -720,9 +822,9 @@ struct DeviceGemm_Xdl_CShuffleV3 : public DeviceGemmV2<ALayout,
             << "VmemReadVec: "
             << ABlockTransferSrcScalarPerVector<<"x"<<BBlockTransferSrcScalarPerVector<<", "
             << "BlkGemmPipelineScheduler: "
-            << BlkGemmPipelineSchedulerToString[BlkGemmPipeSched] << ", "
+            << GetBlkGemmPipeSchedString() << ", "
             << "BlkGemmPipelineVersion: "
-            << BlkGemmPipelineVersionToString[BlkGemmPipelineVer] << ", "
+            << GetBlkGemmPipelineVerString() << ", "
             << "BlkGemmPipelinePrefetchStages: "
             << GridwiseGemm::BlockwiseGemmPipe::PrefetchStages;
         // clang-format on
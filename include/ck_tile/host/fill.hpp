@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <iterator>
 #include <optional>
 #include <random>
@@ -12,6 +13,7 @@
 #include <utility>
 
 #include "ck_tile/core.hpp"
+#include "ck_tile/host/host_philox.hpp"
 
 namespace ck_tile {
 
@@ -25,9 +27,14 @@ struct FillUniformDistribution
     template <typename ForwardIter>
     void operator()(ForwardIter first, ForwardIter last) const
     {
-        std::mt19937 gen(seed_.has_value() ? *seed_ : std::random_device{}());
-        std::uniform_real_distribution<float> dis(a_, b_);
-        std::generate(first, last, [&dis, &gen]() { return ck_tile::type_convert<T>(dis(gen)); });
+        const std::uint32_t seed = seed_.has_value() ? *seed_ : std::random_device{}();
+        const float a            = a_;
+        const float scale        = b_ - a_;
+
+        ck_tile::host_philox_fill(first, last, seed, [=](std::uint32_t bits) {
+            return ck_tile::type_convert<T>(a +
+                                            scale * ck_tile::HostPhilox::to_uniform_float(bits));
+        });
     }
 
     template <typename ForwardRange>
@@ -96,10 +103,14 @@ struct FillUniformDistributionIntegerValue
     template <typename ForwardIter>
     void operator()(ForwardIter first, ForwardIter last) const
     {
-        std::mt19937 gen(seed_.has_value() ? *seed_ : std::random_device{}());
-        std::uniform_real_distribution<float> dis(a_, b_);
-        std::generate(
-            first, last, [&dis, &gen]() { return ck_tile::type_convert<T>(std::round(dis(gen))); });
+        const std::uint32_t seed = seed_.has_value() ? *seed_ : std::random_device{}();
+        const float a            = a_;
+        const float scale        = b_ - a_;
+
+        ck_tile::host_philox_fill(first, last, seed, [=](std::uint32_t bits) {
+            return ck_tile::type_convert<T>(
+                std::round(a + scale * ck_tile::HostPhilox::to_uniform_float(bits)));
+        });
     }
 
     template <typename ForwardRange>
@@ -0,0 +1,227 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include "ck_tile/host/host_thread_pool.hpp"
+
+// Like host_thread_pool.hpp this header only depends on the standard library and POSIX, so
+// the ck library Tensor and the ck_tile HostTensor share the same storage policy.
+
+namespace ck_tile {
+
+// Storage policy of the host tensors.
+//
+// Allocations of at least kLargeAllocationBytes are mapped directly from the kernel, aligned to
+// 2MB and marked for transparent huge pages. Anonymous mappings are zero-filled by the kernel,
+// so value-initializing the elements needs no zeroing pass: the pages are only touched once,
+// in parallel on the host thread pool. The touch splits the n elements exactly like a
+// ParallelTensorFunctor or GenerateTensorValue() over the whole pool does, so with first-touch
+// NUMA placement every thread of such a fill finds the pages of its chunk on its own node; the
+// pool does not pin its threads, which keeps the placement best effort. Smaller allocations come
+// from a 64B aligned operator new and are zeroed explicitly.
+//
+// construct() without arguments skips value-initializing trivially default constructible types
+// in the storage of the last allocate() that no element was constructed in yet, which makes
+// std::vector<T, HostAllocator<T>>(n) zero-initialized without a serial pass over n. Storage
+// that held an element, e.g. after a shrink and a regrow within the capacity, is initialized as
+// usual. The allocator follows its storage on copy, move and swap of the container; a copied
+// allocator knows of no storage.
+template <typename T>
+struct HostAllocator
+{
+    using value_type = T;
+
+    static constexpr std::size_t kAlignment            = 64;
+    static constexpr std::size_t kHugePageBytes        = std::size_t{2} << 20;
+    static constexpr std::size_t kLargeAllocationBytes = kHugePageBytes;
+    static constexpr std::size_t kTouchStrideBytes     = 4096;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+    using is_always_equal                        = std::false_type;
+
+    HostAllocator() = default;
+
+    HostAllocator(const HostAllocator&) noexcept {}
+
+    template <typename U>
+    HostAllocator(const HostAllocator<U>&) noexcept
+    {
+    }
+
+    HostAllocator& operator=(const HostAllocator&) noexcept
+    {
+        fresh_begin_ = nullptr;
+        fresh_end_   = nullptr;
+        return *this;
+    }
+
+    T* allocate(std::size_t n)
+    {
+        if(n > std::numeric_limits<std::size_t>::max() / sizeof(T))
+            throw std::bad_array_new_length();
+
+        const std::size_t bytes = n * sizeof(T);
+
+        T* p = nullptr;
+
+#if defined(__linux__)
+        if(bytes >= kLargeAllocationBytes)
+            p = static_cast<T*>(allocate_large(n));
+#endif
+
+        if(p == nullptr)
+        {
+            p = static_cast<T*>(::operator new(bytes, std::align_val_t{kAlignment}));
+            std::memset(static_cast<void*>(p), 0, bytes);
+        }
+
+        fresh_begin_ = p;
+        fresh_end_   = p;
+
+        return p;
+    }
+
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        const std::size_t bytes = n * sizeof(T);
+
+        if(p == fresh_begin_)
+        {
+            fresh_begin_ = nullptr;
+            fresh_end_   = nullptr;
+        }
+
+#if defined(__linux__)
+        if(bytes >= kLargeAllocationBytes)
+        {
+            munmap(static_cast<void*>(p), round_up(bytes, kHugePageBytes));
+            return;
+        }
+#endif
+
+        ::operator delete(static_cast<void*>(p), std::align_val_t{kAlignment});
+    }
+
+    // the memory handed out by allocate() is zero until an element is constructed in it
+    template <typename U>
+    void construct(U* p) noexcept(std::is_nothrow_default_constructible_v<U>)
+    {
+        if constexpr(std::is_same_v<U, T> && std::is_trivially_default_constructible_v<U>)
+        {
+            if(fresh_begin_ != nullptr && p == fresh_end_)
+            {
+                ++fresh_end_;
+                return;
+            }
+        }
+
+        ::new(static_cast<void*>(p)) U();
+        mark_constructed(p);
+    }
+
+    template <typename U, typename... Args>
+    void construct(U* p, Args&&... args)
+    {
+        ::new(static_cast<void*>(p)) U(std::forward<Args>(args)...);
+        mark_constructed(p);
+    }
+
+    template <typename U>
+    friend bool operator==(const HostAllocator&, const HostAllocator<U>&) noexcept
+    {
+        return true;
+    }
+
+    template <typename U>
+    friend bool operator!=(const HostAllocator&, const HostAllocator<U>&) noexcept
+    {
+        return false;
+    }
+
+    private:
+    template <typename U>
+    void mark_constructed(U* p) noexcept
+    {
+        if constexpr(std::is_same_v<U, T>)
+        {
+            // an element past the zero storage leaves a gap that is initialized as usual
+            if(fresh_begin_ != nullptr && !std::less<const T*>{}(p, fresh_end_))
+                fresh_end_ = p + 1;
+        }
+    }
+
+    static constexpr std::size_t round_up(std::size_t x, std::size_t align)
+    {
+        return (x + align - 1) / align * align;
+    }
+
+#if defined(__linux__)
+    static void* allocate_large(std::size_t n)
+    {
+        const std::size_t bytes  = n * sizeof(T);
+        const std::size_t length = round_up(bytes, kHugePageBytes);
+
+        // over-allocate by one huge page and trim the unaligned head and tail
+        void* base = mmap(nullptr,
+                          length + kHugePageBytes,
+                          PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS,
+                          -1,
+                          0);
+        if(base == MAP_FAILED)
+            throw std::bad_alloc();
+
+        const auto base_addr = reinterpret_cast<std::uintptr_t>(base);
+        const auto addr      = round_up(base_addr, kHugePageBytes);
+        const std::size_t head = addr - base_addr;
+        const std::size_t tail = kHugePageBytes - head;
+
+        auto* p = reinterpret_cast<char*>(addr);
+
+        if(head > 0)
+            munmap(base, head);
+        if(tail > 0)
+            munmap(p + length, tail);
+
+#if defined(MADV_HUGEPAGE)
+        // best effort, the mapping is still usable without huge pages
+        madvise(p, length, MADV_HUGEPAGE);
+#endif
+
+        // parallel first touch over the same element chunks as a fill on all threads: a chunk
+        // touches the pages that start within its bytes, writing zero keeps the contents
+        HostThreadPool::instance().parallel_for(n, [p](std::size_t begin, std::size_t end) {
+            const std::size_t page_begin = round_up(begin * sizeof(T), kTouchStrideBytes);
+            const std::size_t page_end   = round_up(end * sizeof(T), kTouchStrideBytes);
+
+            for(std::size_t i = page_begin; i < page_end; i += kTouchStrideBytes)
+                static_cast<volatile char*>(p)[i] = 0;
+        });
+
+        return p;
+    }
+#endif
+
+    // [fresh_begin_, fresh_end_) held elements, everything past fresh_end_ in the storage
+    // starting at fresh_begin_ is still zero
+    T* fresh_begin_ = nullptr;
+    T* fresh_end_   = nullptr;
+};
+
+} // namespace ck_tile
@@ -0,0 +1,175 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include "ck_tile/host/host_thread_pool.hpp"
+
+// Like host_thread_pool.hpp this header only depends on the standard library, so the fill
+// functors of the ck library and of ck_tile draw from the same random stream.
+
+namespace ck_tile {
+
+// Counter-based Philox4x32-10 generator for host side tensor initialization.
+//
+// Every counter maps to four independent 32-bit random numbers through a fixed function of
+// (seed, counter), so any element of a random stream can be computed without the ones before
+// it. This is the same round function as ck_tile::philox used by the dropout kernels, with
+// the full 10 rounds of the reference Random123 generator.
+struct HostPhilox
+{
+    static constexpr std::size_t kNumLane = 4;
+
+    explicit HostPhilox(std::uint64_t seed)
+        : key_lo_(static_cast<std::uint32_t>(seed)),
+          key_hi_(static_cast<std::uint32_t>(seed >> 32))
+    {
+    }
+
+    std::array<std::uint32_t, kNumLane> operator()(std::uint64_t counter) const
+    {
+        std::array<std::uint32_t, kNumLane> out;
+        generate(counter, 1, out.data());
+        return out;
+    }
+
+    // out[kNumLane * i + lane] = lane of counter (counter_begin + i), for i in [0, n)
+    void generate(std::uint64_t counter_begin, std::size_t n, std::uint32_t* out) const
+    {
+        // counters are processed in structure-of-arrays batches so that every round is a
+        // straight loop of 32x32->64 bit multiplies, which the compiler vectorizes
+        constexpr std::size_t kBatch = 64;
+
+        std::uint32_t c0[kBatch];
+        std::uint32_t c1[kBatch];
+        std::uint32_t c2[kBatch];
+        std::uint32_t c3[kBatch];
+
+        for(std::size_t batch_begin = 0; batch_begin < n; batch_begin += kBatch)
+        {
+            const std::size_t batch = std::min(kBatch, n - batch_begin);
+
+            for(std::size_t j = 0; j < batch; ++j)
+            {
+                const std::uint64_t counter = counter_begin + batch_begin + j;
+
+                c0[j] = static_cast<std::uint32_t>(counter);
+                c1[j] = static_cast<std::uint32_t>(counter >> 32);
+                c2[j] = 0;
+                c3[j] = 0;
+            }
+
+            std::uint32_t k0 = key_lo_;
+            std::uint32_t k1 = key_hi_;
+
+            for(std::size_t round = 0; round < kNumRound; ++round)
+            {
+                for(std::size_t j = 0; j < batch; ++j)
+                {
+                    const std::uint64_t p0 = std::uint64_t{kMultiplier0} * c0[j];
+                    const std::uint64_t p1 = std::uint64_t{kMultiplier1} * c2[j];
+
+                    const auto x0 = static_cast<std::uint32_t>(p1 >> 32) ^ c1[j] ^ k0;
+                    const auto x2 = static_cast<std::uint32_t>(p0 >> 32) ^ c3[j] ^ k1;
+
+                    c1[j] = static_cast<std::uint32_t>(p1);
+                    c3[j] = static_cast<std::uint32_t>(p0);
+                    c0[j] = x0;
+                    c2[j] = x2;
+                }
+
+                k0 += kWeyl0;
+                k1 += kWeyl1;
+            }
+
+            std::uint32_t* p = out + kNumLane * batch_begin;
+
+            for(std::size_t j = 0; j < batch; ++j)
+            {
+                p[kNumLane * j + 0] = c0[j];
+                p[kNumLane * j + 1] = c1[j];
+                p[kNumLane * j + 2] = c2[j];
+                p[kNumLane * j + 3] = c3[j];
+            }
+        }
+    }
+
+    // uniform float in [0, 1) from the upper 24 bits
+    static float to_uniform_float(std::uint32_t bits)
+    {
+        return static_cast<float>(bits >> 8) * (1.f / 16777216.f);
+    }
+
+    private:
+    static constexpr std::size_t kNumRound     = 10;
+    static constexpr std::uint32_t kMultiplier0 = 0xD2511F53;
+    static constexpr std::uint32_t kMultiplier1 = 0xCD9E8D57;
+    static constexpr std::uint32_t kWeyl0       = 0x9E3779B9;
+    static constexpr std::uint32_t kWeyl1       = 0xBB67AE85;
+
+    std::uint32_t key_lo_;
+    std::uint32_t key_hi_;
+};
+
+// *it = f(bits) for every element of [first, last), where element i gets lane (i % 4) of
+// counter (i / 4) of the Philox stream of seed. Random access ranges are filled in parallel
+// on the host thread pool; the result only depends on the seed and the element index, so it
+// is the same for any number of threads (max_thread = 0 uses all threads of the pool).
+template <typename ForwardIter, typename F>
+void host_philox_fill(
+    ForwardIter first, ForwardIter last, std::uint64_t seed, F&& f, std::size_t max_thread = 0)
+{
+    using Category = typename std::iterator_traits<ForwardIter>::iterator_category;
+
+    constexpr std::size_t kNumLane = HostPhilox::kNumLane;
+    // elements per task, a multiple of the lanes so that no counter is split across tasks
+    constexpr std::size_t kChunk = 4096;
+
+    const HostPhilox philox(seed);
+
+    if constexpr(std::is_base_of_v<std::random_access_iterator_tag, Category>)
+    {
+        const auto n = static_cast<std::size_t>(std::distance(first, last));
+
+        HostThreadPool::instance().parallel_for(
+            (n + kChunk - 1) / kChunk,
+            [&](std::size_t chunk_begin, std::size_t chunk_end) {
+                std::uint32_t bits[kChunk];
+
+                for(std::size_t chunk = chunk_begin; chunk < chunk_end; ++chunk)
+                {
+                    const std::size_t begin = chunk * kChunk;
+                    const std::size_t len   = std::min(kChunk, n - begin);
+
+                    philox.generate(begin / kNumLane, (len + kNumLane - 1) / kNumLane, bits);
+
+                    auto it = first + static_cast<std::ptrdiff_t>(begin);
+                    for(std::size_t i = 0; i < len; ++i, ++it)
+                        *it = f(bits[i]);
+                }
+            },
+            max_thread);
+    }
+    else
+    {
+        std::array<std::uint32_t, kNumLane> bits{};
+        std::uint64_t i = 0;
+
+        for(; first != last; ++first, ++i)
+        {
+            if(i % kNumLane == 0)
+                bits = philox(i / kNumLane);
+
+            *first = f(bits[i % kNumLane]);
+        }
+    }
+}
+
+} // namespace ck_tile
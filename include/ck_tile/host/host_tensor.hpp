@@ -13,6 +13,8 @@
 #include <vector>
 
 #include "ck_tile/core.hpp"
+#include "ck_tile/host/host_allocator.hpp"
+#include "ck_tile/host/host_thread_pool.hpp"
 #include "ck_tile/host/ranges.hpp"
 
 namespace ck_tile {
@@ -261,25 +263,17 @@ struct ParallelTensorFunctor
         return indices;
     }
 
+    // runs on the process-wide HostThreadPool with at most num_thread threads
     void operator()(std::size_t num_thread = 1) const
     {
-        std::size_t work_per_thread = (mN1d + num_thread - 1) / num_thread;
+        auto f = [this](std::size_t iw_begin, std::size_t iw_end) {
+            for(std::size_t iw = iw_begin; iw < iw_end; ++iw)
+            {
+                call_f_unpack_args(this->mF, this->GetNdIndices(iw));
+            }
+        };
 
-        std::vector<joinable_thread> threads(num_thread);
-
-        for(std::size_t it = 0; it < num_thread; ++it)
-        {
-            std::size_t iw_begin = it * work_per_thread;
-            std::size_t iw_end   = std::min((it + 1) * work_per_thread, mN1d);
-
-            auto f = [this, iw_begin, iw_end] {
-                for(std::size_t iw = iw_begin; iw < iw_end; ++iw)
-                {
-                    call_f_unpack_args(this->mF, this->GetNdIndices(iw));
-                }
-            };
-            threads[it] = joinable_thread(f);
-        }
+        HostThreadPool::instance().parallel_for(mN1d, f, num_thread);
     }
 };
 
@@ -293,7 +287,7 @@ template <typename T>
 struct HostTensor
 {
     using Descriptor = HostTensorDescriptor;
-    using Data       = std::vector<T>;
+    using Data       = std::vector<T, HostAllocator<T>>;
 
     template <typename X>
     HostTensor(std::initializer_list<X> lens) : mDesc(lens), mData(mDesc.get_element_space_size())
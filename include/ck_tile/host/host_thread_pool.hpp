@@ -0,0 +1,270 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// This header only depends on the standard library, so that the host utilities of both
+// ck_tile and the ck library can share one process-wide pool.
+
+namespace ck_tile {
+
+// Persistent pool of host worker threads behind ParallelTensorFunctor and the CPU references.
+//
+// A parallel_for() call splits [0, n) into chunks and hands every participating thread (the
+// caller included) a contiguous run of chunks. A thread that drains its own run steals the
+// back half of the largest remaining run of another thread, so uneven work is balanced
+// without a central queue. Calls issued from inside a pool task run inline on the calling
+// thread, which keeps nested ParallelTensorFunctors deadlock-free.
+struct HostThreadPool
+{
+    static HostThreadPool& instance()
+    {
+        static HostThreadPool pool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+        return pool;
+    }
+
+    explicit HostThreadPool(std::size_t num_worker) : slots_(num_worker + 1)
+    {
+        workers_.reserve(num_worker);
+        for(std::size_t i = 0; i < num_worker; ++i)
+            workers_.emplace_back([this, i] { worker_loop(i + 1); });
+    }
+
+    HostThreadPool(const HostThreadPool&) = delete;
+    HostThreadPool& operator=(const HostThreadPool&) = delete;
+
+    ~HostThreadPool()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        wake_cv_.notify_all();
+
+        for(auto& worker : workers_)
+            worker.join();
+    }
+
+    // number of threads a parallel_for() can run on, the caller included
+    std::size_t size() const { return workers_.size() + 1; }
+
+    // call f(begin, end) on disjoint chunks covering [0, n), using at most max_thread threads
+    template <typename F>
+    void parallel_for(std::size_t n, F&& f, std::size_t max_thread = 0, std::size_t grain = 1)
+    {
+        if(n == 0)
+            return;
+
+        grain = std::max<std::size_t>(grain, 1);
+
+        std::size_t num_thread = max_thread == 0 ? size() : std::min(max_thread, size());
+        num_thread             = std::min(num_thread, (n + grain - 1) / grain);
+
+        if(num_thread <= 1 || in_pool_task())
+        {
+            f(std::size_t{0}, n);
+            return;
+        }
+
+        // a few chunks per thread leave room for stealing without fragmenting the range
+        const std::size_t num_chunk = num_thread * kChunksPerThread;
+        const std::size_t chunk     = std::max(grain, (n + num_chunk - 1) / num_chunk);
+
+        auto call = [](const void* p_f, std::size_t begin, std::size_t end) {
+            (*static_cast<std::remove_reference_t<F>*>(const_cast<void*>(p_f)))(begin, end);
+        };
+
+        run(Job{call, static_cast<const void*>(std::addressof(f)), n, chunk}, num_thread);
+    }
+
+    private:
+    static constexpr std::size_t kChunksPerThread = 8;
+
+    struct Job
+    {
+        void (*call)(const void*, std::size_t, std::size_t);
+        const void* p_f;
+        std::size_t n;
+        std::size_t chunk;
+    };
+
+    // run of chunk indices [begin, end) owned by one thread
+    struct alignas(64) Slot
+    {
+        std::mutex mutex;
+        std::size_t begin = 0;
+        std::size_t end   = 0;
+    };
+
+    static bool& in_pool_task()
+    {
+        static thread_local bool flag = false;
+        return flag;
+    }
+
+    void run(const Job& job, std::size_t num_thread)
+    {
+        // one job at a time; concurrent external callers queue up here
+        std::lock_guard<std::mutex> submit_lock(submit_mutex_);
+
+        const std::size_t num_chunk = (job.n + job.chunk - 1) / job.chunk;
+
+        for(std::size_t i = 0; i < num_thread; ++i)
+        {
+            slots_[i].begin = num_chunk * i / num_thread;
+            slots_[i].end   = num_chunk * (i + 1) / num_thread;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            job_        = job;
+            num_active_ = num_thread;
+            num_busy_   = num_thread - 1;
+            error_      = nullptr;
+            ++generation_;
+        }
+        wake_cv_.notify_all();
+
+        execute(0);
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        done_cv_.wait(lock, [this] { return num_busy_ == 0; });
+
+        if(error_)
+            std::rethrow_exception(std::exchange(error_, nullptr));
+    }
+
+    void worker_loop(std::size_t slot)
+    {
+        std::size_t seen_generation = 0;
+
+        for(;;)
+        {
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wake_cv_.wait(lock, [&] {
+                    return stop_ || (generation_ != seen_generation && slot < num_active_);
+                });
+
+                if(stop_)
+                    return;
+
+                seen_generation = generation_;
+            }
+
+            execute(slot);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if(--num_busy_ == 0)
+                    done_cv_.notify_one();
+            }
+        }
+    }
+
+    void execute(std::size_t slot)
+    {
+        in_pool_task() = true;
+
+        std::size_t chunk_id;
+        while(pop_or_steal(slot, chunk_id))
+        {
+            const std::size_t begin = chunk_id * job_.chunk;
+            const std::size_t end   = std::min(begin + job_.chunk, job_.n);
+
+            try
+            {
+                job_.call(job_.p_f, begin, end);
+            }
+            catch(...)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if(!error_)
+                    error_ = std::current_exception();
+            }
+        }
+
+        in_pool_task() = false;
+    }
+
+    bool pop_or_steal(std::size_t slot, std::size_t& chunk_id)
+    {
+        {
+            Slot& own = slots_[slot];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            if(own.begin < own.end)
+            {
+                chunk_id = own.begin++;
+                return true;
+            }
+        }
+
+        for(;;)
+        {
+            // steal from the thread with the most chunks left
+            std::size_t victim    = slot;
+            std::size_t remaining = 0;
+            for(std::size_t i = 0; i < num_active_; ++i)
+            {
+                Slot& other = slots_[i];
+                std::lock_guard<std::mutex> lock(other.mutex);
+                if(other.end - other.begin > remaining)
+                {
+                    victim    = i;
+                    remaining = other.end - other.begin;
+                }
+            }
+
+            if(remaining == 0)
+                return false;
+
+            std::size_t stolen_begin;
+            std::size_t stolen_end;
+            {
+                Slot& other = slots_[victim];
+                std::lock_guard<std::mutex> lock(other.mutex);
+                if(other.begin >= other.end)
+                    continue;
+
+                stolen_end   = other.end;
+                stolen_begin = other.end - (other.end - other.begin + 1) / 2;
+                other.end    = stolen_begin;
+            }
+
+            Slot& own = slots_[slot];
+            std::lock_guard<std::mutex> lock(own.mutex);
+            own.begin = stolen_begin + 1;
+            own.end   = stolen_end;
+            chunk_id  = stolen_begin;
+            return true;
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::vector<Slot> slots_;
+
+    std::mutex submit_mutex_;
+    std::mutex mutex_;
+    std::condition_variable wake_cv_;
+    std::condition_variable done_cv_;
+
+    Job job_{};
+    std::size_t generation_ = 0;
+    std::size_t num_active_ = 0;
+    std::size_t num_busy_   = 0;
+    std::exception_ptr error_;
+    bool stop_ = false;
+};
+
+} // namespace ck_tile
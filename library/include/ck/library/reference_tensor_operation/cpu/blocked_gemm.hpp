@@ -0,0 +1,444 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ck/utility/data_type.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+namespace cpu {
+
+// Cache-blocked float GEMM used by the CPU reference operators.
+//
+// A and B are packed into MR-row / NR-column panels through user supplied loaders. B is packed
+// once, or with blocked_batched_gemm_streamed() like A; A is packed one MC x KC block at a time
+// inside the C tile that uses it, so an implicit operand like the im2col matrix of a convolution
+// is never materialized beyond a block. The loaders are therefore called more than once for an
+// element and must not have side effects. The C micro-tile (MR x NR) is kept in vector
+// registers, a KC x NR panel of B stays in L1 and the MC x KC block of A in L2. Every C element
+// accumulates its products in increasing k order with a separate multiply and add, which keeps
+// the result bit-identical to a scalar k loop.
+struct BlockedGemmConfig
+{
+    static constexpr std::size_t MR = 6;
+    static constexpr std::size_t NR = 16;
+    static constexpr std::size_t KC = 256;
+    static constexpr std::size_t MC = 16 * MR;
+    static constexpr std::size_t NC = 16 * NR;
+};
+
+// operand types that convert exactly into the float accumulator of the blocked GEMM
+template <typename T>
+inline constexpr bool is_blocked_gemm_operand_v =
+    is_same_v<T, float> || is_same_v<T, half_t> || is_same_v<T, bhalf_t> || is_same_v<T, int8_t>;
+
+namespace detail {
+
+// GCC has no per-block equivalent of the clang pragma below and would fuse the micro-kernel
+// into FMAs where the target ISA has them
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC push_options
+#pragma GCC optimize("fp-contract=off")
+#endif
+
+template <std::size_t MR>
+[[gnu::always_inline]] inline void blocked_gemm_micro_kernel_impl(std::size_t kc,
+                                                                  const float* __restrict a,
+                                                                  const float* __restrict b,
+                                                                  float* __restrict c,
+                                                                  std::size_t ldc)
+{
+#ifdef __clang__
+#pragma clang fp contract(off)
+#endif
+    // one row of the C micro-tile, lowered to zmm/ymm/xmm registers by the target ISA
+    typedef float row_t __attribute__((vector_size(BlockedGemmConfig::NR * sizeof(float))));
+
+    row_t acc[MR];
+
+    for(std::size_t r = 0; r < MR; ++r)
+        __builtin_memcpy(&acc[r], c + r * ldc, sizeof(row_t));
+
+    for(std::size_t k = 0; k < kc; ++k)
+    {
+        row_t b_k;
+        __builtin_memcpy(&b_k, b + k * BlockedGemmConfig::NR, sizeof(row_t));
+
+        for(std::size_t r = 0; r < MR; ++r)
+        {
+            // keep multiply and add separate so that no FMA changes the rounding
+            const row_t p = a[k * MR + r] * b_k;
+            acc[r] += p;
+        }
+    }
+
+    for(std::size_t r = 0; r < MR; ++r)
+        __builtin_memcpy(c + r * ldc, &acc[r], sizeof(row_t));
+}
+
+using blocked_gemm_micro_kernel_t =
+    void (*)(std::size_t, const float*, const float*, float*, std::size_t);
+
+inline void blocked_gemm_micro_kernel_generic(
+    std::size_t kc, const float* a, const float* b, float* c, std::size_t ldc)
+{
+    blocked_gemm_micro_kernel_impl<BlockedGemmConfig::MR>(kc, a, b, c, ldc);
+}
+
+#if defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__)
+__attribute__((target("avx2"))) inline void blocked_gemm_micro_kernel_avx2(
+    std::size_t kc, const float* a, const float* b, float* c, std::size_t ldc)
+{
+    blocked_gemm_micro_kernel_impl<BlockedGemmConfig::MR>(kc, a, b, c, ldc);
+}
+
+__attribute__((target("avx512f"))) inline void blocked_gemm_micro_kernel_avx512(
+    std::size_t kc, const float* a, const float* b, float* c, std::size_t ldc)
+{
+    blocked_gemm_micro_kernel_impl<BlockedGemmConfig::MR>(kc, a, b, c, ldc);
+}
+#endif
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC pop_options
+#endif
+
+// pick the widest micro-kernel the running CPU supports
+inline blocked_gemm_micro_kernel_t get_blocked_gemm_micro_kernel()
+{
+    static const blocked_gemm_micro_kernel_t kernel = [] {
+#if defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__)
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx512f"))
+            return &blocked_gemm_micro_kernel_avx512;
+        if(__builtin_cpu_supports("avx2"))
+            return &blocked_gemm_micro_kernel_avx2;
+#endif
+        return &blocked_gemm_micro_kernel_generic;
+    }();
+
+    return kernel;
+}
+
+// pack rows [row_begin, row_begin + num_row) and k [k_begin, k_begin + k_len) of an operand
+// into MR-row panels, k-major inside a panel:
+//   packed[(panel * k_len + k) * MR + r] = load(row_begin + panel * MR + r, k_begin + k)
+// zero padded past num_row
+template <std::size_t MR, typename Load>
+void pack_panel_block(float* packed,
+                      std::size_t row_begin,
+                      std::size_t num_row,
+                      std::size_t k_begin,
+                      std::size_t k_len,
+                      Load&& load)
+{
+    const std::size_t num_panel = (num_row + MR - 1) / MR;
+
+    for(std::size_t panel = 0; panel < num_panel; ++panel)
+    {
+        float* p = packed + panel * k_len * MR;
+
+        const std::size_t r_end = std::min(MR, num_row - panel * MR);
+
+        for(std::size_t k = 0; k < k_len; ++k)
+        {
+            for(std::size_t r = 0; r < MR; ++r)
+            {
+                const std::size_t row = row_begin + panel * MR + r;
+
+                p[k * MR + r] = r < r_end ? static_cast<float>(load(row, k_begin + k)) : 0.f;
+            }
+        }
+    }
+}
+
+// pack rows [0, M) of the (M x K) operand of every batch into MR-row panels, k-major inside a
+// panel:
+//   packed[((g * num_panel + panel) * K + k) * MR + r] = load(g, panel * MR + r, k)
+// zero padded past M
+template <std::size_t MR, typename Load>
+std::vector<float>
+pack_panels(std::size_t G, std::size_t M, std::size_t K, Load&& load, std::size_t num_thread)
+{
+    const std::size_t num_panel = (M + MR - 1) / MR;
+
+    std::vector<float> packed(G * num_panel * K * MR);
+
+    auto f_pack = [&](std::size_t g, std::size_t panel) {
+        pack_panel_block<MR>(packed.data() + (g * num_panel + panel) * K * MR,
+                             panel * MR,
+                             std::min(MR, M - panel * MR),
+                             0,
+                             K,
+                             [&](std::size_t row, std::size_t k) { return load(g, row, k); });
+    };
+
+    make_ParallelTensorFunctor(f_pack, G, num_panel)(num_thread);
+
+    return packed;
+}
+
+// The tile loop of the blocked GEMM: the MC x NC tiles of all G batches are distributed over
+// the threads together, A is packed one MC x KC block at a time inside the tile, and
+// get_b_block(g, n_begin, n_len, k_begin, k_len, buffer) returns the NR-column panels of the
+// KC x NC block of B as a pointer to the first panel and the distance between panels; buffer
+// is a per-tile scratch vector for B operands that are packed on the fly.
+template <typename LoadA, typename GetBBlock, typename StoreC>
+void blocked_batched_gemm_tiles(std::size_t G,
+                                std::size_t M,
+                                std::size_t N,
+                                std::size_t K,
+                                LoadA&& load_a,
+                                GetBBlock&& get_b_block,
+                                StoreC&& store_c,
+                                std::size_t num_thread)
+{
+    using Config = BlockedGemmConfig;
+
+    constexpr std::size_t MR = Config::MR;
+    constexpr std::size_t NR = Config::NR;
+
+    if(G == 0 || M == 0 || N == 0)
+        return;
+
+    num_thread = std::max<std::size_t>(num_thread, 1);
+
+    const auto micro_kernel = get_blocked_gemm_micro_kernel();
+
+    const std::size_t num_tile_m = (M + Config::MC - 1) / Config::MC;
+    const std::size_t num_tile_n = (N + Config::NC - 1) / Config::NC;
+
+    auto f_tile = [&](std::size_t g, std::size_t tile_m, std::size_t tile_n) {
+        const std::size_t m_begin = tile_m * Config::MC;
+        const std::size_t n_begin = tile_n * Config::NC;
+        const std::size_t m_len   = std::min(Config::MC, M - m_begin);
+        const std::size_t n_len   = std::min(Config::NC, N - n_begin);
+
+        const std::size_t num_panel_m = (m_len + MR - 1) / MR;
+        const std::size_t num_panel_n = (n_len + NR - 1) / NR;
+
+        const std::size_t ldc = num_panel_n * NR;
+
+        std::vector<float> acc(num_panel_m * MR * ldc, 0.f);
+        std::vector<float> a_block(num_panel_m * MR * std::min(Config::KC, K));
+        std::vector<float> b_buffer;
+
+        for(std::size_t k_begin = 0; k_begin < K; k_begin += Config::KC)
+        {
+            const std::size_t k_len = std::min(Config::KC, K - k_begin);
+
+            pack_panel_block<MR>(a_block.data(),
+                                 m_begin,
+                                 m_len,
+                                 k_begin,
+                                 k_len,
+                                 [&](std::size_t m, std::size_t k) { return load_a(g, m, k); });
+
+            const auto [b_block, b_panel_stride] =
+                get_b_block(g, n_begin, n_len, k_begin, k_len, b_buffer);
+
+            for(std::size_t pn = 0; pn < num_panel_n; ++pn)
+            {
+                const float* b_panel = b_block + pn * b_panel_stride;
+
+                for(std::size_t pm = 0; pm < num_panel_m; ++pm)
+                {
+                    const float* a_panel = a_block.data() + pm * k_len * MR;
+
+                    micro_kernel(
+                        k_len, a_panel, b_panel, acc.data() + pm * MR * ldc + pn * NR, ldc);
+                }
+            }
+        }
+
+        for(std::size_t i = 0; i < m_len; ++i)
+            for(std::size_t j = 0; j < n_len; ++j)
+                store_c(g, m_begin + i, n_begin + j, acc[i * ldc + j]);
+    };
+
+    make_ParallelTensorFunctor(f_tile, G, num_tile_m, num_tile_n)(num_thread);
+}
+
+} // namespace detail
+
+// B operand of the blocked GEMM, packed once into NR-column panels for all of its GB batches:
+//   load_b(gb, k, n) returns the (already element-op transformed) operand as float
+// Batched GEMMs whose batches share a B, e.g. the heads of a query group, pack every distinct
+// B once and pass it to blocked_batched_gemm() with a map from batch to B batch.
+class BlockedGemmPackedB
+{
+    public:
+    template <typename LoadB>
+    BlockedGemmPackedB(std::size_t GB,
+                       std::size_t N,
+                       std::size_t K,
+                       LoadB&& load_b,
+                       std::size_t num_thread = std::thread::hardware_concurrency())
+        : num_batch_(GB), N_(N), K_(K)
+    {
+        data_ = detail::pack_panels<BlockedGemmConfig::NR>(
+            GB,
+            N,
+            K,
+            [&](std::size_t gb, std::size_t n, std::size_t k) { return load_b(gb, k, n); },
+            std::max<std::size_t>(num_thread, 1));
+    }
+
+    std::size_t GetNumBatch() const { return num_batch_; }
+
+    std::size_t GetN() const { return N_; }
+
+    std::size_t GetK() const { return K_; }
+
+    // panel of NR columns starting at column panel * NR of batch gb, k-major
+    const float* GetPanel(std::size_t gb, std::size_t panel) const
+    {
+        const std::size_t num_panel = (N_ + BlockedGemmConfig::NR - 1) / BlockedGemmConfig::NR;
+
+        return data_.data() + (gb * num_panel + panel) * K_ * BlockedGemmConfig::NR;
+    }
+
+    private:
+    std::size_t num_batch_;
+    std::size_t N_;
+    std::size_t K_;
+    std::vector<float> data_;
+};
+
+// C[g, m, n] = sum_k A[g, m, k] * B[b_batch(g), k, n] for the G batches of a batched GEMM
+//   load_a(g, m, k) returns the (already element-op transformed) operand as float, store_c(g,
+//   m, n, acc) receives the float accumulator of every output element once. The MC x NC tiles
+//   of all batches are distributed over the threads together, so many small batches keep every
+//   thread busy as well as a few large ones. Besides the packed B, every thread only holds one
+//   MC x KC block of A and its MC x NC accumulators.
+template <typename BBatch, typename LoadA, typename StoreC>
+void blocked_batched_gemm(std::size_t G,
+                          std::size_t M,
+                          const BlockedGemmPackedB& b,
+                          BBatch&& b_batch,
+                          LoadA&& load_a,
+                          StoreC&& store_c,
+                          std::size_t num_thread = std::thread::hardware_concurrency())
+{
+    constexpr std::size_t NR = BlockedGemmConfig::NR;
+
+    detail::blocked_batched_gemm_tiles(
+        G,
+        M,
+        b.GetN(),
+        b.GetK(),
+        load_a,
+        [&](std::size_t g,
+            std::size_t n_begin,
+            std::size_t,
+            std::size_t k_begin,
+            std::size_t,
+            std::vector<float>&) {
+            return std::make_pair(b.GetPanel(b_batch(g), n_begin / NR) + k_begin * NR,
+                                  b.GetK() * NR);
+        },
+        store_c,
+        num_thread);
+}
+
+// Like blocked_batched_gemm(), but B is packed one KC x NC block at a time inside the tile
+// that uses it, like A. For implicit B operands that are much larger than the data they are
+// loaded from, e.g. the im2col matrix of a convolution: a block of B is loaded again for every
+// MC rows of C, but the whole of B is never materialized.
+template <typename LoadA, typename LoadB, typename StoreC>
+void blocked_batched_gemm_streamed(std::size_t G,
+                                   std::size_t M,
+                                   std::size_t N,
+                                   std::size_t K,
+                                   LoadA&& load_a,
+                                   LoadB&& load_b,
+                                   StoreC&& store_c,
+                                   std::size_t num_thread = std::thread::hardware_concurrency())
+{
+    constexpr std::size_t NR = BlockedGemmConfig::NR;
+
+    detail::blocked_batched_gemm_tiles(
+        G,
+        M,
+        N,
+        K,
+        load_a,
+        [&](std::size_t g,
+            std::size_t n_begin,
+            std::size_t n_len,
+            std::size_t k_begin,
+            std::size_t k_len,
+            std::vector<float>& buffer) {
+            buffer.resize((n_len + NR - 1) / NR * NR * k_len);
+
+            detail::pack_panel_block<NR>(
+                buffer.data(), n_begin, n_len, k_begin, k_len, [&](std::size_t n, std::size_t k) {
+                    return load_b(g, k, n);
+                });
+
+            return std::make_pair(static_cast<const float*>(buffer.data()), k_len * NR);
+        },
+        store_c,
+        num_thread);
+}
+
+// C[g, m, n] = sum_k A[g, m, k] * B[g, k, n] for the G batches of a batched GEMM
+//   load_a(g, m, k) and load_b(g, k, n) return the (already element-op transformed) operands
+//   as float, store_c(g, m, n, acc) receives the float accumulator of every output element
+//   once. B is packed once for all batches.
+template <typename LoadA, typename LoadB, typename StoreC>
+void blocked_batched_gemm(std::size_t G,
+                          std::size_t M,
+                          std::size_t N,
+                          std::size_t K,
+                          LoadA&& load_a,
+                          LoadB&& load_b,
+                          StoreC&& store_c,
+                          std::size_t num_thread = std::thread::hardware_concurrency())
+{
+    if(G == 0 || M == 0 || N == 0)
+        return;
+
+    const BlockedGemmPackedB b(G, N, K, load_b, num_thread);
+
+    blocked_batched_gemm(
+        G, M, b, [](std::size_t g) { return g; }, load_a, store_c, num_thread);
+}
+
+// C[m, n] = sum_k A[m, k] * B[k, n]
+//   load_a(m, k) and load_b(k, n) return the (already element-op transformed) operands as
+//   float, store_c(m, n, acc) receives the float accumulator of every output element once.
+template <typename LoadA, typename LoadB, typename StoreC>
+void blocked_gemm(std::size_t M,
+                  std::size_t N,
+                  std::size_t K,
+                  LoadA&& load_a,
+                  LoadB&& load_b,
+                  StoreC&& store_c,
+                  std::size_t num_thread = std::thread::hardware_concurrency())
+{
+    blocked_batched_gemm(
+        1,
+        M,
+        N,
+        K,
+        [&](std::size_t, std::size_t m, std::size_t k) { return load_a(m, k); },
+        [&](std::size_t, std::size_t k, std::size_t n) { return load_b(k, n); },
+        [&](std::size_t, std::size_t m, std::size_t n, float acc) { store_c(m, n, acc); },
+        num_thread);
+}
+
+} // namespace cpu
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ck/utility/data_type.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+namespace cpu {
+
+// Offsets of the implicit im2col matrix of a convolution, shared by the GEMM-lowered CPU
+// convolution references.
+//
+// Row (n, o...) is an output pixel of an image, column (c, f...) a filter tap of an input
+// channel; both are numbered in row-major order. Element (row, col) is the input element
+//   in[n, c, o * stride + f * dilation - left_pad]
+// or a padded zero. Lengths and strides are those of the [G, N, C, Di, Hi, Wi] input,
+// [G, K, C, Z, Y, X] weight and [G, N, K, Do, Ho, Wo] output descriptors; offsets do not
+// include the group.
+template <std::size_t NDimSpatial>
+struct ConvIm2colTable
+{
+    ConvIm2colTable(const std::vector<std::size_t>& in_lengths,
+                    const std::vector<std::size_t>& in_strides,
+                    const std::vector<std::size_t>& wei_lengths,
+                    const std::vector<std::size_t>& wei_strides,
+                    const std::vector<std::size_t>& out_lengths,
+                    const std::vector<std::size_t>& out_strides,
+                    const std::vector<long_index_t>& conv_strides,
+                    const std::vector<long_index_t>& conv_dilations,
+                    const std::vector<long_index_t>& in_left_pads)
+        : in_spatial_lengths_(in_lengths.begin() + 3, in_lengths.end()),
+          in_spatial_strides_(in_strides.begin() + 3, in_strides.end()),
+          max_tap_(NDimSpatial)
+    {
+        std::size_t num_output_pixel = 1;
+        std::size_t num_filter_tap   = 1;
+        for(std::size_t d = 0; d < NDimSpatial; ++d)
+        {
+            num_output_pixel *= out_lengths[3 + d];
+            num_filter_tap *= wei_lengths[3 + d];
+
+            max_tap_[d] = static_cast<long_index_t>(wei_lengths[3 + d] - 1) * conv_dilations[d];
+        }
+
+        num_row_ = out_lengths[1] * num_output_pixel;
+        num_col_ = wei_lengths[2] * num_filter_tap;
+
+        row_in_offset_.resize(num_row_);
+        row_out_offset_.resize(num_row_);
+        row_in_begin_.resize(num_row_ * NDimSpatial);
+
+        col_in_offset_.resize(num_col_);
+        col_wei_offset_.resize(num_col_);
+        col_tap_.resize(num_col_ * NDimSpatial);
+
+        for(std::size_t row = 0; row < num_row_; ++row)
+        {
+            std::size_t rest       = row;
+            std::size_t out_offset = 0;
+            for(std::size_t d = NDimSpatial; d-- > 0;)
+            {
+                const std::size_t o = rest % out_lengths[3 + d];
+                rest /= out_lengths[3 + d];
+
+                out_offset += o * out_strides[3 + d];
+                row_in_begin_[row * NDimSpatial + d] =
+                    static_cast<long_index_t>(o) * conv_strides[d] - in_left_pads[d];
+            }
+
+            row_in_offset_[row]  = rest * in_strides[1];
+            row_out_offset_[row] = rest * out_strides[1] + out_offset;
+        }
+
+        for(std::size_t col = 0; col < num_col_; ++col)
+        {
+            std::size_t rest       = col;
+            std::size_t wei_offset = 0;
+            for(std::size_t d = NDimSpatial; d-- > 0;)
+            {
+                const std::size_t f = rest % wei_lengths[3 + d];
+                rest /= wei_lengths[3 + d];
+
+                wei_offset += f * wei_strides[3 + d];
+                col_tap_[col * NDimSpatial + d] = static_cast<long_index_t>(f) * conv_dilations[d];
+            }
+
+            col_in_offset_[col]  = rest * in_strides[2];
+            col_wei_offset_[col] = rest * wei_strides[2] + wei_offset;
+        }
+    }
+
+    std::size_t GetNumRow() const { return num_row_; }
+
+    std::size_t GetNumCol() const { return num_col_; }
+
+    // output offset of the pixel of row, without the output channel
+    std::size_t GetOutputOffset(std::size_t row) const { return row_out_offset_[row]; }
+
+    // weight offset of the tap of col, without the output channel
+    std::size_t GetWeightOffset(std::size_t col) const { return col_wei_offset_[col]; }
+
+    // whether some tap of the window of row reads the padding
+    bool HasPaddedTap(std::size_t row) const
+    {
+        for(std::size_t d = 0; d < NDimSpatial; ++d)
+        {
+            const long_index_t i = row_in_begin_[row * NDimSpatial + d];
+            if(i < 0 || static_cast<std::size_t>(i + max_tap_[d]) >= in_spatial_lengths_[d])
+                return true;
+        }
+
+        return false;
+    }
+
+    // input offset of element (row, col) in offset; false for a padded tap
+    bool GetInputOffset(std::size_t row, std::size_t col, std::size_t& offset) const
+    {
+        offset = row_in_offset_[row] + col_in_offset_[col];
+        for(std::size_t d = 0; d < NDimSpatial; ++d)
+        {
+            const long_index_t i =
+                row_in_begin_[row * NDimSpatial + d] + col_tap_[col * NDimSpatial + d];
+            if(i < 0 || static_cast<std::size_t>(i) >= in_spatial_lengths_[d])
+                return false;
+
+            offset += static_cast<std::size_t>(i) * in_spatial_strides_[d];
+        }
+
+        return true;
+    }
+
+    private:
+    std::vector<std::size_t> in_spatial_lengths_;
+    std::vector<std::size_t> in_spatial_strides_;
+
+    // largest dilated filter tap of every spatial dimension
+    std::vector<long_index_t> max_tap_;
+
+    std::size_t num_row_;
+    std::size_t num_col_;
+
+    // row (n, o...): input offset of n, first input coordinate of every window and output
+    // offset
+    std::vector<std::size_t> row_in_offset_;
+    std::vector<std::size_t> row_out_offset_;
+    std::vector<long_index_t> row_in_begin_;
+
+    // column (c, f...): input and weight offsets of c and f, dilated filter taps
+    std::vector<std::size_t> col_in_offset_;
+    std::vector<std::size_t> col_wei_offset_;
+    std::vector<long_index_t> col_tap_;
+};
+
+} // namespace cpu
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,519 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+#include "ck/utility/data_type.hpp"
+#include "ck/utility/math_v2.hpp"
+#include "ck/utility/type_convert.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck_tile/host/host_thread_pool.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace host {
+namespace cpu {
+
+// Parallel engine of the layernorm and groupnorm references, forward and backward.
+//
+// A normalization of x is viewed as rows over the outer (invariant) dims, each normalized over
+// the elements of its inner (reduce) dims. Every other tensor is addressed in the shape of x with
+// zero strides along the dims it is broadcast in, e.g. gamma of groupnorm [G, C] in x [N, H, W,
+// G, C], and the offsets of all rows and row elements are tabulated once. Rows are processed in
+// fixed chunks of elements on the host thread pool, and the partial results of a row are merged
+// in chunk order, so the results do not depend on the number of threads.
+struct NormalizationConfig
+{
+    // row elements per task
+    static constexpr std::size_t kChunk = 1 << 14;
+    // values gathered per Welford block, and independent accumulators within a block
+    static constexpr std::size_t kBlock = 256;
+    static constexpr std::size_t kLane  = 8;
+};
+
+// Offsets of the elements of a tensor in the shape of x; element i of row r is at
+// rows_[r] + elements_[i]. Rows and row elements are in row-major order of their dims.
+struct NormalizationOffsets
+{
+    std::vector<std::size_t> rows_;
+    std::vector<std::size_t> elements_;
+};
+
+// strides of a tensor in the shape of x, whose dim d is dim x_dims[d] of x
+inline std::vector<std::size_t> get_normalization_strides(const HostTensorDescriptor& desc,
+                                                          std::size_t x_rank,
+                                                          const std::vector<std::size_t>& x_dims)
+{
+    std::vector<std::size_t> strides(x_rank, 0);
+    for(std::size_t d = 0; d < x_dims.size(); ++d)
+        strides[x_dims[d]] = desc.GetStrides()[d];
+    return strides;
+}
+
+// offsets of all indices of the given dims in row-major order
+inline std::vector<std::size_t> get_normalization_offsets(const std::vector<std::size_t>& lengths,
+                                                          const std::vector<std::size_t>& strides,
+                                                          const std::vector<std::size_t>& dims)
+{
+    std::size_t size = 1;
+    for(std::size_t dim : dims)
+        size *= lengths[dim];
+
+    std::vector<std::size_t> offsets(size);
+    for(std::size_t i = 0; i < size; ++i)
+    {
+        std::size_t rest   = i;
+        std::size_t offset = 0;
+        for(auto dim = dims.rbegin(); dim != dims.rend(); ++dim)
+        {
+            offset += (rest % lengths[*dim]) * strides[*dim];
+            rest /= lengths[*dim];
+        }
+        offsets[i] = offset;
+    }
+
+    return offsets;
+}
+
+inline NormalizationOffsets make_normalization_offsets(const std::vector<std::size_t>& lengths,
+                                                       const std::vector<std::size_t>& strides,
+                                                       const std::vector<std::size_t>& outer_dims,
+                                                       const std::vector<std::size_t>& inner_dims)
+{
+    return {get_normalization_offsets(lengths, strides, outer_dims),
+            get_normalization_offsets(lengths, strides, inner_dims)};
+}
+
+// dims of x not in dims, in increasing order
+inline std::vector<std::size_t> get_normalization_complement(std::size_t x_rank,
+                                                             std::vector<std::size_t> dims)
+{
+    std::sort(dims.begin(), dims.end());
+
+    std::vector<std::size_t> complement;
+    for(std::size_t dim = 0; dim < x_rank; ++dim)
+    {
+        if(!std::binary_search(dims.begin(), dims.end(), dim))
+            complement.push_back(dim);
+    }
+    return complement;
+}
+
+// mean and sum of squared deviations of the values seen so far
+template <typename ComputeDataType>
+struct Welford
+{
+    ComputeDataType mean_ = 0;
+    ComputeDataType m2_   = 0;
+    std::size_t count_    = 0;
+
+    // a block is summarized in two passes over independent lanes, which vectorize, and merged
+    void AddBlock(const ComputeDataType* x, std::size_t n)
+    {
+        constexpr std::size_t L = NormalizationConfig::kLane;
+
+        if(n == 0)
+            return;
+
+        ComputeDataType sum[L] = {};
+        for(std::size_t i = 0; i < n / L * L; i += L)
+            for(std::size_t l = 0; l < L; ++l)
+                sum[l] += x[i + l];
+        for(std::size_t i = n / L * L; i < n; ++i)
+            sum[i % L] += x[i];
+
+        ComputeDataType mean = 0;
+        for(std::size_t l = 0; l < L; ++l)
+            mean += sum[l];
+        mean /= static_cast<ComputeDataType>(n);
+
+        ComputeDataType m2[L] = {};
+        for(std::size_t i = 0; i < n / L * L; i += L)
+            for(std::size_t l = 0; l < L; ++l)
+                m2[l] += (x[i + l] - mean) * (x[i + l] - mean);
+        for(std::size_t i = n / L * L; i < n; ++i)
+            m2[i % L] += (x[i] - mean) * (x[i] - mean);
+
+        Welford block;
+        block.mean_  = mean;
+        block.count_ = n;
+        for(std::size_t l = 0; l < L; ++l)
+            block.m2_ += m2[l];
+
+        Merge(block);
+    }
+
+    // Chan et al. combination of two disjoint sets of values
+    void Merge(const Welford& other)
+    {
+        if(other.count_ == 0)
+            return;
+
+        const std::size_t count     = count_ + other.count_;
+        const ComputeDataType delta = other.mean_ - mean_;
+        const ComputeDataType ratio =
+            static_cast<ComputeDataType>(other.count_) / static_cast<ComputeDataType>(count);
+
+        mean_ += delta * ratio;
+        m2_ += other.m2_ + delta * delta * static_cast<ComputeDataType>(count_) * ratio;
+        count_ = count;
+    }
+
+    ComputeDataType GetVariance() const
+    {
+        return count_ == 0 ? ComputeDataType{0} : m2_ / static_cast<ComputeDataType>(count_);
+    }
+};
+
+// two sums of the values seen so far
+template <typename ComputeDataType>
+struct NormalizationSums
+{
+    ComputeDataType first_  = 0;
+    ComputeDataType second_ = 0;
+
+    void Merge(const NormalizationSums& other)
+    {
+        first_ += other.first_;
+        second_ += other.second_;
+    }
+};
+
+// f(row, begin, end) -> Acc for the chunks of every row; the chunk results of a row are merged
+// in order with Acc::Merge into a default constructed Acc
+template <typename Acc, typename F>
+std::vector<Acc> reduce_normalization_rows(std::size_t num_row, std::size_t row_size, F&& f)
+{
+    constexpr std::size_t kChunk = NormalizationConfig::kChunk;
+
+    const std::size_t num_chunk = std::max<std::size_t>((row_size + kChunk - 1) / kChunk, 1);
+
+    auto& pool = ck_tile::HostThreadPool::instance();
+
+    std::vector<Acc> result(num_row);
+
+    if(num_chunk == 1 || num_row >= pool.size())
+    {
+        pool.parallel_for(num_row, [&](std::size_t begin, std::size_t end) {
+            for(std::size_t row = begin; row < end; ++row)
+            {
+                for(std::size_t c = 0; c < num_chunk; ++c)
+                    result[row].Merge(f(row, c * kChunk, std::min((c + 1) * kChunk, row_size)));
+            }
+        });
+
+        return result;
+    }
+
+    std::vector<Acc> partial(num_row * num_chunk);
+
+    pool.parallel_for(num_row * num_chunk, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t t = begin; t < end; ++t)
+        {
+            const std::size_t c = t % num_chunk;
+            partial[t] = f(t / num_chunk, c * kChunk, std::min((c + 1) * kChunk, row_size));
+        }
+    });
+
+    for(std::size_t row = 0; row < num_row; ++row)
+    {
+        for(std::size_t c = 0; c < num_chunk; ++c)
+            result[row].Merge(partial[row * num_chunk + c]);
+    }
+
+    return result;
+}
+
+// f(row, begin, end) for the chunks of every row, in parallel
+template <typename F>
+void for_each_normalization_row(std::size_t num_row, std::size_t row_size, F&& f)
+{
+    constexpr std::size_t kChunk = NormalizationConfig::kChunk;
+
+    const std::size_t num_chunk = std::max<std::size_t>((row_size + kChunk - 1) / kChunk, 1);
+
+    ck_tile::HostThreadPool::instance().parallel_for(
+        num_row * num_chunk, [&](std::size_t begin, std::size_t end) {
+            for(std::size_t t = begin; t < end; ++t)
+            {
+                const std::size_t c = t % num_chunk;
+                f(t / num_chunk, c * kChunk, std::min((c + 1) * kChunk, row_size));
+            }
+        });
+}
+
+// y = y_op((x - mean) * inv_std * gamma + beta) with the mean and variance of x over
+// reduce_dims, computed in one pass per row with Welford; the mean and inv_std of every row are
+// saved. gamma_dims and mean_dims are the dims of x that the dims of gamma/beta and of
+// save_mean/save_inv_std correspond to.
+template <typename ComputeDataType,
+          typename XDataType,
+          typename GammaDataType,
+          typename BetaDataType,
+          typename YDataType,
+          typename SaveMeanInvStdDataType,
+          typename YElementwiseOperation>
+void normalization_forward(const Tensor<XDataType>& x,
+                           const Tensor<GammaDataType>& gamma,
+                           const Tensor<BetaDataType>& beta,
+                           Tensor<YDataType>& y,
+                           Tensor<SaveMeanInvStdDataType>& save_mean,
+                           Tensor<SaveMeanInvStdDataType>& save_inv_std,
+                           YElementwiseOperation y_elementwise_op,
+                           const std::vector<std::size_t>& reduce_dims,
+                           const std::vector<std::size_t>& gamma_dims,
+                           const std::vector<std::size_t>& mean_dims,
+                           ComputeDataType epsilon)
+{
+    const std::size_t rank = x.GetNumOfDimension();
+    const auto& lengths    = x.GetLengths();
+
+    std::vector<std::size_t> inner_dims = reduce_dims;
+    std::sort(inner_dims.begin(), inner_dims.end());
+    const std::vector<std::size_t> outer_dims = get_normalization_complement(rank, inner_dims);
+
+    auto make_offsets = [&](const std::vector<std::size_t>& strides) {
+        return make_normalization_offsets(lengths, strides, outer_dims, inner_dims);
+    };
+    auto make_broadcast_offsets = [&](const HostTensorDescriptor& desc,
+                                      const std::vector<std::size_t>& x_dims) {
+        return make_offsets(get_normalization_strides(desc, rank, x_dims));
+    };
+
+    const auto x_offsets       = make_offsets(x.GetStrides());
+    const auto y_offsets       = make_offsets(y.GetStrides());
+    const auto gamma_offsets   = make_broadcast_offsets(gamma.mDesc, gamma_dims);
+    const auto beta_offsets    = make_broadcast_offsets(beta.mDesc, gamma_dims);
+    const auto mean_offsets    = make_broadcast_offsets(save_mean.mDesc, mean_dims);
+    const auto inv_std_offsets = make_broadcast_offsets(save_inv_std.mDesc, mean_dims);
+
+    const std::size_t num_row  = x_offsets.rows_.size();
+    const std::size_t row_size = x_offsets.elements_.size();
+
+    auto load_x = [&](std::size_t row, std::size_t i) {
+        return ck::type_convert<ComputeDataType>(
+            x.mData[x_offsets.rows_[row] + x_offsets.elements_[i]]);
+    };
+
+    const auto stats = reduce_normalization_rows<Welford<ComputeDataType>>(
+        num_row, row_size, [&](std::size_t row, std::size_t begin, std::size_t end) {
+            Welford<ComputeDataType> welford;
+            ComputeDataType block[NormalizationConfig::kBlock];
+
+            for(std::size_t i = begin; i < end; i += NormalizationConfig::kBlock)
+            {
+                const std::size_t n = std::min(NormalizationConfig::kBlock, end - i);
+                for(std::size_t j = 0; j < n; ++j)
+                    block[j] = load_x(row, i + j);
+                welford.AddBlock(block, n);
+            }
+
+            return welford;
+        });
+
+    std::vector<ComputeDataType> inv_std(num_row);
+    for(std::size_t row = 0; row < num_row; ++row)
+    {
+        inv_std[row] = static_cast<ComputeDataType>(1) /
+                       ck::math::sqrt(stats[row].GetVariance() + epsilon);
+
+        // row elements of the saved statistics all alias one value
+        save_mean.mData[mean_offsets.rows_[row]] =
+            ck::type_convert<SaveMeanInvStdDataType>(stats[row].mean_);
+        save_inv_std.mData[inv_std_offsets.rows_[row]] =
+            ck::type_convert<SaveMeanInvStdDataType>(inv_std[row]);
+    }
+
+    for_each_normalization_row(
+        num_row, row_size, [&](std::size_t row, std::size_t begin, std::size_t end) {
+            const std::size_t gamma_row = gamma_offsets.rows_[row];
+            const std::size_t beta_row  = beta_offsets.rows_[row];
+            const std::size_t y_row     = y_offsets.rows_[row];
+
+            for(std::size_t i = begin; i < end; ++i)
+            {
+                const auto gamma_val = ck::type_convert<ComputeDataType>(
+                    gamma.mData[gamma_row + gamma_offsets.elements_[i]]);
+                const auto beta_val = ck::type_convert<ComputeDataType>(
+                    beta.mData[beta_row + beta_offsets.elements_[i]]);
+
+                ComputeDataType y_val = (load_x(row, i) - stats[row].mean_) * inv_std[row];
+                y_val                 = (y_val * gamma_val) + beta_val;
+                y_elementwise_op(y_val, y_val);
+
+                y.mData[y_row + y_offsets.elements_[i]] = ck::type_convert<YDataType>(y_val);
+            }
+        });
+}
+
+// dx of a normalization over reduce_dims from dy, x, gamma and the saved mean and inv_std:
+//   ds = sum(dy * gamma * x), db = sum(dy * gamma) over a row of size K
+//   b  = (db * mean - ds) * inv_std^3 / K, c = -b * mean - db * inv_std / K
+//   dx = dy * gamma * inv_std + b * x + c
+template <typename ComputeDataType,
+          typename DYDataType,
+          typename XDataType,
+          typename GammaDataType,
+          typename MeanInvStdDataType,
+          typename DXDataType>
+void normalization_backward_data(const Tensor<DYDataType>& dy,
+                                 const Tensor<XDataType>& x,
+                                 const Tensor<GammaDataType>& gamma,
+                                 const Tensor<MeanInvStdDataType>& mean,
+                                 const Tensor<MeanInvStdDataType>& inv_std,
+                                 Tensor<DXDataType>& dx,
+                                 const std::vector<std::size_t>& reduce_dims,
+                                 const std::vector<std::size_t>& gamma_dims,
+                                 const std::vector<std::size_t>& mean_dims)
+{
+    const std::size_t rank = x.GetNumOfDimension();
+    const auto& lengths    = x.GetLengths();
+
+    std::vector<std::size_t> inner_dims = reduce_dims;
+    std::sort(inner_dims.begin(), inner_dims.end());
+    const std::vector<std::size_t> outer_dims = get_normalization_complement(rank, inner_dims);
+
+    auto make_offsets = [&](const std::vector<std::size_t>& strides) {
+        return make_normalization_offsets(lengths, strides, outer_dims, inner_dims);
+    };
+    auto make_broadcast_offsets = [&](const HostTensorDescriptor& desc,
+                                      const std::vector<std::size_t>& x_dims) {
+        return make_offsets(get_normalization_strides(desc, rank, x_dims));
+    };
+
+    const auto dy_offsets      = make_offsets(dy.GetStrides());
+    const auto x_offsets       = make_offsets(x.GetStrides());
+    const auto dx_offsets      = make_offsets(dx.GetStrides());
+    const auto gamma_offsets   = make_broadcast_offsets(gamma.mDesc, gamma_dims);
+    const auto mean_offsets    = make_broadcast_offsets(mean.mDesc, mean_dims);
+    const auto inv_std_offsets = make_broadcast_offsets(inv_std.mDesc, mean_dims);
+
+    const std::size_t num_row  = x_offsets.rows_.size();
+    const std::size_t row_size = x_offsets.elements_.size();
+
+    auto load = [](const auto& tensor, const NormalizationOffsets& offsets, std::size_t row,
+                   std::size_t i) {
+        return ck::type_convert<ComputeDataType>(
+            tensor.mData[offsets.rows_[row] + offsets.elements_[i]]);
+    };
+
+    // ds and db
+    const auto sums = reduce_normalization_rows<NormalizationSums<ComputeDataType>>(
+        num_row, row_size, [&](std::size_t row, std::size_t begin, std::size_t end) {
+            NormalizationSums<ComputeDataType> ds_db;
+            for(std::size_t i = begin; i < end; ++i)
+            {
+                const ComputeDataType dy_gamma =
+                    load(dy, dy_offsets, row, i) * load(gamma, gamma_offsets, row, i);
+
+                ds_db.first_ += dy_gamma * load(x, x_offsets, row, i);
+                ds_db.second_ += dy_gamma;
+            }
+            return ds_db;
+        });
+
+    const auto reduce_size = static_cast<ComputeDataType>(row_size);
+
+    for_each_normalization_row(
+        num_row, row_size, [&](std::size_t row, std::size_t begin, std::size_t end) {
+            const ComputeDataType ds = sums[row].first_;
+            const ComputeDataType db = sums[row].second_;
+
+            const auto mean_val = load(mean, mean_offsets, row, 0);
+            const auto rstd     = load(inv_std, inv_std_offsets, row, 0);
+
+            const ComputeDataType b = (db * mean_val - ds) * rstd * rstd * rstd / reduce_size;
+            const ComputeDataType c = -b * mean_val - db * rstd / reduce_size;
+
+            for(std::size_t i = begin; i < end; ++i)
+            {
+                const ComputeDataType dy_val    = load(dy, dy_offsets, row, i);
+                const ComputeDataType x_val     = load(x, x_offsets, row, i);
+                const ComputeDataType gamma_val = load(gamma, gamma_offsets, row, i);
+
+                dx.mData[dx_offsets.rows_[row] + dx_offsets.elements_[i]] =
+                    ck::type_convert<DXDataType>(dy_val * gamma_val * rstd + b * x_val + c);
+            }
+        });
+}
+
+// dgamma = sum(dy * (x - mean) * inv_std) and dbeta = sum(dy) over all dims of x that gamma is
+// broadcast in; every element of gamma is a row of this reduction
+template <typename ComputeDataType,
+          typename DYDataType,
+          typename XDataType,
+          typename MeanInvStdDataType,
+          typename DGammaDataType,
+          typename DBetaDataType>
+void normalization_backward_gamma_beta(const Tensor<DYDataType>& dy,
+                                       const Tensor<XDataType>& x,
+                                       const Tensor<MeanInvStdDataType>& mean,
+                                       const Tensor<MeanInvStdDataType>& inv_std,
+                                       Tensor<DGammaDataType>& dgamma,
+                                       Tensor<DBetaDataType>& dbeta,
+                                       const std::vector<std::size_t>& gamma_dims,
+                                       const std::vector<std::size_t>& mean_dims)
+{
+    const std::size_t rank = x.GetNumOfDimension();
+    const auto& lengths    = x.GetLengths();
+
+    const std::vector<std::size_t>& outer_dims = gamma_dims;
+    const std::vector<std::size_t> inner_dims  = get_normalization_complement(rank, outer_dims);
+
+    auto make_offsets = [&](const std::vector<std::size_t>& strides) {
+        return make_normalization_offsets(lengths, strides, outer_dims, inner_dims);
+    };
+    auto make_broadcast_offsets = [&](const HostTensorDescriptor& desc,
+                                      const std::vector<std::size_t>& x_dims) {
+        return make_offsets(get_normalization_strides(desc, rank, x_dims));
+    };
+
+    const auto dy_offsets      = make_offsets(dy.GetStrides());
+    const auto x_offsets       = make_offsets(x.GetStrides());
+    const auto mean_offsets    = make_broadcast_offsets(mean.mDesc, mean_dims);
+    const auto inv_std_offsets = make_broadcast_offsets(inv_std.mDesc, mean_dims);
+    const auto dgamma_offsets  = make_broadcast_offsets(dgamma.mDesc, gamma_dims);
+    const auto dbeta_offsets   = make_broadcast_offsets(dbeta.mDesc, gamma_dims);
+
+    const std::size_t num_row  = x_offsets.rows_.size();
+    const std::size_t row_size = x_offsets.elements_.size();
+
+    auto load = [](const auto& tensor, const NormalizationOffsets& offsets, std::size_t row,
+                   std::size_t i) {
+        return ck::type_convert<ComputeDataType>(
+            tensor.mData[offsets.rows_[row] + offsets.elements_[i]]);
+    };
+
+    const auto sums = reduce_normalization_rows<NormalizationSums<ComputeDataType>>(
+        num_row, row_size, [&](std::size_t row, std::size_t begin, std::size_t end) {
+            NormalizationSums<ComputeDataType> dgamma_dbeta;
+            for(std::size_t i = begin; i < end; ++i)
+            {
+                const ComputeDataType dy_val = load(dy, dy_offsets, row, i);
+
+                const ComputeDataType x_val    = load(x, x_offsets, row, i);
+                const ComputeDataType mean_val = load(mean, mean_offsets, row, i);
+                const ComputeDataType rstd     = load(inv_std, inv_std_offsets, row, i);
+
+                dgamma_dbeta.first_ += dy_val * rstd * (x_val - mean_val);
+                dgamma_dbeta.second_ += dy_val;
+            }
+            return dgamma_dbeta;
+        });
+
+    for(std::size_t row = 0; row < num_row; ++row)
+    {
+        dgamma.mData[dgamma_offsets.rows_[row]] =
+            ck::type_convert<DGammaDataType>(sums[row].first_);
+        dbeta.mData[dbeta_offsets.rows_[row]] = ck::type_convert<DBetaDataType>(sums[row].second_);
+    }
+}
+
+} // namespace cpu
+} // namespace host
+} // namespace tensor_operation
+} // namespace ck
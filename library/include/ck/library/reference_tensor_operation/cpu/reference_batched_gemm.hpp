@@ -3,16 +3,98 @@
 
 #pragma once
 
+#include <array>
 #include <iostream>
 #include <sstream>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/blocked_gemm.hpp"
 
 namespace ck {
 namespace tensor_operation {
 namespace host {
 
+namespace detail {
+
+// The batched references use the cache-blocked CPU GEMM whenever it reproduces their scalar
+// loop: float accumulation of operands that convert exactly into float.
+template <typename ADataType, typename BDataType, typename AccDataType>
+inline constexpr bool use_blocked_batched_gemm_v = is_same_v<AccDataType, float> &&
+                                                   cpu::is_blocked_gemm_operand_v<ADataType> &&
+                                                   cpu::is_blocked_gemm_operand_v<BDataType>;
+
+// Batched GEMM of the last two dimensions of a, b and c on the blocked CPU GEMM. The leading
+// dimensions of a and c form G batches, those of b GB batches. ac_offsets(g) returns the element
+// offsets of batch g in a and c as a std::array, b_batch(g) the batch of b it multiplies and
+// b_offset(gb) the element offset of batch gb in b. Every batch of b is packed once, however
+// many batches of a share it.
+template <typename AccDataType,
+          typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename AElementwiseOperation,
+          typename BElementwiseOperation,
+          typename CElementwiseOperation,
+          typename ACOffsets,
+          typename BBatch,
+          typename BOffset>
+void run_blocked_batched_gemm(const Tensor<ADataType>& a,
+                              const Tensor<BDataType>& b,
+                              Tensor<CDataType>& c,
+                              std::size_t G,
+                              ACOffsets&& ac_offsets,
+                              std::size_t GB,
+                              BBatch&& b_batch,
+                              BOffset&& b_offset,
+                              const AElementwiseOperation& a_element_op,
+                              const BElementwiseOperation& b_element_op,
+                              const CElementwiseOperation& c_element_op)
+{
+    const std::size_t rank = c.mDesc.GetNumOfDimension();
+
+    const std::size_t M = c.mDesc.GetLengths()[rank - 2];
+    const std::size_t N = c.mDesc.GetLengths()[rank - 1];
+    const std::size_t K = a.mDesc.GetLengths()[rank - 1];
+
+    const auto& a_strides = a.mDesc.GetStrides();
+    const auto& b_strides = b.mDesc.GetStrides();
+    const auto& c_strides = c.mDesc.GetStrides();
+
+    auto load_a = [&](std::size_t g, std::size_t m, std::size_t k) {
+        ADataType v_a;
+
+        a_element_op(
+            v_a, a.mData[ac_offsets(g)[0] + m * a_strides[rank - 2] + k * a_strides[rank - 1]]);
+
+        return ck::type_convert<AccDataType>(v_a);
+    };
+
+    auto load_b = [&](std::size_t gb, std::size_t k, std::size_t n) {
+        BDataType v_b;
+
+        b_element_op(v_b,
+                     b.mData[b_offset(gb) + k * b_strides[rank - 2] + n * b_strides[rank - 1]]);
+
+        return ck::type_convert<AccDataType>(v_b);
+    };
+
+    auto store_c = [&](std::size_t g, std::size_t m, std::size_t n, AccDataType v_acc) {
+        AccDataType v_c;
+
+        c_element_op(v_c, v_acc);
+
+        c.mData[ac_offsets(g)[1] + m * c_strides[rank - 2] + n * c_strides[rank - 1]] =
+            ck::type_convert<CDataType>(v_c);
+    };
+
+    const cpu::BlockedGemmPackedB b_packed(GB, N, K, load_b);
+
+    cpu::blocked_batched_gemm(G, M, b_packed, b_batch, load_a, store_c);
+}
+
+} // namespace detail
+
 template <typename ADataType,
           typename BDataType,
           typename CDataType,
@@ -22,6 +104,9 @@ template <typename ADataType,
           typename CElementwiseOperation>
 struct ReferenceBatchedGemm : public device::BaseOperator
 {
+    // version of the output in the reference cache, see ck::utils::ReferenceCacheKey
+    static constexpr int CacheVersion = 1;
+
     // Argument
     struct Argument : public device::BaseArgument
     {
@@ -56,6 +141,30 @@ struct ReferenceBatchedGemm : public device::BaseOperator
 
         float Run(const Argument& arg)
         {
+            if constexpr(detail::use_blocked_batched_gemm_v<ADataType, BDataType, AccDataType>)
+            {
+                const auto& a_strides = arg.a_g_m_k_.mDesc.GetStrides();
+                const auto& b_strides = arg.b_g_k_n_.mDesc.GetStrides();
+                const auto& c_strides = arg.c_g_m_n_.mDesc.GetStrides();
+
+                detail::run_blocked_batched_gemm<AccDataType>(
+                    arg.a_g_m_k_,
+                    arg.b_g_k_n_,
+                    arg.c_g_m_n_,
+                    arg.c_g_m_n_.mDesc.GetLengths()[0],
+                    [&](std::size_t g) {
+                        return std::array<std::size_t, 2>{g * a_strides[0], g * c_strides[0]};
+                    },
+                    arg.b_g_k_n_.mDesc.GetLengths()[0],
+                    [](std::size_t g) { return g; },
+                    [&](std::size_t gb) { return gb * b_strides[0]; },
+                    arg.a_element_op_,
+                    arg.b_element_op_,
+                    arg.c_element_op_);
+
+                return 0;
+            }
+
             auto f_gmk_gkn_gmn = [&](auto g, auto m, auto n) {
                 const int K = arg.a_g_m_k_.mDesc.GetLengths()[2];
 
@@ -176,6 +285,36 @@ struct ReferenceBatchedGemm_MQA : public device::BaseOperator
 
         float Run(const Argument& arg)
         {
+            if constexpr(detail::use_blocked_batched_gemm_v<ADataType, BDataType, AccDataType>)
+            {
+                const std::size_t G1  = arg.c_g0_g1_m_n_.mDesc.GetLengths()[1];
+                const auto& a_strides = arg.a_g0_g1_m_k_.mDesc.GetStrides();
+                const auto& b_strides = arg.b_g0_1_k_n_.mDesc.GetStrides();
+                const auto& c_strides = arg.c_g0_g1_m_n_.mDesc.GetStrides();
+
+                // every g1 of a g0 shares the same B
+                detail::run_blocked_batched_gemm<AccDataType>(
+                    arg.a_g0_g1_m_k_,
+                    arg.b_g0_1_k_n_,
+                    arg.c_g0_g1_m_n_,
+                    arg.c_g0_g1_m_n_.mDesc.GetLengths()[0] * G1,
+                    [&](std::size_t g) {
+                        const std::size_t g0 = g / G1;
+                        const std::size_t g1 = g % G1;
+
+                        return std::array<std::size_t, 2>{g0 * a_strides[0] + g1 * a_strides[1],
+                                                          g0 * c_strides[0] + g1 * c_strides[1]};
+                    },
+                    arg.c_g0_g1_m_n_.mDesc.GetLengths()[0],
+                    [&](std::size_t g) { return g / G1; },
+                    [&](std::size_t gb) { return gb * b_strides[0]; },
+                    arg.a_element_op_,
+                    arg.b_element_op_,
+                    arg.c_element_op_);
+
+                return 0;
+            }
+
             auto f_g0g1mk_g01kn_g0g1mn = [&](auto g0, auto g1, auto m, auto n) {
                 const int K = arg.a_g0_g1_m_k_.mDesc.GetLengths()[3];
 
@@ -299,6 +438,44 @@ struct ReferenceBatchedGemm_GQA : public device::BaseOperator
 
         float Run(const Argument& arg)
         {
+            if constexpr(detail::use_blocked_batched_gemm_v<ADataType, BDataType, AccDataType>)
+            {
+                const std::size_t G1  = arg.c_g0_g1_m_n_.mDesc.GetLengths()[1];
+                const auto& a_strides = arg.a_g0_g1_m_k_.mDesc.GetStrides();
+                const auto& b_strides = arg.b_g0_gq_k_n_.mDesc.GetStrides();
+                const auto& c_strides = arg.c_g0_g1_m_n_.mDesc.GetStrides();
+
+                // G1 / QueryGroupNumber consecutive g1 share the same B
+                detail::run_blocked_batched_gemm<AccDataType>(
+                    arg.a_g0_g1_m_k_,
+                    arg.b_g0_gq_k_n_,
+                    arg.c_g0_g1_m_n_,
+                    arg.c_g0_g1_m_n_.mDesc.GetLengths()[0] * G1,
+                    [&](std::size_t g) {
+                        const std::size_t g0 = g / G1;
+                        const std::size_t g1 = g % G1;
+
+                        return std::array<std::size_t, 2>{g0 * a_strides[0] + g1 * a_strides[1],
+                                                          g0 * c_strides[0] + g1 * c_strides[1]};
+                    },
+                    arg.c_g0_g1_m_n_.mDesc.GetLengths()[0] * QueryGroupNumber,
+                    [&](std::size_t g) {
+                        const std::size_t g0 = g / G1;
+                        const std::size_t g1 = g % G1;
+
+                        return g0 * QueryGroupNumber + g1 * QueryGroupNumber / G1;
+                    },
+                    [&](std::size_t gb) {
+                        return gb / QueryGroupNumber * b_strides[0] +
+                               gb % QueryGroupNumber * b_strides[1];
+                    },
+                    arg.a_element_op_,
+                    arg.b_element_op_,
+                    arg.c_element_op_);
+
+                return 0;
+            }
+
             auto f_g0g1mk_g0gqkn_g0g1mn = [&](auto g0, auto g1, auto m, auto n) {
                 const int G1 = arg.a_g0_g1_m_k_.mDesc.GetLengths()[1];
                 const int K  = arg.a_g0_g1_m_k_.mDesc.GetLengths()[3];
@@ -9,6 +9,7 @@
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/library/reference_tensor_operation/cpu/blocked_gemm.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -70,6 +71,48 @@ struct ReferenceCGemm : public device::BaseOperator
     {
         using Argument = ReferenceCGemm::Argument;
 
+        // Both products as one real GEMM with the real and imaginary parts interleaved along k:
+        //   [C_real | C_imag] = [A_real, A_imag] x [[B_real, B_imag], [-B_imag, B_real]]
+        // so that A is packed once and every output element is computed by the blocked GEMM.
+        static void RunBlocked(const Argument& arg)
+        {
+            const std::size_t M = arg.c_m_n_real_.mDesc.GetLengths()[0];
+            const std::size_t N = arg.c_m_n_real_.mDesc.GetLengths()[1];
+            const std::size_t K = arg.a_m_k_real_.mDesc.GetLengths()[1];
+
+            auto load_a = [&](std::size_t m, std::size_t k2) {
+                const std::size_t k = k2 / 2;
+
+                return ck::type_convert<float>(k2 % 2 == 0 ? arg.a_m_k_real_(m, k)
+                                                           : arg.a_m_k_imag_(m, k));
+            };
+
+            auto load_b = [&](std::size_t k2, std::size_t n2) {
+                const std::size_t k = k2 / 2;
+                const bool imag_a   = k2 % 2 != 0;
+
+                if(n2 < N)
+                {
+                    return imag_a ? -ck::type_convert<float>(arg.b_k_n_imag_(k, n2))
+                                  : ck::type_convert<float>(arg.b_k_n_real_(k, n2));
+                }
+
+                const std::size_t n = n2 - N;
+
+                return ck::type_convert<float>(imag_a ? arg.b_k_n_real_(k, n)
+                                                      : arg.b_k_n_imag_(k, n));
+            };
+
+            auto store_c = [&](std::size_t m, std::size_t n2, float v_c) {
+                if(n2 < N)
+                    arg.c_m_n_real_(m, n2) = ck::type_convert<CDataType>(v_c);
+                else
+                    arg.c_m_n_imag_(m, n2 - N) = ck::type_convert<CDataType>(v_c);
+            };
+
+            cpu::blocked_gemm(M, 2 * N, 2 * K, load_a, load_b, store_c);
+        }
+
         float Run(const Argument& arg)
         {
             const std::size_t K = arg.a_m_k_real_.mDesc.GetLengths()[1];
@@ -79,6 +122,14 @@ struct ReferenceCGemm : public device::BaseOperator
                 throw std::runtime_error("wrong! Incompatible real and imag sizes in CGEMM");
             }
 
+            if constexpr(cpu::is_blocked_gemm_operand_v<ADataType> &&
+                         cpu::is_blocked_gemm_operand_v<BDataType>)
+            {
+                RunBlocked(arg);
+
+                return 0;
+            }
+
             auto f_mk_kn_mn_real = [&](auto m, auto n) {
                 float v_c_real = 0;
 
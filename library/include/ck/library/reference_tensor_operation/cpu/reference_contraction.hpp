@@ -3,11 +3,15 @@
 
 #pragma once
 
+#include <functional>
 #include <iostream>
+#include <numeric>
 #include <sstream>
+#include <vector>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/blocked_gemm.hpp"
 
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 
@@ -59,8 +63,88 @@ struct ReferenceContraction_M2_N2_K2 : public ck::tensor_operation::device::Base
     {
         using Argument = ReferenceContraction_M2_N2_K2::Argument;
 
+        // element offsets of the row-major indices of dimensions [first, first + num_dim)
+        static std::vector<std::size_t> GetFlattenedOffsets(const HostTensorDescriptor& desc,
+                                                            std::size_t first,
+                                                            std::size_t num_dim)
+        {
+            const std::vector<std::size_t> lengths(desc.GetLengths().begin() + first,
+                                                   desc.GetLengths().begin() + first + num_dim);
+            const std::vector<std::size_t> strides(desc.GetStrides().begin() + first,
+                                                   desc.GetStrides().begin() + first + num_dim);
+
+            const std::size_t size = std::accumulate(
+                lengths.begin(), lengths.end(), std::size_t{1}, std::multiplies<std::size_t>());
+
+            std::vector<std::size_t> offsets;
+            offsets.reserve(size);
+
+            std::vector<std::size_t> idx(num_dim);
+            for_each_strided_index(lengths, strides, 0, size, idx, [&](auto&, std::size_t offset) {
+                offsets.push_back(offset);
+            });
+
+            return offsets;
+        }
+
+        // The contraction is a GEMM over the flattened M, N and K dimensions; the ks are
+        // visited in the same row-major order as the scalar loops, so the float accumulation
+        // is the same.
+        static void RunBlocked(const Argument& arg)
+        {
+            const auto a_m_offsets = GetFlattenedOffsets(arg.a_ms_ks_.mDesc, 0, NumDimM);
+            const auto a_k_offsets = GetFlattenedOffsets(arg.a_ms_ks_.mDesc, NumDimM, NumDimK);
+            const auto b_n_offsets = GetFlattenedOffsets(arg.b_ns_ks_.mDesc, 0, NumDimN);
+            const auto b_k_offsets = GetFlattenedOffsets(arg.b_ns_ks_.mDesc, NumDimN, NumDimK);
+            const auto c_m_offsets = GetFlattenedOffsets(arg.c_ms_ns_.mDesc, 0, NumDimM);
+            const auto c_n_offsets = GetFlattenedOffsets(arg.c_ms_ns_.mDesc, NumDimM, NumDimN);
+
+            auto load_a = [&](std::size_t m, std::size_t k) {
+                // Simulate the possible casting when ComputeDataType is different than the A
+                // data type
+                const auto v_a_compute_input = ck::type_convert<ComputeDataType>(
+                    arg.a_ms_ks_.mData[a_m_offsets[m] + a_k_offsets[k]]);
+
+                AccDataType v_a;
+
+                arg.a_element_op_(v_a, ck::type_convert<AccDataType>(v_a_compute_input));
+
+                return v_a;
+            };
+
+            auto load_b = [&](std::size_t k, std::size_t n) {
+                const auto v_b_compute_input = ck::type_convert<ComputeDataType>(
+                    arg.b_ns_ks_.mData[b_n_offsets[n] + b_k_offsets[k]]);
+
+                AccDataType v_b;
+
+                arg.b_element_op_(v_b, ck::type_convert<AccDataType>(v_b_compute_input));
+
+                return v_b;
+            };
+
+            auto store_c = [&](std::size_t m, std::size_t n, AccDataType v_acc) {
+                arg.c_ms_ns_.mData[c_m_offsets[m] + c_n_offsets[n]] =
+                    ck::type_convert<CDataType>(v_acc);
+            };
+
+            cpu::blocked_gemm(a_m_offsets.size(),
+                              b_n_offsets.size(),
+                              a_k_offsets.size(),
+                              load_a,
+                              load_b,
+                              store_c);
+        }
+
         float Run(const Argument& arg)
         {
+            if constexpr(is_same_v<AccDataType, float>)
+            {
+                RunBlocked(arg);
+
+                return 0;
+            }
+
             auto f_ms_ns = [&](auto m0,
                                auto m1,
                                auto m2,
@@ -3,17 +3,34 @@
 
 #pragma once
 
+#include <array>
 #include <iostream>
 #include <sstream>
+#include <tuple>
+#include <vector>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/blocked_gemm.hpp"
 
 namespace ck {
 namespace tensor_operation {
 namespace host {
 
+// Engine used by ReferenceConvBwdData.
+enum struct ReferenceConvBwdDataMode
+{
+    // Fast whenever the elementwise operations and data types allow it, Exact otherwise
+    Default,
+    // nested loop per input element that skips taps outside the output
+    Exact,
+    // one GEMM per stride phase of the input on the cache-blocked CPU GEMM; products are still
+    // accumulated in float in (z, y, x, k) order, taps outside the output add a zero product
+    Fast,
+};
+
 // input descriptor in [G, N, C, Do, Ho, Wo] order
 // weight descriptor in [G, K, C, Z, Y, X] order
 // output descriptor in [G, N, K, Di, Hi, Wi] order
@@ -31,6 +48,9 @@ template <ck::index_t NDimSpatial,
           typename std::enable_if<NDimSpatial >= 1 && NDimSpatial <= 3, bool>::type = false>
 struct ReferenceConvBwdData : public device::BaseOperator
 {
+    // version of the output in the reference cache, see ck::utils::ReferenceCacheKey
+    static constexpr int CacheVersion = 1;
+
     // Argument
     struct Argument : public device::BaseArgument
     {
@@ -47,7 +67,8 @@ struct ReferenceConvBwdData : public device::BaseOperator
             OutElementwiseOperation out_element_op,
             const std::array<Tensor<InDataType>, NumAElementwiseTensor>& elementwise_a_tensors,
             const std::array<Tensor<WeiDataType>, NumBElementwiseTensor>& elementwise_b_tensors,
-            const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors)
+            const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors,
+            ReferenceConvBwdDataMode mode)
             : input_{input},
               weight_{weight},
               output_{output},
@@ -60,7 +81,8 @@ struct ReferenceConvBwdData : public device::BaseOperator
               in_right_pads_{input_right_pads},
               in_element_op_{in_element_op},
               wei_element_op_{wei_element_op},
-              out_element_op_{out_element_op}
+              out_element_op_{out_element_op},
+              mode_{mode}
         {
         }
 
@@ -80,13 +102,222 @@ struct ReferenceConvBwdData : public device::BaseOperator
         InElementwiseOperation in_element_op_;
         WeiElementwiseOperation wei_element_op_;
         OutElementwiseOperation out_element_op_;
+
+        const ReferenceConvBwdDataMode mode_;
     };
 
+    template <typename ElementwiseOp>
+    static constexpr bool IsGemmLowerableElementwiseOp =
+        is_same_v<ElementwiseOp, element_wise::PassThrough> ||
+        is_same_v<ElementwiseOp, element_wise::Scale> ||
+        is_same_v<ElementwiseOp, element_wise::UnaryConvert>;
+
+    // The GEMM engine applies the output and weight operations once per element while
+    // packing, which is only equivalent for stateless unary operations without extra tensors.
+    static constexpr bool IsFastModeSupported =
+        NumAElementwiseTensor == 0 && NumBElementwiseTensor == 0 &&
+        IsGemmLowerableElementwiseOp<OutElementwiseOperation> &&
+        IsGemmLowerableElementwiseOp<WeiElementwiseOperation> &&
+        cpu::is_blocked_gemm_operand_v<OutDataType> && cpu::is_blocked_gemm_operand_v<WeiDataType>;
+
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
         using Argument = ReferenceConvBwdData::Argument;
 
+        // An input element i only receives the taps f with i + p - f * d divisible by the
+        // stride s, so the input is split into the prod(s) phases r = (i + p) mod s, whose
+        // taps all satisfy f * d mod s = r. Per phase, with i + p = r + s * qi and
+        // f * d = r + s * qf, the output pixel of (i, f) is o = qi - qf and
+        //   in[(n, i...), c] = sum_{(f..., k)} out[n, k, qi - qf] * wei[k, c, f...]
+        // is a GEMM, batched over the groups.
+        static void RunFast(const Argument& arg)
+        {
+            constexpr std::size_t NDim = NDimSpatial;
+
+            const auto& in_lengths  = arg.input_.GetLengths();
+            const auto& in_strides  = arg.input_.GetStrides();
+            const auto& wei_lengths = arg.weight_.GetLengths();
+            const auto& wei_strides = arg.weight_.GetStrides();
+            const auto& out_lengths = arg.output_.GetLengths();
+            const auto& out_strides = arg.output_.GetStrides();
+
+            const std::size_t G = in_lengths[0];
+            const std::size_t N = in_lengths[1];
+            const std::size_t C = in_lengths[2];
+            const std::size_t K = wei_lengths[1];
+
+            std::size_t num_phase = 1;
+            for(std::size_t d = 0; d < NDim; ++d)
+                num_phase *= arg.conv_strides_[d];
+
+            for(std::size_t phase = 0; phase < num_phase; ++phase)
+            {
+                // input coordinates and filter taps of the phase in every spatial dimension
+                std::array<std::vector<std::size_t>, NDim> phase_i;
+                std::array<std::vector<long_index_t>, NDim> phase_qi;
+                std::array<std::vector<std::size_t>, NDim> phase_f;
+                std::array<std::vector<long_index_t>, NDim> phase_qf;
+
+                std::size_t num_pixel = 1;
+                std::size_t num_tap   = 1;
+                for(std::size_t d = NDim, rest = phase; d-- > 0;)
+                {
+                    const long_index_t s = arg.conv_strides_[d];
+                    const long_index_t r = static_cast<long_index_t>(rest) % s;
+                    rest /= s;
+
+                    for(std::size_t i = 0; i < in_lengths[3 + d]; ++i)
+                    {
+                        const long_index_t ip =
+                            static_cast<long_index_t>(i) + arg.in_left_pads_[d];
+                        if(ip % s == r)
+                        {
+                            phase_i[d].push_back(i);
+                            phase_qi[d].push_back((ip - r) / s);
+                        }
+                    }
+
+                    for(std::size_t f = 0; f < wei_lengths[3 + d]; ++f)
+                    {
+                        const long_index_t fd =
+                            static_cast<long_index_t>(f) * arg.conv_dilations_[d];
+                        if(fd % s == r)
+                        {
+                            phase_f[d].push_back(f);
+                            phase_qf[d].push_back((fd - r) / s);
+                        }
+                    }
+
+                    num_pixel *= phase_i[d].size();
+                    num_tap *= phase_f[d].size();
+                }
+
+                const std::size_t gemm_m = N * num_pixel;
+
+                if(gemm_m == 0)
+                    continue;
+
+                // GEMM row (n, i...): input offset, output offset of n, qi and input index
+                std::vector<std::size_t> row_in_offset(gemm_m);
+                std::vector<std::size_t> row_out_offset(gemm_m);
+                std::vector<long_index_t> row_qi(gemm_m * NDim);
+                std::vector<std::size_t> row_idx(gemm_m * (NDim + 1));
+
+                for(std::size_t row = 0; row < gemm_m; ++row)
+                {
+                    std::size_t rest      = row;
+                    std::size_t in_offset = 0;
+                    for(std::size_t d = NDim; d-- > 0;)
+                    {
+                        const std::size_t j = rest % phase_i[d].size();
+                        rest /= phase_i[d].size();
+
+                        in_offset += phase_i[d][j] * in_strides[3 + d];
+                        row_qi[row * NDim + d]            = phase_qi[d][j];
+                        row_idx[row * (NDim + 1) + 1 + d] = phase_i[d][j];
+                    }
+
+                    row_in_offset[row]        = rest * in_strides[1] + in_offset;
+                    row_out_offset[row]       = rest * out_strides[1];
+                    row_idx[row * (NDim + 1)] = rest;
+                }
+
+                // filter tap (f...): weight offset and qf
+                std::vector<std::size_t> tap_wei_offset(num_tap);
+                std::vector<long_index_t> tap_qf(num_tap * NDim);
+
+                for(std::size_t tap = 0; tap < num_tap; ++tap)
+                {
+                    std::size_t rest       = tap;
+                    std::size_t wei_offset = 0;
+                    for(std::size_t d = NDim; d-- > 0;)
+                    {
+                        const std::size_t j = rest % phase_f[d].size();
+                        rest /= phase_f[d].size();
+
+                        wei_offset += phase_f[d][j] * wei_strides[3 + d];
+                        tap_qf[tap * NDim + d] = phase_qf[d][j];
+                    }
+
+                    tap_wei_offset[tap] = wei_offset;
+                }
+
+                // GEMM k (tap, k): offset in the weight of a group
+                std::vector<std::size_t> col_wei_offset(num_tap * K);
+                for(std::size_t col = 0; col < num_tap * K; ++col)
+                    col_wei_offset[col] = col % K * wei_strides[1] + tap_wei_offset[col / K];
+
+                // GEMM k is (tap, k), so that the taps are outer like in the direct loop
+                auto load_out = [&](std::size_t g, std::size_t row, std::size_t col) {
+                    const std::size_t tap = col / K;
+                    const std::size_t k   = col % K;
+
+                    std::size_t offset =
+                        g * out_strides[0] + k * out_strides[2] + row_out_offset[row];
+                    for(std::size_t d = 0; d < NDim; ++d)
+                    {
+                        const long_index_t o = row_qi[row * NDim + d] - tap_qf[tap * NDim + d];
+                        if(o < 0 || static_cast<std::size_t>(o) >= out_lengths[3 + d])
+                            return 0.f;
+
+                        offset += static_cast<std::size_t>(o) * out_strides[3 + d];
+                    }
+
+                    OutDataType v_out;
+                    arg.out_element_op_(v_out, arg.output_.mData[offset]);
+
+                    return ck::type_convert<float>(v_out);
+                };
+
+                auto load_wei = [&](std::size_t g, std::size_t col, std::size_t c) {
+                    WeiDataType v_wei;
+                    arg.wei_element_op_(v_wei,
+                                        arg.weight_.mData[g * wei_strides[0] + c * wei_strides[2] +
+                                                          col_wei_offset[col]]);
+
+                    return ck::type_convert<float>(v_wei);
+                };
+
+                auto store_in = [&](std::size_t g, std::size_t row, std::size_t c, float v_acc) {
+                    InDataType v_acc_converted = ck::type_convert<InDataType>(v_acc);
+                    InDataType& v_in = arg.input_.mData[g * in_strides[0] + c * in_strides[2] +
+                                                        row_in_offset[row]];
+
+                    if constexpr(NumDElementwiseTensor == 0)
+                    {
+                        arg.in_element_op_(v_in, v_acc_converted);
+                    }
+                    else
+                    {
+                        // D tensors share the input descriptor
+                        std::array<std::size_t, NDimSpatial + 3> idx{};
+                        idx[0] = g;
+                        idx[1] = row_idx[row * (NDim + 1)];
+                        idx[2] = c;
+                        for(std::size_t d = 0; d < NDim; ++d)
+                            idx[3 + d] = row_idx[row * (NDim + 1) + 1 + d];
+
+                        std::apply(
+                            [&](auto... is) {
+                                ExecuteElementwiseOp(arg.in_element_op_,
+                                                     arg.elementwise_d_tensors_,
+                                                     Number<NumDElementwiseTensor>{},
+                                                     v_in,
+                                                     v_acc_converted,
+                                                     is...);
+                            },
+                            idx);
+                    }
+                };
+
+                // both operands are packed per block, neither the strided output nor the
+                // weight is rearranged as a whole
+                cpu::blocked_batched_gemm_streamed(
+                    G, gemm_m, C, num_tap * K, load_out, load_wei, store_in);
+            }
+        }
+
         float Run(const Argument& arg)
         {
             if(!(arg.input_.GetNumOfDimension() == NDimSpatial + 3 &&
@@ -96,6 +327,24 @@ struct ReferenceConvBwdData : public device::BaseOperator
                 throw std::runtime_error("wrong! inconsistent dimension");
             }
 
+            if constexpr(IsFastModeSupported)
+            {
+                if(arg.mode_ != ReferenceConvBwdDataMode::Exact)
+                {
+                    RunFast(arg);
+
+                    return 0;
+                }
+            }
+            else
+            {
+                if(arg.mode_ == ReferenceConvBwdDataMode::Fast)
+                {
+                    throw std::runtime_error(
+                        "wrong! fast mode is not supported by these elementwise operations");
+                }
+            }
+
             if constexpr(NDimSpatial == 1)
             {
                 auto f_ncw = [&](auto g, auto n, auto c, auto wi) {
@@ -456,7 +705,8 @@ struct ReferenceConvBwdData : public device::BaseOperator
         OutElementwiseOperation out_element_op,
         const std::array<Tensor<InDataType>, NumAElementwiseTensor>& elementwise_a_tensors  = {},
         const std::array<Tensor<WeiDataType>, NumBElementwiseTensor>& elementwise_b_tensors = {},
-        const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors = {})
+        const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors = {},
+        ReferenceConvBwdDataMode mode = ReferenceConvBwdDataMode::Default)
     {
         return Argument{input,
                         weight,
@@ -470,7 +720,8 @@ struct ReferenceConvBwdData : public device::BaseOperator
                         out_element_op,
                         elementwise_a_tensors,
                         elementwise_b_tensors,
-                        elementwise_d_tensors};
+                        elementwise_d_tensors,
+                        mode};
     }
 
     static auto MakeInvoker() { return Invoker{}; }
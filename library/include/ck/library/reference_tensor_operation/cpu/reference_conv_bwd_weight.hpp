@@ -3,17 +3,37 @@
 
 #pragma once
 
+#include <algorithm>
+#include <array>
 #include <iostream>
 #include <sstream>
+#include <tuple>
+#include <vector>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/blocked_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/conv_im2col_table.hpp"
 
 namespace ck {
 namespace tensor_operation {
 namespace host {
 
+// Engine used by ReferenceConvBwdWeight.
+enum struct ReferenceConvBwdWeightMode
+{
+    // Fast whenever the elementwise operations and data types allow it, Exact otherwise
+    Default,
+    // nested loop per weight element over the images and output pixels
+    Exact,
+    // transposed im2col + GEMM on the cache-blocked CPU GEMM, with a long reduction split into
+    // chunks whose float partial sums are added in a fixed order; without a split the result is
+    // bit-identical to Exact
+    Fast,
+};
+
 // input descriptor in [G, N, C, Do, Ho, Wo] order
 // weight descriptor in [G, K, C, Z, Y, X] order
 // output descriptor in [G, N, K, Di, Hi, Wi] order
@@ -33,6 +53,9 @@ template <ck::index_t NDimSpatial,
           typename std::enable_if<NDimSpatial >= 1 && NDimSpatial <= 3, bool>::type = false>
 struct ReferenceConvBwdWeight : public device::BaseOperator
 {
+    // version of the output in the reference cache, see ck::utils::ReferenceCacheKey
+    static constexpr int CacheVersion = 1;
+
     // Argument
     struct Argument : public device::BaseArgument
     {
@@ -49,7 +72,8 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
             OutElementwiseOperation out_element_op,
             const std::array<Tensor<OutDataType>, NumAElementwiseTensor>& elementwise_a_tensors,
             const std::array<Tensor<InDataType>, NumBElementwiseTensor>& elementwise_b_tensors,
-            const std::array<Tensor<WeiDataType>, NumDElementwiseTensor>& elementwise_d_tensors)
+            const std::array<Tensor<WeiDataType>, NumDElementwiseTensor>& elementwise_d_tensors,
+            ReferenceConvBwdWeightMode mode)
             : input_{in_n_c_hi_wi},
               weight_{wei_k_c_y_x},
               output_{out_n_k_ho_wo},
@@ -62,7 +86,8 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
               in_right_pads_{input_right_pads},
               in_element_op_{in_element_op},
               wei_element_op_{wei_element_op},
-              out_element_op_{out_element_op}
+              out_element_op_{out_element_op},
+              mode_{mode}
         {
         }
 
@@ -82,13 +107,188 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
         InElementwiseOperation in_element_op_;
         WeiElementwiseOperation wei_element_op_;
         OutElementwiseOperation out_element_op_;
+
+        const ReferenceConvBwdWeightMode mode_;
     };
 
+    template <typename ElementwiseOp>
+    static constexpr bool IsGemmLowerableElementwiseOp =
+        is_same_v<ElementwiseOp, element_wise::PassThrough> ||
+        is_same_v<ElementwiseOp, element_wise::Scale> ||
+        is_same_v<ElementwiseOp, element_wise::UnaryConvert>;
+
+    // The GEMM engine applies the output and input operations once per element while packing,
+    // which is only equivalent for stateless unary operations without extra tensors.
+    static constexpr bool IsFastModeSupported =
+        NumAElementwiseTensor == 0 && NumBElementwiseTensor == 0 &&
+        IsGemmLowerableElementwiseOp<OutElementwiseOperation> &&
+        IsGemmLowerableElementwiseOp<InElementwiseOperation> &&
+        cpu::is_blocked_gemm_operand_v<ComputeTypeA> &&
+        cpu::is_blocked_gemm_operand_v<ComputeTypeB>;
+
+    // Minimum reduction length of a split-K chunk, the number of GEMM tiles the split aims for
+    // and the largest float workspace of the partial sums the split may take. The split only
+    // depends on the problem shape, never on the number of threads, so the result is
+    // reproducible on every machine.
+    static constexpr std::size_t SplitKMinLength         = 4096;
+    static constexpr std::size_t SplitKTargetTile        = 256;
+    static constexpr std::size_t SplitKMaxWorkspaceBytes = std::size_t{16} << 20;
+
+    // number of chunks the reduction of length R is split into, for G GEMMs of M x N
+    static std::size_t GetNumSplitK(std::size_t G, std::size_t M, std::size_t N, std::size_t R)
+    {
+        using Config = cpu::BlockedGemmConfig;
+
+        const std::size_t num_tile =
+            G * ((M + Config::MC - 1) / Config::MC) * ((N + Config::NC - 1) / Config::NC);
+
+        const std::size_t workspace_per_split = std::max<std::size_t>(G * M * N * sizeof(float), 1);
+
+        const std::size_t max_split = std::max<std::size_t>(
+            std::min(R / SplitKMinLength, SplitKMaxWorkspaceBytes / workspace_per_split), 1);
+
+        return std::clamp<std::size_t>(
+            (SplitKTargetTile + num_tile - 1) / std::max<std::size_t>(num_tile, 1), 1, max_split);
+    }
+
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
         using Argument = ReferenceConvBwdWeight::Argument;
 
+        // Per group, with the im2col matrix of the input:
+        //   wei[k, (c, f...)] = sum_{(n, o...)} out[n, k, o...] * in[n, c, o * s + f * d - p]
+        // The reduction over (n, o...) is split into S chunks of L rows, which are G * S
+        // batches of one GEMM; the S partial sums of every weight element are added in chunk
+        // order afterwards. The im2col matrix is packed one block at a time, never as a whole.
+        static void RunFast(const Argument& arg)
+        {
+            constexpr std::size_t NDim = NDimSpatial;
+
+            const auto& in_lengths  = arg.input_.GetLengths();
+            const auto& in_strides  = arg.input_.GetStrides();
+            const auto& wei_lengths = arg.weight_.GetLengths();
+            const auto& wei_strides = arg.weight_.GetStrides();
+            const auto& out_lengths = arg.output_.GetLengths();
+            const auto& out_strides = arg.output_.GetStrides();
+
+            const std::size_t G = wei_lengths[0];
+            const std::size_t K = wei_lengths[1];
+
+            const cpu::ConvIm2colTable<NDim> table(in_lengths,
+                                                   in_strides,
+                                                   wei_lengths,
+                                                   wei_strides,
+                                                   out_lengths,
+                                                   out_strides,
+                                                   arg.conv_strides_,
+                                                   arg.conv_dilations_,
+                                                   arg.in_left_pads_);
+
+            const std::size_t R = table.GetNumRow();
+            const std::size_t N = table.GetNumCol();
+            const std::size_t S = GetNumSplitK(G, K, N, R);
+            const std::size_t L = (R + S - 1) / S;
+
+            auto load_out = [&](std::size_t b, std::size_t k, std::size_t r) {
+                const std::size_t g   = b / S;
+                const std::size_t row = b % S * L + r;
+                if(row >= R)
+                    return 0.f;
+
+                ComputeTypeA v_out;
+                arg.out_element_op_(
+                    v_out,
+                    ck::type_convert<float>(arg.output_.mData[g * out_strides[0] +
+                                                              k * out_strides[2] +
+                                                              table.GetOutputOffset(row)]));
+
+                return ck::type_convert<float>(v_out);
+            };
+
+            auto load_in = [&](std::size_t b, std::size_t r, std::size_t col) {
+                const std::size_t g   = b / S;
+                const std::size_t row = b % S * L + r;
+
+                std::size_t offset;
+                if(row >= R || !table.GetInputOffset(row, col, offset))
+                    return 0.f;
+
+                ComputeTypeB v_in;
+                arg.in_element_op_(
+                    v_in, ck::type_convert<float>(arg.input_.mData[g * in_strides[0] + offset]));
+
+                return ck::type_convert<float>(v_in);
+            };
+
+            auto store_wei = [&](std::size_t g, std::size_t k, std::size_t col, float v_acc) {
+                WeiDataType v_acc_converted = ck::type_convert<WeiDataType>(v_acc);
+                WeiDataType& v_wei =
+                    arg.weight_.mData[g * wei_strides[0] + k * wei_strides[1] +
+                                      table.GetWeightOffset(col)];
+
+                if constexpr(NumDElementwiseTensor == 0)
+                {
+                    arg.wei_element_op_(v_wei, v_acc_converted);
+                }
+                else
+                {
+                    // D tensors share the weight descriptor, recover the full index
+                    std::array<std::size_t, NDimSpatial + 3> idx{};
+                    idx[0]           = g;
+                    idx[1]           = k;
+                    std::size_t rest = col;
+                    for(std::size_t d = NDim; d-- > 0;)
+                    {
+                        idx[3 + d] = rest % wei_lengths[3 + d];
+                        rest /= wei_lengths[3 + d];
+                    }
+                    idx[2] = rest;
+
+                    std::apply(
+                        [&](auto... is) {
+                            ExecuteElementwiseOp(arg.wei_element_op_,
+                                                 arg.elementwise_d_tensors_,
+                                                 Number<NumDElementwiseTensor>{},
+                                                 v_wei,
+                                                 v_acc_converted,
+                                                 is...);
+                        },
+                        idx);
+                }
+            };
+
+            if(S == 1)
+            {
+                cpu::blocked_batched_gemm_streamed(G, K, N, R, load_out, load_in, store_wei);
+
+                return;
+            }
+
+            std::vector<float> partial(G * S * K * N);
+
+            cpu::blocked_batched_gemm_streamed(
+                G * S,
+                K,
+                N,
+                L,
+                load_out,
+                load_in,
+                [&](std::size_t b, std::size_t k, std::size_t col, float v_acc) {
+                    partial[(b * K + k) * N + col] = v_acc;
+                });
+
+            auto f_reduce = [&](auto g, auto k, auto col) {
+                float v_acc = 0;
+                for(std::size_t s = 0; s < S; ++s)
+                    v_acc += partial[((g * S + s) * K + k) * N + col];
+
+                store_wei(g, k, col, v_acc);
+            };
+
+            make_ParallelTensorFunctor(f_reduce, G, K, N)(std::thread::hardware_concurrency());
+        }
+
         float Run(const Argument& arg)
         {
             if(!(arg.input_.GetNumOfDimension() == NDimSpatial + 3 &&
@@ -98,6 +298,24 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
                 throw std::runtime_error("wrong! inconsistent dimension");
             }
 
+            if constexpr(IsFastModeSupported)
+            {
+                if(arg.mode_ != ReferenceConvBwdWeightMode::Exact)
+                {
+                    RunFast(arg);
+
+                    return 0;
+                }
+            }
+            else
+            {
+                if(arg.mode_ == ReferenceConvBwdWeightMode::Fast)
+                {
+                    throw std::runtime_error(
+                        "wrong! fast mode is not supported by these elementwise operations");
+                }
+            }
+
             if constexpr(NDimSpatial == 1)
             {
                 auto f_kcx = [&](auto g, auto k, auto c, auto x) {
@@ -411,7 +629,8 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
         OutElementwiseOperation out_element_op,
         const std::array<Tensor<OutDataType>, NumAElementwiseTensor>& elementwise_a_tensors = {},
         const std::array<Tensor<InDataType>, NumBElementwiseTensor>& elementwise_b_tensors  = {},
-        const std::array<Tensor<WeiDataType>, NumDElementwiseTensor>& elementwise_d_tensors = {})
+        const std::array<Tensor<WeiDataType>, NumDElementwiseTensor>& elementwise_d_tensors = {},
+        ReferenceConvBwdWeightMode mode = ReferenceConvBwdWeightMode::Default)
     {
         return Argument{in_n_c_hi_wi,
                         wei_k_c_y_x,
@@ -425,7 +644,8 @@ struct ReferenceConvBwdWeight : public device::BaseOperator
                         out_element_op,
                         elementwise_a_tensors,
                         elementwise_b_tensors,
-                        elementwise_d_tensors};
+                        elementwise_d_tensors,
+                        mode};
     }
 
     static auto MakeInvoker() { return Invoker{}; }
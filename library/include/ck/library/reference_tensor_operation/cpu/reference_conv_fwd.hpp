@@ -3,9 +3,12 @@
 
 #pragma once
 
+#include <array>
 #include <cmath>
 #include <cstdlib>
 #include <numeric>
+#include <thread>
+#include <tuple>
 #include <type_traits>
 #include <vector>
 
@@ -18,13 +21,29 @@
 #include "ck/library/utility/check_err.hpp"
 #include "ck/library/utility/fill.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_view.hpp"
 #include "ck/library/utility/convolution_parameter.hpp"
 #include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/reference_tensor_operation/cpu/blocked_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/conv_im2col_table.hpp"
 
 namespace ck {
 namespace tensor_operation {
 namespace host {
 
+// Engine used by ReferenceConvFwd.
+enum struct ReferenceConvFwdMode
+{
+    // Fast whenever the elementwise operations and data types allow it, Exact otherwise
+    Default,
+    // nested loop per output element that skips padded taps
+    Exact,
+    // implicit im2col of the input feeding the cache-blocked CPU GEMM for the output pixels
+    // whose window lies inside the input, the nested loop for the others; products are
+    // accumulated in float in (c, z, y, x) order and padded taps are skipped, like in Exact
+    Fast,
+};
+
 //
 // @brief      Reference implementation for forward convolution.
 //
@@ -62,13 +81,16 @@ template <ck::index_t NDimSpatial,
           typename std::enable_if<NDimSpatial >= 1 && NDimSpatial <= 3, bool>::type = false>
 struct ReferenceConvFwd : public device::BaseOperator
 {
+    // version of the output in the reference cache, see ck::utils::ReferenceCacheKey
+    static constexpr int CacheVersion = 1;
+
     // Argument
     struct Argument : public device::BaseArgument
     {
         Argument(
-            const Tensor<InDataType>& input,
-            const Tensor<WeiDataType>& weight,
-            Tensor<OutDataType>& output,
+            TensorView<const InDataType> input,
+            TensorView<const WeiDataType> weight,
+            TensorView<OutDataType> output,
             std::vector<ck::long_index_t> conv_filter_strides,
             std::vector<ck::long_index_t> conv_filter_dilations,
             std::vector<ck::long_index_t> input_left_pads,
@@ -78,7 +100,8 @@ struct ReferenceConvFwd : public device::BaseOperator
             OutElementwiseOperation out_element_op,
             const std::array<Tensor<InDataType>, NumAElementwiseTensor>& elementwise_a_tensors,
             const std::array<Tensor<WeiDataType>, NumBElementwiseTensor>& elementwise_b_tensors,
-            const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors)
+            const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors,
+            ReferenceConvFwdMode mode)
             : input_{input},
               weight_{weight},
               output_{output},
@@ -91,13 +114,14 @@ struct ReferenceConvFwd : public device::BaseOperator
               in_right_pads_{input_right_pads},
               in_element_op_{in_element_op},
               wei_element_op_{wei_element_op},
-              out_element_op_{out_element_op}
+              out_element_op_{out_element_op},
+              mode_{mode}
         {
         }
 
-        const Tensor<InDataType>& input_;
-        const Tensor<WeiDataType>& weight_;
-        Tensor<OutDataType>& output_;
+        TensorView<const InDataType> input_;
+        TensorView<const WeiDataType> weight_;
+        TensorView<OutDataType> output_;
 
         const std::array<Tensor<InDataType>, NumAElementwiseTensor>& elementwise_a_tensors_;
         const std::array<Tensor<WeiDataType>, NumBElementwiseTensor>& elementwise_b_tensors_;
@@ -111,12 +135,152 @@ struct ReferenceConvFwd : public device::BaseOperator
         InElementwiseOperation in_element_op_;
         WeiElementwiseOperation wei_element_op_;
         OutElementwiseOperation out_element_op_;
+
+        const ReferenceConvFwdMode mode_;
     };
 
+    template <typename ElementwiseOp>
+    static constexpr bool IsGemmLowerableElementwiseOp =
+        is_same_v<ElementwiseOp, element_wise::PassThrough> ||
+        is_same_v<ElementwiseOp, element_wise::Scale> ||
+        is_same_v<ElementwiseOp, element_wise::UnaryConvert>;
+
+    // The im2col + GEMM engine applies the input and weight operations once per element while
+    // packing, which is only equivalent for stateless unary operations without extra tensors.
+    static constexpr bool IsFastModeSupported =
+        NumAElementwiseTensor == 0 && NumBElementwiseTensor == 0 &&
+        IsGemmLowerableElementwiseOp<InElementwiseOperation> &&
+        IsGemmLowerableElementwiseOp<WeiElementwiseOperation> &&
+        cpu::is_blocked_gemm_operand_v<InDataType> && cpu::is_blocked_gemm_operand_v<WeiDataType>;
+
     struct Invoker : public device::BaseInvoker
     {
         using Argument = ReferenceConvFwd::Argument;
 
+        // Per group:
+        //   out[(n, o...), k] = sum_{(c, f...)} in[n, c, o * s + f * d - p] * wei[k, c, f...]
+        // The rows (n, o...) whose window lies inside the input run on the blocked GEMM, which
+        // gathers their im2col blocks while packing. The rows that read the padding are a thin
+        // border; they take a direct loop that skips the padded taps.
+        static void RunFast(const Argument& arg)
+        {
+            constexpr std::size_t NDim = NDimSpatial;
+
+            const auto& in_lengths  = arg.input_.GetLengths();
+            const auto& in_strides  = arg.input_.GetStrides();
+            const auto& wei_lengths = arg.weight_.GetLengths();
+            const auto& wei_strides = arg.weight_.GetStrides();
+            const auto& out_lengths = arg.output_.GetLengths();
+            const auto& out_strides = arg.output_.GetStrides();
+
+            const std::size_t G = out_lengths[0];
+            const std::size_t K = out_lengths[2];
+
+            const cpu::ConvIm2colTable<NDim> table(in_lengths,
+                                                   in_strides,
+                                                   wei_lengths,
+                                                   wei_strides,
+                                                   out_lengths,
+                                                   out_strides,
+                                                   arg.conv_strides_,
+                                                   arg.conv_dilations_,
+                                                   arg.in_left_pads_);
+
+            std::vector<std::size_t> gemm_rows;
+            std::vector<std::size_t> border_rows;
+
+            for(std::size_t row = 0; row < table.GetNumRow(); ++row)
+                (table.HasPaddedTap(row) ? border_rows : gemm_rows).push_back(row);
+
+            auto load_in = [&](std::size_t g, std::size_t offset) {
+                InDataType v_in;
+                arg.in_element_op_(v_in, arg.input_.mData[g * in_strides[0] + offset]);
+
+                return ck::type_convert<float>(v_in);
+            };
+
+            auto load_wei = [&](std::size_t g, std::size_t col, std::size_t k) {
+                const std::size_t offset =
+                    g * wei_strides[0] + k * wei_strides[1] + table.GetWeightOffset(col);
+
+                WeiDataType v_wei;
+                arg.wei_element_op_(v_wei, arg.weight_.mData[offset]);
+
+                return ck::type_convert<float>(v_wei);
+            };
+
+            auto store_out = [&](std::size_t g, std::size_t row, std::size_t k, float v_acc) {
+                OutDataType v_acc_converted = ck::type_convert<OutDataType>(v_acc);
+                OutDataType& v_out =
+                    arg.output_.mData[g * out_strides[0] + k * out_strides[2] +
+                                      table.GetOutputOffset(row)];
+
+                if constexpr(NumDElementwiseTensor == 0)
+                {
+                    arg.out_element_op_(v_out, v_acc_converted);
+                }
+                else
+                {
+                    // D tensors share the output descriptor, recover the full index
+                    std::array<std::size_t, NDimSpatial + 3> idx{};
+                    idx[0]           = g;
+                    idx[2]           = k;
+                    std::size_t rest = row;
+                    for(std::size_t d = NDim; d-- > 0;)
+                    {
+                        idx[3 + d] = rest % out_lengths[3 + d];
+                        rest /= out_lengths[3 + d];
+                    }
+                    idx[1] = rest;
+
+                    std::apply(
+                        [&](auto... is) {
+                            ExecuteElementwiseOp(arg.out_element_op_,
+                                                 arg.elementwise_d_tensors_,
+                                                 Number<NumDElementwiseTensor>{},
+                                                 v_out,
+                                                 v_acc_converted,
+                                                 is...);
+                        },
+                        idx);
+                }
+            };
+
+            cpu::blocked_batched_gemm(
+                G,
+                gemm_rows.size(),
+                K,
+                table.GetNumCol(),
+                [&](std::size_t g, std::size_t m, std::size_t col) {
+                    std::size_t offset;
+                    table.GetInputOffset(gemm_rows[m], col, offset);
+
+                    return load_in(g, offset);
+                },
+                load_wei,
+                [&](std::size_t g, std::size_t m, std::size_t k, float v_acc) {
+                    store_out(g, gemm_rows[m], k, v_acc);
+                });
+
+            auto f_border = [&](auto g, auto i, auto k) {
+                const std::size_t row = border_rows[i];
+
+                float v_acc = 0;
+
+                for(std::size_t col = 0; col < table.GetNumCol(); ++col)
+                {
+                    std::size_t offset;
+                    if(table.GetInputOffset(row, col, offset))
+                        v_acc += load_in(g, offset) * load_wei(g, col, k);
+                }
+
+                store_out(g, row, k, v_acc);
+            };
+
+            make_ParallelTensorFunctor(f_border, G, border_rows.size(), K)(
+                std::thread::hardware_concurrency());
+        }
+
         float Run(const Argument& arg)
         {
             if(!(arg.input_.GetNumOfDimension() == NDimSpatial + 3 &&
@@ -126,6 +290,24 @@ struct ReferenceConvFwd : public device::BaseOperator
                 throw std::runtime_error("wrong! inconsistent dimension");
             }
 
+            if constexpr(IsFastModeSupported)
+            {
+                if(arg.mode_ != ReferenceConvFwdMode::Exact)
+                {
+                    RunFast(arg);
+
+                    return 0;
+                }
+            }
+            else
+            {
+                if(arg.mode_ == ReferenceConvFwdMode::Fast)
+                {
+                    throw std::runtime_error(
+                        "wrong! fast mode is not supported by these elementwise operations");
+                }
+            }
+
             if constexpr(NDimSpatial == 1)
             {
                 auto func = [&](auto g, auto n, auto k, auto wo) {
@@ -413,9 +595,9 @@ struct ReferenceConvFwd : public device::BaseOperator
     }
 
     static auto MakeArgument(
-        const Tensor<InDataType>& input,
-        const Tensor<WeiDataType>& weight,
-        Tensor<OutDataType>& output,
+        TensorView<const InDataType> input,
+        TensorView<const WeiDataType> weight,
+        TensorView<OutDataType> output,
         std::vector<ck::long_index_t> conv_filter_strides,
         std::vector<ck::long_index_t> conv_filter_dilations,
         std::vector<ck::long_index_t> input_left_pads,
@@ -425,7 +607,8 @@ struct ReferenceConvFwd : public device::BaseOperator
         OutElementwiseOperation out_element_op,
         const std::array<Tensor<InDataType>, NumAElementwiseTensor>& elementwise_a_tensors  = {},
         const std::array<Tensor<WeiDataType>, NumBElementwiseTensor>& elementwise_b_tensors = {},
-        const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors = {})
+        const std::array<Tensor<OutDataType>, NumDElementwiseTensor>& elementwise_d_tensors = {},
+        ReferenceConvFwdMode mode = ReferenceConvFwdMode::Default)
     {
         return Argument{input,
                         weight,
@@ -439,7 +622,8 @@ struct ReferenceConvFwd : public device::BaseOperator
                         out_element_op,
                         elementwise_a_tensors,
                         elementwise_b_tensors,
-                        elementwise_d_tensors};
+                        elementwise_d_tensors,
+                        mode};
     }
 
     static auto MakeInvoker() { return Invoker{}; }
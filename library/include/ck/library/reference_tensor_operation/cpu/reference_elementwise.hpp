@@ -5,6 +5,7 @@
 
 #include <iostream>
 #include <sstream>
+#include <thread>
 
 #include "ck/tensor_operation/gpu/element/combined_element_wise_operation.hpp"
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
@@ -39,26 +40,30 @@ struct ReferenceElementwise : public device::BaseOperator
 
         float Run(const Argument& arg)
         {
+            auto& b = arg.b_tensor_.mData;
+            const auto& a = arg.a_tensors_;
+
             if constexpr(NumATensors == 1)
             {
-                arg.b_tensor_.ForEach([&](auto& self, auto idx) {
-                    arg.element_op_(self(idx), arg.a_tensors_[0](idx));
-                });
+                arg.b_tensor_.ForEachIndex(
+                    [&](auto idx, std::size_t offset) { arg.element_op_(b[offset], a[0](idx)); },
+                    std::thread::hardware_concurrency());
             }
             else if constexpr(NumATensors == 2)
             {
-                arg.b_tensor_.ForEach([&](auto& self, auto idx) {
-                    arg.element_op_(self(idx), arg.a_tensors_[0](idx), arg.a_tensors_[1](idx));
-                });
+                arg.b_tensor_.ForEachIndex(
+                    [&](auto idx, std::size_t offset) {
+                        arg.element_op_(b[offset], a[0](idx), a[1](idx));
+                    },
+                    std::thread::hardware_concurrency());
             }
             else if constexpr(NumATensors == 3)
             {
-                arg.b_tensor_.ForEach([&](auto& self, auto idx) {
-                    arg.element_op_(self(idx),
-                                    arg.a_tensors_[0](idx),
-                                    arg.a_tensors_[1](idx),
-                                    arg.a_tensors_[2](idx));
-                });
+                arg.b_tensor_.ForEachIndex(
+                    [&](auto idx, std::size_t offset) {
+                        arg.element_op_(b[offset], a[0](idx), a[1](idx), a[2](idx));
+                    },
+                    std::thread::hardware_concurrency());
             }
             return 0;
         }
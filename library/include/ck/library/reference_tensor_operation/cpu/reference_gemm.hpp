@@ -4,11 +4,15 @@
 #pragma once
 
 #include <iostream>
+#include <optional>
 #include <sstream>
+#include <stdexcept>
 
 #include "ck/tensor_operation/gpu/element/unary_element_wise_operation.hpp"
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_view.hpp"
+#include "ck/library/reference_tensor_operation/cpu/blocked_gemm.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -25,12 +29,24 @@ template <typename ADataType,
           typename ComputeTypeB = ComputeTypeA>
 struct ReferenceGemm : public device::BaseOperator
 {
+    // version of the output in the reference cache, see ck::utils::ReferenceCacheKey
+    static constexpr int CacheVersion = 1;
+
+    // The cache-blocked CPU GEMM accumulates in float in the same k order as the scalar loop,
+    // so it is used whenever every operand type converts exactly into the float accumulator.
+    // Other ComputeType pairs keep the scalar loop below.
+    static constexpr bool UseBlockedGemm =
+        is_same_v<AccDataType, float> && cpu::is_blocked_gemm_operand_v<ADataType> &&
+        cpu::is_blocked_gemm_operand_v<BDataType> &&
+        cpu::is_blocked_gemm_operand_v<ComputeTypeA> &&
+        cpu::is_blocked_gemm_operand_v<ComputeTypeB>;
+
     // Argument
     struct Argument : public device::BaseArgument
     {
-        Argument(const Tensor<ADataType>& a_m_k,
-                 const Tensor<BDataType>& b_k_n,
-                 Tensor<CDataType>& c_m_n,
+        Argument(TensorView<const ADataType> a_m_k,
+                 TensorView<const BDataType> b_k_n,
+                 TensorView<CDataType> c_m_n,
                  AElementwiseOperation a_element_op,
                  BElementwiseOperation b_element_op,
                  CElementwiseOperation c_element_op)
@@ -43,9 +59,9 @@ struct ReferenceGemm : public device::BaseOperator
         {
         }
 
-        const Tensor<ADataType>& a_m_k_;
-        const Tensor<BDataType>& b_k_n_;
-        Tensor<CDataType>& c_m_n_;
+        TensorView<const ADataType> a_m_k_;
+        TensorView<const BDataType> b_k_n_;
+        TensorView<CDataType> c_m_n_;
 
         AElementwiseOperation a_element_op_;
         BElementwiseOperation b_element_op_;
@@ -57,37 +73,86 @@ struct ReferenceGemm : public device::BaseOperator
     {
         using Argument = ReferenceGemm::Argument;
 
+        template <typename ComputeType, typename ElementOp, typename DataType>
+        static ComputeType ApplyElementOp(const ElementOp& element_op, const DataType& x)
+        {
+            ComputeType y = 0;
+
+            // use PassThrough instead of ConvertBF16RTN for reference calculation
+            if constexpr(is_same_v<ElementOp, ck::tensor_operation::element_wise::ConvertBF16RTN>)
+            {
+                ck::tensor_operation::element_wise::PassThrough{}(y, x);
+            }
+            else
+            {
+                element_op(y, x);
+            }
+
+            return y;
+        }
+
+        // operands and result of the blocked GEMM, through the element ops
+        static float LoadBlockedA(const Argument& arg, std::size_t m, std::size_t k)
+        {
+            const auto& a_strides = arg.a_m_k_.mDesc.GetStrides();
+
+            return ck::type_convert<AccDataType>(ApplyElementOp<ComputeTypeA>(
+                arg.a_element_op_, arg.a_m_k_.mData[m * a_strides[0] + k * a_strides[1]]));
+        }
+
+        static float LoadBlockedB(const Argument& arg, std::size_t k, std::size_t n)
+        {
+            const auto& b_strides = arg.b_k_n_.mDesc.GetStrides();
+
+            return ck::type_convert<AccDataType>(ApplyElementOp<ComputeTypeB>(
+                arg.b_element_op_, arg.b_k_n_.mData[k * b_strides[0] + n * b_strides[1]]));
+        }
+
+        static void
+        StoreBlockedC(const Argument& arg, std::size_t m, std::size_t n, AccDataType v_acc)
+        {
+            const auto& c_strides = arg.c_m_n_.mDesc.GetStrides();
+
+            CDataType v_c = 0;
+
+            arg.c_element_op_(v_c, v_acc);
+
+            arg.c_m_n_.mData[m * c_strides[0] + n * c_strides[1]] = v_c;
+        }
+
+        static void RunBlocked(const Argument& arg)
+        {
+            cpu::blocked_gemm(
+                arg.c_m_n_.mDesc.GetLengths()[0],
+                arg.c_m_n_.mDesc.GetLengths()[1],
+                arg.a_m_k_.mDesc.GetLengths()[1],
+                [&](std::size_t m, std::size_t k) { return LoadBlockedA(arg, m, k); },
+                [&](std::size_t k, std::size_t n) { return LoadBlockedB(arg, k, n); },
+                [&](std::size_t m, std::size_t n, AccDataType v_acc) {
+                    StoreBlockedC(arg, m, n, v_acc);
+                });
+        }
+
         float Run(const Argument& arg)
         {
+            if constexpr(UseBlockedGemm)
+            {
+                RunBlocked(arg);
+
+                return 0;
+            }
+
             auto f_mk_kn_mn = [&](auto m, auto n) {
                 const int K = arg.a_m_k_.mDesc.GetLengths()[1];
 
                 AccDataType v_acc = 0;
-                ComputeTypeA v_a  = 0;
-                ComputeTypeB v_b  = 0;
 
                 for(int k = 0; k < K; ++k)
                 {
-                    // use PassThrough instead of ConvertBF16RTN for reference calculation
-                    if constexpr(is_same_v<AElementwiseOperation,
-                                           ck::tensor_operation::element_wise::ConvertBF16RTN>)
-                    {
-                        ck::tensor_operation::element_wise::PassThrough{}(v_a, arg.a_m_k_(m, k));
-                    }
-                    else
-                    {
-                        arg.a_element_op_(v_a, arg.a_m_k_(m, k));
-                    }
-                    // same for B matrix
-                    if constexpr(is_same_v<BElementwiseOperation,
-                                           ck::tensor_operation::element_wise::ConvertBF16RTN>)
-                    {
-                        ck::tensor_operation::element_wise::PassThrough{}(v_b, arg.b_k_n_(k, n));
-                    }
-                    else
-                    {
-                        arg.b_element_op_(v_b, arg.b_k_n_(k, n));
-                    }
+                    const auto v_a =
+                        ApplyElementOp<ComputeTypeA>(arg.a_element_op_, arg.a_m_k_(m, k));
+                    const auto v_b =
+                        ApplyElementOp<ComputeTypeB>(arg.b_element_op_, arg.b_k_n_(k, n));
 
                     v_acc +=
                         ck::type_convert<AccDataType>(v_a) * ck::type_convert<AccDataType>(v_b);
@@ -114,6 +179,116 @@ struct ReferenceGemm : public device::BaseOperator
         }
     };
 
+    // Reference of C computed slab by slab, in the form check_err_streamed() calls it:
+    //   Run(c_slab, dim, begin, end)
+    // writes rows [begin, end) of C into c_slab for dim 0 and columns [begin, end) for dim 1.
+    // The operand all slabs share, B for rows and A for columns, is converted and packed by the
+    // blocked GEMM once, on the first slab, and reused for the others; column slabs are computed
+    // as slabs of C^T = B^T A^T, which sums every element in the same k order.
+    class SlabInvoker
+    {
+        public:
+        SlabInvoker(TensorView<const ADataType> a_m_k,
+                    TensorView<const BDataType> b_k_n,
+                    AElementwiseOperation a_element_op,
+                    BElementwiseOperation b_element_op,
+                    CElementwiseOperation c_element_op)
+            : a_m_k_{a_m_k},
+              b_k_n_{b_k_n},
+              a_element_op_{a_element_op},
+              b_element_op_{b_element_op},
+              c_element_op_{c_element_op}
+        {
+        }
+
+        void Run(TensorView<CDataType> c_slab, std::size_t dim, std::size_t begin, std::size_t end)
+        {
+            if(dim > 1)
+                throw std::runtime_error("wrong! a GEMM slab is rows or columns of C");
+
+            if constexpr(UseBlockedGemm)
+            {
+                RunBlocked(Argument{a_m_k_,
+                                    b_k_n_,
+                                    c_slab,
+                                    a_element_op_,
+                                    b_element_op_,
+                                    c_element_op_},
+                           dim,
+                           begin,
+                           end);
+            }
+            else
+            {
+                Invoker{}.Run(Argument{dim == 0 ? a_m_k_.Slice(0, begin, end) : a_m_k_,
+                                       dim == 1 ? b_k_n_.Slice(1, begin, end) : b_k_n_,
+                                       c_slab,
+                                       a_element_op_,
+                                       b_element_op_,
+                                       c_element_op_});
+            }
+        }
+
+        private:
+        void RunBlocked(const Argument& arg, std::size_t dim, std::size_t begin, std::size_t end)
+        {
+            const std::size_t M = a_m_k_.mDesc.GetLengths()[0];
+            const std::size_t N = b_k_n_.mDesc.GetLengths()[1];
+            const std::size_t K = a_m_k_.mDesc.GetLengths()[1];
+
+            if(!packed_ || packed_dim_ != dim)
+            {
+                if(dim == 0)
+                    packed_.emplace(1, N, K, [&](std::size_t, std::size_t k, std::size_t n) {
+                        return Invoker::LoadBlockedB(arg, k, n);
+                    });
+                else
+                    packed_.emplace(1, M, K, [&](std::size_t, std::size_t k, std::size_t m) {
+                        return Invoker::LoadBlockedA(arg, m, k);
+                    });
+
+                packed_dim_ = dim;
+            }
+
+            const auto b_batch = [](std::size_t) { return std::size_t{0}; };
+
+            if(dim == 0)
+                cpu::blocked_batched_gemm(
+                    1,
+                    end - begin,
+                    *packed_,
+                    b_batch,
+                    [&](std::size_t, std::size_t m, std::size_t k) {
+                        return Invoker::LoadBlockedA(arg, begin + m, k);
+                    },
+                    [&](std::size_t, std::size_t m, std::size_t n, AccDataType v_acc) {
+                        Invoker::StoreBlockedC(arg, m, n, v_acc);
+                    });
+            else
+                cpu::blocked_batched_gemm(
+                    1,
+                    end - begin,
+                    *packed_,
+                    b_batch,
+                    [&](std::size_t, std::size_t n, std::size_t k) {
+                        return Invoker::LoadBlockedB(arg, k, begin + n);
+                    },
+                    [&](std::size_t, std::size_t n, std::size_t m, AccDataType v_acc) {
+                        Invoker::StoreBlockedC(arg, m, n, v_acc);
+                    });
+        }
+
+        TensorView<const ADataType> a_m_k_;
+        TensorView<const BDataType> b_k_n_;
+
+        AElementwiseOperation a_element_op_;
+        BElementwiseOperation b_element_op_;
+        CElementwiseOperation c_element_op_;
+
+        std::optional<cpu::BlockedGemmPackedB> packed_;
+        std::size_t packed_dim_ = 0;
+    };
+
     static constexpr bool IsValidCompilationParameter()
     {
         // TODO: properly implement this check
@@ -122,9 +297,9 @@ struct ReferenceGemm : public device::BaseOperator
 
     bool IsSupportedArgument(const device::BaseArgument*) override { return true; }
 
-    static auto MakeArgument(const Tensor<ADataType>& a_m_k,
-                             const Tensor<BDataType>& b_k_n,
-                             Tensor<CDataType>& c_m_n,
+    static auto MakeArgument(TensorView<const ADataType> a_m_k,
+                             TensorView<const BDataType> b_k_n,
+                             TensorView<CDataType> c_m_n,
                              AElementwiseOperation a_element_op,
                              BElementwiseOperation b_element_op,
                              CElementwiseOperation c_element_op)
@@ -134,6 +309,15 @@ struct ReferenceGemm : public device::BaseOperator
 
     static auto MakeInvoker() { return Invoker{}; }
 
+    static auto MakeSlabInvoker(TensorView<const ADataType> a_m_k,
+                                TensorView<const BDataType> b_k_n,
+                                AElementwiseOperation a_element_op,
+                                BElementwiseOperation b_element_op,
+                                CElementwiseOperation c_element_op)
+    {
+        return SlabInvoker{a_m_k, b_k_n, a_element_op, b_element_op, c_element_op};
+    }
+
     virtual std::unique_ptr<device::BaseInvoker> MakeInvokerPointer()
     {
         return std::make_unique<Invoker>(Invoker{});
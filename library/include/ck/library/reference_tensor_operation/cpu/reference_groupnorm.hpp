@@ -11,6 +11,7 @@
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/normalization_engine.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -53,9 +54,9 @@ struct ReferenceGroupnorm : public device::BaseOperator
         {
         }
 
-        const Tensor<XDataType> x_;
-        const Tensor<XDataType> gamma_;
-        const Tensor<XDataType> beta_;
+        const Tensor<XDataType>& x_;
+        const Tensor<GammaDataType>& gamma_;
+        const Tensor<BetaDataType>& beta_;
         Tensor<YDataType>& y_;
         Tensor<SaveMeanInvStdDataType>& save_mean_;
         Tensor<SaveMeanInvStdDataType>& save_inv_std_;
@@ -69,84 +70,18 @@ struct ReferenceGroupnorm : public device::BaseOperator
     {
         float Run(const Argument& arg)
         {
-            int N = arg.lengths_[0];
-            int H = arg.lengths_[1];
-            int W = arg.lengths_[2];
-            int G = arg.lengths_[3];
-            int C = arg.lengths_[4];
-
-            Tensor<ComputeDataType> mean({N, G});
-            Tensor<ComputeDataType> var({N, G});
-
-            // Compute mean & var in [H, W, C] by Welford Algorithm
-            // TODO - parallel for each HWC
-            // TODO - address calculation
-            for(int n = 0; n < N; ++n)
-            {
-                for(int g = 0; g < G; ++g)
-                {
-                    ComputeDataType mean_val = type_convert<ComputeDataType>(0.0f);
-                    ComputeDataType var_val  = type_convert<ComputeDataType>(0.0f);
-                    int32_t curr_count       = 0;
-
-                    for(int h = 0; h < H; ++h)
-                    {
-                        for(int w = 0; w < W; ++w)
-                        {
-                            for(int c = 0; c < C; ++c)
-                            {
-                                curr_count++;
-                                ComputeDataType x =
-                                    type_convert<ComputeDataType>(arg.x_(n, h, w, g, c));
-                                ComputeDataType delta = x - mean_val;
-                                mean_val += delta / curr_count;
-                                ComputeDataType delta2 = x - mean_val;
-                                var_val += delta * delta2;
-                            }
-                        }
-                    }
-
-                    mean(n, g) = mean_val;
-                    var(n, g)  = var_val / curr_count;
-
-                    arg.save_mean_(n, g) = ck::type_convert<SaveMeanInvStdDataType>(mean(n, g));
-
-                    ComputeDataType divisor =
-                        static_cast<ComputeDataType>(1) / ck::math::sqrt(var(n, g) + arg.epsilon_);
-                    arg.save_inv_std_(n, g) = ck::type_convert<SaveMeanInvStdDataType>(divisor);
-                }
-            }
-
-            // Normalization
-            for(int n = 0; n < N; ++n)
-            {
-                for(int h = 0; h < H; ++h)
-                {
-                    for(int w = 0; w < W; ++w)
-                    {
-                        for(int g = 0; g < G; ++g)
-                        {
-                            for(int c = 0; c < C; ++c)
-                            {
-                                ComputeDataType x =
-                                    type_convert<ComputeDataType>(arg.x_(n, h, w, g, c));
-                                ComputeDataType gamma =
-                                    type_convert<ComputeDataType>(arg.gamma_(g, c));
-                                ComputeDataType beta =
-                                    type_convert<ComputeDataType>(arg.beta_(g, c));
-                                ComputeDataType mean_val =
-                                    type_convert<ComputeDataType>(mean(n, g));
-                                ComputeDataType var_val = type_convert<ComputeDataType>(var(n, g));
-                                ComputeDataType y       = gamma * (x - mean_val) /
-                                                        ck::math::sqrt(arg.epsilon_ + var_val) +
-                                                    beta;
-                                arg.y_elementwise_op_(y, y);
-                                arg.y_(n, h, w, g, c) = type_convert<YDataType>(y);
-                            }
-                        }
-                    }
-                }
-            }
+            // reduce [H, W, C] of x [N, H, W, G, C], gamma and beta are [G, C], mean and var [N, G]
+            cpu::normalization_forward(arg.x_,
+                                       arg.gamma_,
+                                       arg.beta_,
+                                       arg.y_,
+                                       arg.save_mean_,
+                                       arg.save_inv_std_,
+                                       arg.y_elementwise_op_,
+                                       {1, 2, 4},
+                                       {3, 4},
+                                       {0, 3},
+                                       arg.epsilon_);
 
             return 0;
         }
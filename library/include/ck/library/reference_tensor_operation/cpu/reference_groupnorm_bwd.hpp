@@ -11,6 +11,7 @@
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/normalization_engine.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -91,82 +92,25 @@ struct ReferenceGroupnormBwd : public device::BaseOperator
     {
         float Run(const Argument& arg)
         {
-            int N = arg.lengths_[0];
-            int H = arg.lengths_[1];
-            int W = arg.lengths_[2];
-            int G = arg.lengths_[3];
-            int C = arg.lengths_[4];
-
-            // Calculate dgamma and dbeta
-            for(int g = 0; g < G; ++g)
-                for(int c = 0; c < C; ++c)
-                {
-                    ComputeDataType dgamma = 0;
-                    ComputeDataType dbeta  = 0;
-
-                    for(int n = 0; n < N; ++n)
-                        for(int h = 0; h < H; ++h)
-                            for(int w = 0; w < W; ++w)
-                            {
-                                ComputeDataType dy =
-                                    ck::type_convert<ComputeDataType>(arg.dy_nhwgc_(n, h, w, g, c));
-                                ComputeDataType x =
-                                    ck::type_convert<ComputeDataType>(arg.x_nhwgc_(n, h, w, g, c));
-                                ComputeDataType mean =
-                                    ck::type_convert<ComputeDataType>(arg.mean_ng_(n, g));
-                                ComputeDataType rstd =
-                                    ck::type_convert<ComputeDataType>(arg.inv_std_ng_(n, g));
-                                dgamma += dy * rstd * (x - mean);
-                                dbeta += dy;
-                            }
-                    arg.dgamma_gc_(g, c) = ck::type_convert<DGammaDataType>(dgamma);
-                    arg.dbeta_gc_(g, c)  = ck::type_convert<DBetaDataType>(dbeta);
-                }
-
-            // Calculate dx
-            int reduce_size = H * W * C;
-            for(int n = 0; n < N; ++n)
-                for(int g = 0; g < G; ++g)
-                {
-                    ComputeDataType ds = 0;
-                    ComputeDataType db = 0;
-
-                    ComputeDataType mean = ck::type_convert<ComputeDataType>(arg.mean_ng_(n, g));
-                    ComputeDataType rstd = ck::type_convert<ComputeDataType>(arg.inv_std_ng_(n, g));
-
-                    for(int h = 0; h < H; ++h)
-                        for(int w = 0; w < W; ++w)
-                            for(int c = 0; c < C; ++c)
-                            {
-                                ComputeDataType dy =
-                                    ck::type_convert<ComputeDataType>(arg.dy_nhwgc_(n, h, w, g, c));
-                                ComputeDataType x =
-                                    ck::type_convert<ComputeDataType>(arg.x_nhwgc_(n, h, w, g, c));
-                                ComputeDataType gamma =
-                                    ck::type_convert<ComputeDataType>(arg.gamma_gc_(g, c));
-
-                                ds += dy * gamma * x;
-                                db += dy * gamma;
-                            }
-
-                    for(int h = 0; h < H; ++h)
-                        for(int w = 0; w < W; ++w)
-                            for(int c = 0; c < C; ++c)
-                            {
-                                ComputeDataType dy =
-                                    ck::type_convert<ComputeDataType>(arg.dy_nhwgc_(n, h, w, g, c));
-                                ComputeDataType x =
-                                    ck::type_convert<ComputeDataType>(arg.x_nhwgc_(n, h, w, g, c));
-                                ComputeDataType gamma =
-                                    ck::type_convert<ComputeDataType>(arg.gamma_gc_(g, c));
-
-                                ComputeDataType b =
-                                    (db * mean - ds) * rstd * rstd * rstd / reduce_size;
-                                ComputeDataType c1 = -b * mean - db * rstd / reduce_size;
-                                arg.dx_nhwgc_(n, h, w, g, c) =
-                                    ck::type_convert<DXDataType>(dy * gamma * rstd + b * x + c1);
-                            }
-                }
+            // x = [N, H, W, G, C], gamma = [G, C], mean and inv_std = [N, G]
+            cpu::normalization_backward_gamma_beta<ComputeDataType>(arg.dy_nhwgc_,
+                                                                    arg.x_nhwgc_,
+                                                                    arg.mean_ng_,
+                                                                    arg.inv_std_ng_,
+                                                                    arg.dgamma_gc_,
+                                                                    arg.dbeta_gc_,
+                                                                    {3, 4},
+                                                                    {0, 3});
+
+            cpu::normalization_backward_data<ComputeDataType>(arg.dy_nhwgc_,
+                                                              arg.x_nhwgc_,
+                                                              arg.gamma_gc_,
+                                                              arg.mean_ng_,
+                                                              arg.inv_std_ng_,
+                                                              arg.dx_nhwgc_,
+                                                              {1, 2, 4},
+                                                              {3, 4},
+                                                              {0, 3});
 
             return 0;
         }
@@ -11,6 +11,7 @@
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/normalization_engine.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -57,9 +58,9 @@ struct ReferenceLayernorm : public device::BaseOperator
         {
         }
 
-        const Tensor<XDataType> x_m_n_;
-        const Tensor<XDataType> gamma_n_;
-        const Tensor<XDataType> beta_n_;
+        const Tensor<XDataType>& x_m_n_;
+        const Tensor<GammaDataType>& gamma_n_;
+        const Tensor<BetaDataType>& beta_n_;
         Tensor<YDataType>& y_m_n_;
         Tensor<SaveMeanInvStdDataType>& save_mean_m_;
         Tensor<SaveMeanInvStdDataType>& save_inv_std_m_;
@@ -72,113 +73,26 @@ struct ReferenceLayernorm : public device::BaseOperator
     // Invoker
     struct Invoker : public device::BaseInvoker
     {
-        float Run2D(const Argument& arg)
-        {
-            int M = arg.lengths_[0];
-            int N = arg.lengths_[1];
-
-            Tensor<ComputeDataType> mean({M});
-            Tensor<ComputeDataType> var({M});
-
-            for(int m = 0; m < M; ++m)
-            {
-                mean(m) = 0;
-                var(m)  = 0;
-
-                for(int n = 0; n < N; ++n)
-                {
-                    auto x_val = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
-                    mean(m) += x_val;
-                    var(m) += x_val * x_val;
-                }
-
-                mean(m) = mean(m) / N;
-                var(m)  = (var(m) / N) - (mean(m) * mean(m));
-            }
-
-            for(int m = 0; m < M; ++m)
-            {
-                ComputeDataType divisor =
-                    static_cast<ComputeDataType>(1) / ck::math::sqrt(var(m) + arg.epsilon_);
-
-                for(int n = 0; n < N; ++n)
-                {
-                    auto x_val     = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
-                    auto gamma_val = ck::type_convert<ComputeDataType>(arg.gamma_n_(n));
-                    auto beta_val  = ck::type_convert<ComputeDataType>(arg.beta_n_(n));
-                    auto y_val     = (x_val - mean(m)) * divisor;
-                    y_val          = (y_val * gamma_val) + beta_val;
-                    arg.y_elementwise_op_(y_val, y_val);
-                    arg.y_m_n_(m, n) = ck::type_convert<YDataType>(y_val);
-                }
-                arg.save_mean_m_(m)    = ck::type_convert<SaveMeanInvStdDataType>(mean(m));
-                arg.save_inv_std_m_(m) = ck::type_convert<SaveMeanInvStdDataType>(divisor);
-            }
-
-            return 0;
-        }
-
-        float Run4D(const Argument& arg)
-        {
-            int N = arg.lengths_[0];
-            int H = arg.lengths_[1];
-            int W = arg.lengths_[2];
-            int C = arg.lengths_[3];
-
-            Tensor<ComputeDataType> mean({N});
-            Tensor<ComputeDataType> var({N});
-
-            int reduce_length = H * W * C;
-
-            for(int n = 0; n < N; ++n)
-            {
-                mean(n) = 0;
-                var(n)  = 0;
-
-                for(int h = 0; h < H; ++h)
-                    for(int w = 0; w < W; ++w)
-                        for(int c = 0; c < C; ++c)
-                        {
-                            auto x_val = ck::type_convert<ComputeDataType>(arg.x_m_n_(n, h, w, c));
-                            mean(n) += x_val;
-                            var(n) += x_val * x_val;
-                        }
-
-                mean(n) = mean(n) / reduce_length;
-                var(n)  = (var(n) / reduce_length) - (mean(n) * mean(n));
-            }
-
-            for(int n = 0; n < N; ++n)
-            {
-                ComputeDataType divisor =
-                    static_cast<ComputeDataType>(1) / ck::math::sqrt(var(n) + arg.epsilon_);
-
-                for(int h = 0; h < H; ++h)
-                    for(int w = 0; w < W; ++w)
-                        for(int c = 0; c < C; ++c)
-                        {
-                            auto x_val = ck::type_convert<ComputeDataType>(arg.x_m_n_(n, h, w, c));
-                            auto gamma_val =
-                                ck::type_convert<ComputeDataType>(arg.gamma_n_(h, w, c));
-                            auto beta_val = ck::type_convert<ComputeDataType>(arg.beta_n_(h, w, c));
-                            auto y_val    = (x_val - mean(n)) * divisor;
-                            y_val         = (y_val * gamma_val) + beta_val;
-                            arg.y_elementwise_op_(y_val, y_val);
-                            arg.y_m_n_(n, h, w, c) = ck::type_convert<YDataType>(y_val);
-                        }
-                arg.save_mean_m_(n)    = ck::type_convert<SaveMeanInvStdDataType>(mean(n));
-                arg.save_inv_std_m_(n) = ck::type_convert<SaveMeanInvStdDataType>(divisor);
-            }
-
-            return 0;
-        }
-
         float Run(const Argument& arg)
         {
-            if(arg.lengths_.size() == 2)
-                return Run2D(arg);
-            else if(arg.lengths_.size() == 4)
-                return Run4D(arg);
+            // gamma and beta span the reduce dims, the saved mean and inv_std all other dims
+            std::vector<std::size_t> reduce_dims(arg.reduceDims_.begin(), arg.reduceDims_.end());
+            std::sort(reduce_dims.begin(), reduce_dims.end());
+
+            const auto mean_dims =
+                cpu::get_normalization_complement(arg.x_m_n_.GetNumOfDimension(), reduce_dims);
+
+            cpu::normalization_forward(arg.x_m_n_,
+                                       arg.gamma_n_,
+                                       arg.beta_n_,
+                                       arg.y_m_n_,
+                                       arg.save_mean_m_,
+                                       arg.save_inv_std_m_,
+                                       arg.y_elementwise_op_,
+                                       reduce_dims,
+                                       reduce_dims,
+                                       mean_dims,
+                                       arg.epsilon_);
 
             return 0;
         }
@@ -11,6 +11,7 @@
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/normalization_engine.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -90,59 +91,25 @@ struct ReferenceLayernormBwd : public device::BaseOperator
     {
         float Run(const Argument& arg)
         {
-            int M = arg.lengths_[0];
-            int N = arg.lengths_[1];
-
-            // Calculate dgamma and dbeta
-            for(int n = 0; n < N; ++n)
-            {
-                ComputeDataType dgamma = 0;
-                ComputeDataType dbeta  = 0;
-
-                for(int m = 0; m < M; ++m)
-                {
-                    ComputeDataType dy   = ck::type_convert<ComputeDataType>(arg.dy_m_n_(m, n));
-                    ComputeDataType x    = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
-                    ComputeDataType mean = ck::type_convert<ComputeDataType>(arg.mean_m_(m));
-                    ComputeDataType rstd = ck::type_convert<ComputeDataType>(arg.inv_std_m_(m));
-                    dgamma += dy * rstd * (x - mean);
-                    dbeta += dy;
-                }
-                arg.dgamma_n_(n) = ck::type_convert<DGammaDataType>(dgamma);
-                arg.dbeta_n_(n)  = ck::type_convert<DBetaDataType>(dbeta);
-            }
-
-            // Calculate dx
-            for(int m = 0; m < M; ++m)
-            {
-                ComputeDataType ds = 0;
-                ComputeDataType db = 0;
-
-                ComputeDataType mean = ck::type_convert<ComputeDataType>(arg.mean_m_(m));
-                ComputeDataType rstd = ck::type_convert<ComputeDataType>(arg.inv_std_m_(m));
-
-                for(int n = 0; n < N; ++n)
-                {
-                    ComputeDataType dy    = ck::type_convert<ComputeDataType>(arg.dy_m_n_(m, n));
-                    ComputeDataType x     = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
-                    ComputeDataType gamma = ck::type_convert<ComputeDataType>(arg.gamma_n_(n));
-
-                    ds += dy * gamma * x;
-                    db += dy * gamma;
-                }
-
-                for(int n = 0; n < N; ++n)
-                {
-                    ComputeDataType dy    = ck::type_convert<ComputeDataType>(arg.dy_m_n_(m, n));
-                    ComputeDataType x     = ck::type_convert<ComputeDataType>(arg.x_m_n_(m, n));
-                    ComputeDataType gamma = ck::type_convert<ComputeDataType>(arg.gamma_n_(n));
-
-                    ComputeDataType b = (db * mean - ds) * rstd * rstd * rstd / N;
-                    ComputeDataType c = -b * mean - db * rstd / N;
-
-                    arg.dx_m_n_(m, n) = ck::type_convert<DXDataType>(dy * gamma * rstd + b * x + c);
-                }
-            }
+            // x = [M, N], gamma = [N], mean and inv_std = [M]
+            cpu::normalization_backward_gamma_beta<ComputeDataType>(arg.dy_m_n_,
+                                                                    arg.x_m_n_,
+                                                                    arg.mean_m_,
+                                                                    arg.inv_std_m_,
+                                                                    arg.dgamma_n_,
+                                                                    arg.dbeta_n_,
+                                                                    {1},
+                                                                    {0});
+
+            cpu::normalization_backward_data<ComputeDataType>(arg.dy_m_n_,
+                                                              arg.x_m_n_,
+                                                              arg.gamma_n_,
+                                                              arg.mean_m_,
+                                                              arg.inv_std_m_,
+                                                              arg.dx_m_n_,
+                                                              {1},
+                                                              {1},
+                                                              {0});
 
             return 0;
         }
@@ -7,10 +7,14 @@
 #include <sstream>
 #include <vector>
 #include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
 
 #include "ck/tensor_operation/gpu/device/device_base.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck_tile/host/host_thread_pool.hpp"
 
 namespace ck {
 namespace tensor_operation {
@@ -54,77 +58,173 @@ struct ReferenceSoftmax : public device::BaseOperator
     };
 
     // Invoker
+    //
+    // The dims are split once into invariant and reduce dims, and the offsets of all reduce
+    // indices are tabulated, so the loops only add precomputed offsets. Every invariant row is
+    // reduced in a single pass with an online max and rescaled sum, then written in a second
+    // pass; rows run in parallel on the host thread pool. When there are fewer rows than
+    // threads, e.g. when all dims are reduced, each row is split into chunks whose partial
+    // max/sum are merged in order, so the result does not depend on the number of threads.
     struct Invoker : public device::BaseInvoker
     {
-        float Run(const Argument& arg)
+        // reduce indices per chunk of a row that is split across threads
+        static constexpr std::size_t kReduceChunk = 1 << 14;
+
+        // running max and sum of exp(x - max)
+        struct MaxSum
         {
-            std::vector<size_t> scalar_lengths;
-            for(index_t dim : arg.sm_scalar_dims_)
+            AccDataType max_ = std::numeric_limits<AccDataType>::lowest();
+            AccDataType sum_ = 0;
+
+            void Add(AccDataType x)
+            {
+                if(x > max_)
+                {
+                    sum_ = sum_ * std::exp(max_ - x) + AccDataType{1};
+                    max_ = x;
+                }
+                else
+                {
+                    sum_ += std::exp(x - max_);
+                }
+            }
+
+            void Merge(const MaxSum& other)
             {
-                scalar_lengths.push_back(arg.in_.mDesc.GetLengths()[dim]);
+                const AccDataType max = std::max(max_, other.max_);
+                sum_ = sum_ * std::exp(max_ - max) + other.sum_ * std::exp(other.max_ - max);
+                max_ = max;
             }
-            // max and sum reduction with final reduced values of dim=0 is a scalar so give it
-            // appropriate lengths of {1}
-            if(arg.sm_scalar_dims_.size() == 0)
+        };
+
+        float Run(const Argument& arg)
+        {
+            const auto& lengths     = arg.in_.mDesc.GetLengths();
+            const auto& in_strides  = arg.in_.mDesc.GetStrides();
+            const auto& out_strides = arg.out_.mDesc.GetStrides();
+
+            std::vector<index_t> reduce_dims = arg.sm_reduce_dims_;
+            std::sort(reduce_dims.begin(), reduce_dims.end());
+
+            std::size_t num_row = 1;
+            for(index_t dim : arg.sm_scalar_dims_)
+                num_row *= lengths[dim];
+
+            std::size_t row_size = 1;
+            for(index_t dim : reduce_dims)
+                row_size *= lengths[dim];
+
+            // offsets of the reduce indices within a row, in row-major order of the reduce dims
+            std::vector<std::size_t> in_offsets(row_size);
+            std::vector<std::size_t> out_offsets(row_size);
+            for(std::size_t r = 0; r < row_size; ++r)
             {
-                scalar_lengths.push_back(1);
+                std::size_t rest       = r;
+                std::size_t in_offset  = 0;
+                std::size_t out_offset = 0;
+                for(auto dim = reduce_dims.rbegin(); dim != reduce_dims.rend(); ++dim)
+                {
+                    const std::size_t i = rest % lengths[*dim];
+                    rest /= lengths[*dim];
+
+                    in_offset += i * in_strides[*dim];
+                    out_offset += i * out_strides[*dim];
+                }
+                in_offsets[r]  = in_offset;
+                out_offsets[r] = out_offset;
             }
 
-            Tensor<AccDataType> reduce_max(scalar_lengths);
-            reduce_max.GenerateTensorValue(
-                GeneratorTensor_1<AccDataType>{std::numeric_limits<AccDataType>::lowest()});
-            Tensor<AccDataType> reduce_sum(scalar_lengths);
-            reduce_sum.GenerateTensorValue(GeneratorTensor_1<AccDataType>{0});
-
-            // when final reduced values is of dim=0, the index will be transformed into empty
-            // std::vector which is actually a valid input for Tensor::operator(std::vector) and
-            // internally accesses 0'th element
-            auto to_sm_scalar_idx = [&](auto idx) {
-                std::vector<size_t> sm_scalar_idx;
-                for(index_t dim : arg.sm_scalar_dims_)
+            const InDataType* p_in = arg.in_.mData.data();
+            OutDataType* p_out     = arg.out_.mData.data();
+
+            auto get_row_bases = [&](std::size_t row) {
+                std::size_t in_base  = 0;
+                std::size_t out_base = 0;
+                for(auto dim = arg.sm_scalar_dims_.rbegin(); dim != arg.sm_scalar_dims_.rend();
+                    ++dim)
                 {
-                    sm_scalar_idx.push_back(idx[dim]);
+                    const std::size_t i = row % lengths[*dim];
+                    row /= lengths[*dim];
+
+                    in_base += i * in_strides[*dim];
+                    out_base += i * out_strides[*dim];
                 }
-                return sm_scalar_idx;
+                return std::make_pair(in_base, out_base);
+            };
+
+            auto reduce = [&](std::size_t in_base, std::size_t begin, std::size_t end) {
+                MaxSum max_sum;
+                for(std::size_t r = begin; r < end; ++r)
+                    max_sum.Add(ck::type_convert<AccDataType>(p_in[in_base + in_offsets[r]]));
+                return max_sum;
             };
 
-            arg.in_.ForEach([&](auto& self, auto idx) {
-                reduce_max(to_sm_scalar_idx(idx)) = std::max(
-                    reduce_max(to_sm_scalar_idx(idx)), ck::type_convert<AccDataType>(self(idx)));
-            });
-
-            // LogRangeAsType<float>(std::cout << "reduce_max: ", reduce_max.mData, ",") <<
-            // std::endl;
-
-            Tensor<AccDataType> in_stable(arg.in_.mDesc);
-            in_stable.ForEach([&](auto& self, auto idx) {
-                // numerator = exp(x - max(x))
-                self(idx) = std::exp(ck::type_convert<AccDataType>(arg.in_(idx)) -
-                                     reduce_max(to_sm_scalar_idx(idx)));
-            });
-
-            // LogRangeAsType<float>(std::cout << "in_stable: ", in_stable.mData, ",") << std::endl;
-
-            in_stable.ForEach([&](auto& self, auto idx) {
-                // denominator = sum(exp(x - max(x)))
-                reduce_sum(to_sm_scalar_idx(idx)) += self(idx);
-            });
-
-            // LogRangeAsType<float>(std::cout << "reduce_sum: ", reduce_sum.mData, ",") <<
-            // std::endl;
-
-            arg.out_.ForEach([&](auto& self, auto idx) {
-                AccDataType temp_result =
-                    arg.alpha_ * in_stable(idx) / reduce_sum(to_sm_scalar_idx(idx)) +
-                    arg.beta_ * self(idx);
-                self(idx) = ck::type_convert<OutDataType>(temp_result);
-            });
-
-            // LogRangeAsType<float>(std::cout << "out: ", arg.out_.mData, ",") << std::endl;
-            // reduction along reduce dims
-            // LogRangeAsType<float>(std::cout << "reduce_max: ", reduce_max.mData, ",") <<
-            // std::endl; LogRangeAsType<float>(std::cout << "reduce_sum: ", reduce_sum.mData, ",")
-            // << std::endl;
+            auto normalize = [&](std::size_t in_base,
+                                 std::size_t out_base,
+                                 const MaxSum& max_sum,
+                                 std::size_t begin,
+                                 std::size_t end) {
+                for(std::size_t r = begin; r < end; ++r)
+                {
+                    const auto x   = ck::type_convert<AccDataType>(p_in[in_base + in_offsets[r]]);
+                    OutDataType& y = p_out[out_base + out_offsets[r]];
+
+                    // alpha * exp(x - max(x)) / sum(exp(x - max(x))) + beta * y
+                    const AccDataType result =
+                        arg.alpha_ * std::exp(x - max_sum.max_) / max_sum.sum_ +
+                        arg.beta_ * ck::type_convert<AccDataType>(y);
+                    y = ck::type_convert<OutDataType>(result);
+                }
+            };
+
+            auto& pool = ck_tile::HostThreadPool::instance();
+
+            if(num_row >= pool.size() || row_size < 2 * kReduceChunk)
+            {
+                pool.parallel_for(num_row, [&](std::size_t begin, std::size_t end) {
+                    for(std::size_t row = begin; row < end; ++row)
+                    {
+                        const auto [in_base, out_base] = get_row_bases(row);
+
+                        // the same chunks as below, so the result does not depend on the path
+                        MaxSum max_sum;
+                        for(std::size_t r = 0; r < row_size; r += kReduceChunk)
+                            max_sum.Merge(
+                                reduce(in_base, r, std::min(r + kReduceChunk, row_size)));
+
+                        normalize(in_base, out_base, max_sum, 0, row_size);
+                    }
+                });
+
+                return 0;
+            }
+
+            const std::size_t num_chunk = (row_size + kReduceChunk - 1) / kReduceChunk;
+            std::vector<MaxSum> partial(num_chunk);
+
+            for(std::size_t row = 0; row < num_row; ++row)
+            {
+                const auto [in_base, out_base] = get_row_bases(row);
+
+                pool.parallel_for(num_chunk, [&](std::size_t begin, std::size_t end) {
+                    for(std::size_t c = begin; c < end; ++c)
+                        partial[c] = reduce(in_base,
+                                            c * kReduceChunk,
+                                            std::min((c + 1) * kReduceChunk, row_size));
+                });
+
+                MaxSum max_sum;
+                for(const auto& p : partial)
+                    max_sum.Merge(p);
+
+                pool.parallel_for(num_chunk, [&](std::size_t begin, std::size_t end) {
+                    normalize(in_base,
+                              out_base,
+                              max_sum,
+                              begin * kReduceChunk,
+                              std::min(end * kReduceChunk, row_size));
+                });
+            }
 
             return 0;
         }
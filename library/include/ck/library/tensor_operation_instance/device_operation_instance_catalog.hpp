@@ -0,0 +1,235 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_gemm_instance_descriptor.hpp"
+#include "ck/tensor_operation/gpu/device/device_instance_id.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+// an instance of BaseOp that is not constructed yet: its static descriptor and its factory
+template <typename BaseOp>
+struct DeviceOperationInstanceEntry
+{
+    DeviceGemmInstanceDescriptor descriptor_;
+    std::unique_ptr<BaseOp> (*make_instance_)() = nullptr;
+
+    // canonical text of the template parameters, nullptr if the instance has none
+    std::string (*get_instance_key_)() = nullptr;
+};
+
+namespace detail {
+
+template <typename Op, typename = void>
+struct has_instance_key : std::false_type
+{
+};
+
+template <typename Op>
+struct has_instance_key<Op, std::void_t<decltype(Op::GetInstanceKey())>> : std::true_type
+{
+};
+
+template <typename BaseOp, typename NewOpInstances, std::size_t... Is>
+void add_device_operation_instance_entries(
+    std::vector<DeviceOperationInstanceEntry<BaseOp>>& entries,
+    const NewOpInstances&,
+    std::index_sequence<Is...>)
+{
+    (
+        [&] {
+            using NewOpInstance = std::tuple_element_t<Is, NewOpInstances>;
+
+            static_assert(std::is_base_of_v<BaseOp, NewOpInstance>,
+                          "wrong! NewOpInstance should be derived from BaseOp");
+
+            DeviceOperationInstanceEntry<BaseOp> entry;
+
+            entry.descriptor_    = NewOpInstance::GetInstanceDescriptor();
+            entry.make_instance_ = []() -> std::unique_ptr<BaseOp> {
+                return std::make_unique<NewOpInstance>();
+            };
+
+            if constexpr(has_instance_key<NewOpInstance>::value)
+                entry.get_instance_key_ = &NewOpInstance::GetInstanceKey;
+
+            entries.push_back(entry);
+        }(),
+        ...);
+}
+
+} // namespace detail
+
+// The lazy counterpart of add_device_operation_instances(): an entry per instance of
+// new_op_instances, in the same order. Only the type of the tuple is used; no instance is
+// copied to the heap.
+template <typename BaseOp, typename NewOpInstances>
+void add_device_operation_instance_entries(
+    std::vector<DeviceOperationInstanceEntry<BaseOp>>& entries,
+    const NewOpInstances& new_op_instances)
+{
+    detail::add_device_operation_instance_entries(
+        entries,
+        new_op_instances,
+        std::make_index_sequence<std::tuple_size_v<NewOpInstances>>{});
+}
+
+namespace detail {
+
+template <typename BaseOp>
+void add_instance_entries(void (*add_entries)(std::vector<DeviceOperationInstanceEntry<BaseOp>>&),
+                          void* entries)
+{
+    add_entries(*static_cast<std::vector<DeviceOperationInstanceEntry<BaseOp>>*>(entries));
+}
+
+} // namespace detail
+
+// Instances of a device op, indexed by their static descriptors.
+//
+// Selecting instances only reads descriptors; only the instances asked for are constructed.
+// Instance i of the catalog is instance i of DeviceOperationInstanceFactory::GetInstances().
+template <typename BaseOp>
+class DeviceOperationInstanceCatalog
+{
+    public:
+    using Entry = DeviceOperationInstanceEntry<BaseOp>;
+
+    DeviceOperationInstanceCatalog() = default;
+
+    explicit DeviceOperationInstanceCatalog(std::vector<Entry> entries)
+        : entries_(std::move(entries))
+    {
+    }
+
+    std::size_t GetNumInstance() const { return entries_.size(); }
+
+    const DeviceGemmInstanceDescriptor& GetDescriptor(std::size_t i) const
+    {
+        return entries_.at(i).descriptor_;
+    }
+
+    // indices of the instances whose descriptor satisfies predicate, in catalog order
+    template <typename Predicate>
+    std::vector<std::size_t> Select(Predicate&& predicate) const
+    {
+        std::vector<std::size_t> indices;
+        for(std::size_t i = 0; i < entries_.size(); ++i)
+            if(predicate(entries_[i].descriptor_))
+                indices.push_back(i);
+        return indices;
+    }
+
+    // stable id of instance i, see get_instance_id(); empty if the instance has none
+    std::string GetInstanceId(std::size_t i) const
+    {
+        const auto& entry = entries_.at(i);
+
+        return entry.get_instance_key_ ? get_instance_id(entry.get_instance_key_()) : "";
+    }
+
+    std::unique_ptr<BaseOp> MakeInstance(std::size_t i) const
+    {
+        if(i >= entries_.size())
+            throw std::runtime_error("wrong! instance index is out of range");
+
+        return entries_[i].make_instance_();
+    }
+
+    std::vector<std::unique_ptr<BaseOp>>
+    MakeInstances(const std::vector<std::size_t>& indices) const
+    {
+        std::vector<std::unique_ptr<BaseOp>> op_ptrs;
+        op_ptrs.reserve(indices.size());
+        for(const std::size_t i : indices)
+            op_ptrs.push_back(MakeInstance(i));
+        return op_ptrs;
+    }
+
+    // every instance, as GetInstances() returns them
+    std::vector<std::unique_ptr<BaseOp>> MakeInstances() const
+    {
+        std::vector<std::unique_ptr<BaseOp>> op_ptrs;
+        op_ptrs.reserve(entries_.size());
+        for(const auto& entry : entries_)
+            op_ptrs.push_back(entry.make_instance_());
+        return op_ptrs;
+    }
+
+    private:
+    std::vector<Entry> entries_;
+};
+
+// Maps the stable ids of the instances of a catalog, e.g. ids stored with tuning results, back
+// to their instances. Looking an id up constructs no instance, making it constructs only that
+// one. Identical instances share an id, the first of them is found.
+template <typename BaseOp>
+class DeviceOperationInstanceRegistry
+{
+    public:
+    explicit DeviceOperationInstanceRegistry(const DeviceOperationInstanceCatalog<BaseOp>& catalog)
+        : catalog_(catalog)
+    {
+        for(std::size_t i = 0; i < catalog_.GetNumInstance(); ++i)
+        {
+            auto id = catalog_.GetInstanceId(i);
+            if(!id.empty())
+                indices_.emplace(std::move(id), i);
+        }
+    }
+
+    std::size_t GetNumId() const { return indices_.size(); }
+
+    // catalog index of the instance with the id, if there is one
+    std::optional<std::size_t> FindInstance(const std::string& id) const
+    {
+        const auto it = indices_.find(id);
+        if(it == indices_.end())
+            return std::nullopt;
+
+        return it->second;
+    }
+
+    // the instance with the id, nullptr if there is none, e.g. after it was removed from the
+    // library
+    std::unique_ptr<BaseOp> MakeInstance(const std::string& id) const
+    {
+        const auto i = FindInstance(id);
+
+        return i ? catalog_.MakeInstance(*i) : nullptr;
+    }
+
+    private:
+    const DeviceOperationInstanceCatalog<BaseOp>& catalog_;
+    std::unordered_map<std::string, std::size_t> indices_;
+};
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+// Exports the function adding the entries of an instance file as the unmangled symbol
+// ck_module_<add_entries>, for add_module_instance_entries() to find when the file is built
+// into an instance module. Used in namespace ck::tensor_operation::device::instance.
+#define CK_EXPORT_INSTANCE_ENTRIES(add_entries)                                      \
+    extern "C" __attribute__((visibility("default"))) void ck_module_##add_entries( \
+        void* entries)                                                               \
+    {                                                                                \
+        detail::add_instance_entries(&add_entries, entries);                         \
+    }
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_catalog.hpp"
+
+// The loader is only compiled with CK_LAZY_LOAD_INSTANCE_MODULES, which CMake defines for the
+// users of the instance library built with CK_BUILD_INSTANCE_MODULES; otherwise the instances
+// are linked in and nothing here depends on dlfcn.h.
+#ifdef CK_LAZY_LOAD_INSTANCE_MODULES
+
+#include <dlfcn.h>
+
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
+// directory the instance modules are loaded from, e.g.
+// export CK_INSTANCE_MODULE_PATH=/opt/rocm/lib
+// unset: the directory they were installed to, else the search path of the dynamic loader
+CK_DECLARE_ENV_VAR_STR(CK_INSTANCE_MODULE_PATH)
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+// Handle of an instance module, the shared object built from the instances of one family and
+// data type with CK_BUILD_INSTANCE_MODULES, e.g. module "device_gemm_xdl_universal_f16_f16_f16"
+// is libdevice_gemm_xdl_universal_f16_f16_f16_operations.so.
+//
+// A module is opened on first use and stays loaded, the entries it adds point to its code.
+// nullptr if the module cannot be opened, e.g. because it is not installed.
+inline void* get_instance_module(const std::string& module)
+{
+    static std::mutex mutex;
+    static std::unordered_map<std::string, void*> handles;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const auto it = handles.find(module);
+    if(it != handles.end())
+        return it->second;
+
+    std::string dir = ck::EnvGetString(CK_ENV(CK_INSTANCE_MODULE_PATH));
+#ifdef CK_INSTANCE_MODULE_DIR
+    if(dir.empty())
+        dir = CK_INSTANCE_MODULE_DIR;
+#endif
+    const std::string file = (dir.empty() ? "" : dir + "/") + "lib" + module + "_operations.so";
+
+    void* handle = dlopen(file.c_str(), RTLD_NOW | RTLD_LOCAL);
+
+    if(handle == nullptr && ck::EnvIsEnabled(CK_ENV(CK_LOGGING)))
+        std::cout << "cannot load instance module " << file << ": " << dlerror() << std::endl;
+
+    handles.emplace(module, handle);
+
+    return handle;
+}
+
+// Add the entries of an instance file built into a module, exported by it as symbol, see
+// CK_EXPORT_INSTANCE_ENTRIES. A module that cannot be opened adds no entries, like a data type
+// left out of the build.
+template <typename BaseOp>
+void add_module_instance_entries(const std::string& module,
+                                 const char* symbol,
+                                 std::vector<DeviceOperationInstanceEntry<BaseOp>>& entries)
+{
+    void* handle = get_instance_module(module);
+    if(handle == nullptr)
+        return;
+
+    void* add_entries = dlsym(handle, symbol);
+    if(add_entries == nullptr)
+        throw std::runtime_error("wrong! instance module " + module + " has no " + symbol);
+
+    reinterpret_cast<void (*)(void*)>(add_entries)(&entries);
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+#endif
+
+// Declares the function adding the entries of an instance file of module; the base op is the
+// last argument, it may contain commas. With CK_LAZY_LOAD_INSTANCE_MODULES the function is
+// defined here instead and adds the entries exported by the module, which is opened on the
+// first call, i.e. when the catalog of the family is first built.
+#ifdef CK_LAZY_LOAD_INSTANCE_MODULES
+#define CK_DECLARE_INSTANCE_ENTRIES(module, add_entries, ...)                               \
+    inline void add_entries(std::vector<DeviceOperationInstanceEntry<__VA_ARGS__>>& entries) \
+    {                                                                                        \
+        add_module_instance_entries(#module, "ck_module_" #add_entries, entries);           \
+    }
+#else
+#define CK_DECLARE_INSTANCE_ENTRIES(module, add_entries, ...) \
+    void add_entries(std::vector<DeviceOperationInstanceEntry<__VA_ARGS__>>& entries)
+#endif
@@ -0,0 +1,242 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/device_gemm_instance_descriptor.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_catalog.hpp"
+#include "ck/library/tensor_operation_instance/gemm_instance_ranking.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+// problem the GEMM instances are prefiltered for
+struct GemmPrefilterProblem
+{
+    long M_ = 0;
+    long N_ = 0;
+    long K_ = 0;
+
+    int k_batch_ = 1;
+
+    bool xdl_supported_ = true; // by the device the problem runs on
+};
+
+// why an instance cannot run a problem
+enum struct GemmRejection
+{
+    None,
+    Arch,          // the device has no XDL instructions
+    KVector,       // K is not a multiple of AK1 and BK1, and K is not padded
+    MPadding,      // M is not a multiple of MPerBlock, and M is not padded
+    NPadding,      // N is not a multiple of NPerBlock, and N is not padded
+    KSplit,        // K cannot be split into KBatch parts of whole tiles
+    AVectorWidth,  // the contiguous dimension of A is not a multiple of its read width
+    BVectorWidth,  // the contiguous dimension of B is not a multiple of its read width
+    CVectorWidth,  // the contiguous dimension of C is not a multiple of its write width
+    PipelineDepth, // fewer K loops than the pipeline prefetches
+};
+
+inline const char* get_gemm_rejection_string(GemmRejection rejection)
+{
+    switch(rejection)
+    {
+    case GemmRejection::None: return "None";
+    case GemmRejection::Arch: return "device has no XDL instructions";
+    case GemmRejection::KVector: return "K is not a multiple of AK1 and BK1";
+    case GemmRejection::MPadding: return "M is not a multiple of MPerBlock";
+    case GemmRejection::NPadding: return "N is not a multiple of NPerBlock";
+    case GemmRejection::KSplit: return "K cannot be split into KBatch tiles";
+    case GemmRejection::AVectorWidth: return "A is not a multiple of its read width";
+    case GemmRejection::BVectorWidth: return "B is not a multiple of its read width";
+    case GemmRejection::CVectorWidth: return "C is not a multiple of its write width";
+    case GemmRejection::PipelineDepth: return "too few K loops for the pipeline";
+    default: return "Unrecognized rejection!";
+    }
+}
+
+// The checks of IsSupportedArgument() that only need the descriptor of an instance, without
+// building an argument or its grid descriptors. They mirror
+// DeviceGemm_Xdl_CShuffleV3::IsSupportedArgument() and GridwiseGemm::CheckValidity().
+//
+// An instance rejected here is not supported; one that passes may still be rejected by
+// IsSupportedArgument(), e.g. for split-K atomics its data types do not have. Parameters the
+// descriptor does not know, i.e. that are 0, are not checked.
+inline GemmRejection prefilter_gemm_instance(const DeviceGemmInstanceDescriptor& desc,
+                                             const GemmPrefilterProblem& problem)
+{
+    using detail::integer_divide_ceil;
+
+    const auto divides = [](long length, long d) { return d <= 0 || length % d == 0; };
+
+    const bool pad_m = detail::gemm_spec_pads(desc.gemm_spec_, 'M');
+    const bool pad_n = detail::gemm_spec_pads(desc.gemm_spec_, 'N');
+    const bool pad_k = detail::gemm_spec_pads(desc.gemm_spec_, 'K');
+
+    const long k_batch = std::max(problem.k_batch_, 1);
+
+    if(desc.xdl_ && !problem.xdl_supported_)
+        return GemmRejection::Arch;
+
+    if(!pad_k && !(divides(problem.K_, desc.ak1_) && divides(problem.K_, desc.bk1_)))
+        return GemmRejection::KVector;
+
+    // like CheckValidity(), M is checked only for a column major A and N only for a row major B
+    if(!pad_m && !desc.a_row_major_ && !divides(problem.M_, desc.m_per_block_))
+        return GemmRejection::MPadding;
+
+    if(!pad_n && desc.b_row_major_ && !divides(problem.N_, desc.n_per_block_))
+        return GemmRejection::NPadding;
+
+    if(!pad_k)
+    {
+        if(desc.k_per_block_ > 0 && !divides(problem.K_, k_batch * desc.k_per_block_))
+            return GemmRejection::KSplit;
+    }
+    else if(desc.ak1_ > 0 && desc.bk1_ > 0)
+    {
+        // the last split must not be empty
+        const long k_read_vec = std::lcm(desc.ak1_, desc.bk1_);
+        const long k_read = integer_divide_ceil(problem.K_, k_batch * k_read_vec) * k_read_vec;
+
+        if(k_read * (k_batch - 1) >= problem.K_)
+            return GemmRejection::KSplit;
+    }
+
+    if(!divides(desc.a_row_major_ ? problem.K_ : problem.M_, desc.a_src_scalar_per_vector_))
+        return GemmRejection::AVectorWidth;
+
+    if(!divides(desc.b_row_major_ ? problem.N_ : problem.K_, desc.b_src_scalar_per_vector_))
+        return GemmRejection::BVectorWidth;
+
+    if(!divides(desc.c_row_major_ ? problem.N_ : problem.M_, desc.c_dst_scalar_per_vector_))
+        return GemmRejection::CVectorWidth;
+
+    if(desc.pipeline_version_ != 1 && desc.k_per_block_ > 0)
+    {
+        const long num_k_loop = integer_divide_ceil(problem.K_, k_batch * desc.k_per_block_);
+
+        if(num_k_loop <= desc.pipeline_prefetch_)
+            return GemmRejection::PipelineDepth;
+    }
+
+    return GemmRejection::None;
+}
+
+// Bulk prefilter of the instances of a catalog, for callers that pick instances per problem,
+// e.g. per group of a grouped GEMM.
+//
+// The candidates of a problem are cached by its signature: M and N modulo the least common
+// multiple of the tile sizes and vector widths in the catalog, since only their divisibility
+// is checked, and K, KBatch and the device features as they are. Problems that differ only in
+// M, as the groups of a grouped GEMM often do, mostly share one signature. With CK_LOGGING
+// the rejected instances and the reasons are printed when a signature is first seen.
+template <typename BaseOp>
+class GemmInstancePrefilter
+{
+    public:
+    explicit GemmInstancePrefilter(const DeviceOperationInstanceCatalog<BaseOp>& catalog)
+        : catalog_(catalog)
+    {
+        for(std::size_t i = 0; i < catalog_.GetNumInstance(); ++i)
+        {
+            const auto& desc = catalog_.GetDescriptor(i);
+
+            m_modulus_ = lcm_positive(m_modulus_, desc.m_per_block_);
+            m_modulus_ = lcm_positive(m_modulus_, desc.a_src_scalar_per_vector_);
+            m_modulus_ = lcm_positive(m_modulus_, desc.c_dst_scalar_per_vector_);
+
+            n_modulus_ = lcm_positive(n_modulus_, desc.n_per_block_);
+            n_modulus_ = lcm_positive(n_modulus_, desc.b_src_scalar_per_vector_);
+            n_modulus_ = lcm_positive(n_modulus_, desc.c_dst_scalar_per_vector_);
+        }
+    }
+
+    // the reason each instance of the catalog cannot run the problem, None if it may
+    std::vector<GemmRejection> GetRejections(const GemmPrefilterProblem& problem) const
+    {
+        std::vector<GemmRejection> rejections;
+        rejections.reserve(catalog_.GetNumInstance());
+        for(std::size_t i = 0; i < catalog_.GetNumInstance(); ++i)
+            rejections.push_back(prefilter_gemm_instance(catalog_.GetDescriptor(i), problem));
+        return rejections;
+    }
+
+    // catalog indices of the instances that pass the prefilter, in catalog order
+    const std::vector<std::size_t>& GetCandidates(const GemmPrefilterProblem& problem) const
+    {
+        const auto signature = GetSignature(problem);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        const auto it = candidates_.find(signature);
+        if(it != candidates_.end())
+            return it->second;
+
+        const auto rejections = GetRejections(problem);
+
+        std::vector<std::size_t> candidates;
+        for(std::size_t i = 0; i < rejections.size(); ++i)
+        {
+            if(rejections[i] == GemmRejection::None)
+            {
+                candidates.push_back(i);
+            }
+            else if(ck::EnvIsEnabled(CK_ENV(CK_LOGGING)))
+            {
+                std::cout << "instance " << i << " (" << catalog_.GetDescriptor(i).family_
+                          << ") does not support M " << problem.M_ << ", N " << problem.N_
+                          << ", K " << problem.K_ << ", KBatch " << problem.k_batch_ << ": "
+                          << get_gemm_rejection_string(rejections[i]) << std::endl;
+            }
+        }
+
+        return candidates_.emplace(signature, std::move(candidates)).first->second;
+    }
+
+    // number of signatures with cached candidates
+    std::size_t GetNumSignature() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return candidates_.size();
+    }
+
+    private:
+    using Signature = std::tuple<long, long, long, int, bool>;
+
+    static long lcm_positive(long x, int y) { return y > 0 ? std::lcm(x, long{y}) : x; }
+
+    Signature GetSignature(const GemmPrefilterProblem& problem) const
+    {
+        return {problem.M_ % m_modulus_,
+                problem.N_ % n_modulus_,
+                problem.K_,
+                problem.k_batch_,
+                problem.xdl_supported_};
+    }
+
+    const DeviceOperationInstanceCatalog<BaseOp>& catalog_;
+
+    long m_modulus_ = 1;
+    long n_modulus_ = 1;
+
+    mutable std::mutex mutex_;
+    mutable std::map<Signature, std::vector<std::size_t>> candidates_;
+};
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -0,0 +1,353 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "ck/tensor_operation/gpu/device/device_gemm_instance_descriptor.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_catalog.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+// type the matrix instructions of a GEMM compute in
+enum struct GemmRankingComputeType
+{
+    F64,
+    F32,
+    F16,
+    BF16,
+    F8, // f8 and bf8
+    I8,
+};
+
+// problem a GEMM instance is ranked for
+struct GemmRankingProblem
+{
+    long M_ = 0;
+    long N_ = 0;
+    long K_ = 0;
+
+    int a_element_bytes_ = 2;
+    int b_element_bytes_ = 2;
+    int c_element_bytes_ = 2;
+
+    GemmRankingComputeType compute_type_ = GemmRankingComputeType::F16;
+};
+
+// the device the instances are ranked for, by default an MI300X
+struct GemmRankingDevice
+{
+    std::string arch_     = "gfx942"; // e.g. ck::get_device_name()
+    int num_cu_           = 304;
+    int clock_mhz_        = 2100; // peak engine clock
+    int lds_bytes_per_cu_ = 64 * 1024;
+    int max_waves_per_cu_ = 32;
+    int simd_per_cu_      = 4;
+    int wave_size_        = 64;
+
+    // waves with loads in flight a CU needs to hide the latency of global memory
+    int latency_hiding_waves_ = 8;
+
+    double bandwidth_gbs_ = 5300.;
+};
+
+// Dense matrix flops per clock and CU of the XDL or WMMA instructions of an architecture, from
+// the peak rates AMD publishes for its parts divided by CUs and peak engine clock. Types an
+// architecture has no matrix instructions for run at its vector rate, other architectures at
+// the vector rate of one packed FMA per lane.
+inline int get_gemm_flops_per_clock_per_cu(const std::string& arch, GemmRankingComputeType type)
+{
+    using T = GemmRankingComputeType;
+
+    const auto is_arch = [&](const char* prefix) { return arch.rfind(prefix, 0) == 0; };
+
+    if(arch == "gfx940" || arch == "gfx941" || arch == "gfx942")
+    {
+        switch(type)
+        {
+        case T::F64: return 256;
+        case T::F32: return 256;
+        case T::F16: return 2048;
+        case T::BF16: return 2048;
+        case T::F8: return 4096;
+        case T::I8: return 4096;
+        }
+    }
+    else if(arch == "gfx90a")
+    {
+        switch(type)
+        {
+        case T::F64: return 256;
+        case T::F32: return 256;
+        case T::F16: return 1024;
+        case T::BF16: return 1024;
+        case T::F8: return 1024;
+        case T::I8: return 1024;
+        }
+    }
+    else if(arch == "gfx908")
+    {
+        switch(type)
+        {
+        case T::F64: return 64;
+        case T::F32: return 256;
+        case T::F16: return 1024;
+        case T::BF16: return 512;
+        case T::F8: return 1024;
+        case T::I8: return 1024;
+        }
+    }
+    else if(is_arch("gfx12"))
+    {
+        switch(type)
+        {
+        case T::F64: return 8;
+        case T::F32: return 256;
+        case T::F16: return 1024;
+        case T::BF16: return 1024;
+        case T::F8: return 2048;
+        case T::I8: return 2048;
+        }
+    }
+    else if(is_arch("gfx11"))
+    {
+        switch(type)
+        {
+        case T::F64: return 8;
+        case T::F32: return 256;
+        case T::F16: return 512;
+        case T::BF16: return 512;
+        case T::F8: return 512;
+        case T::I8: return 512;
+        }
+    }
+
+    return type == T::F64 ? 64 : 256;
+}
+
+// memory bandwidth of the parts of the architectures with one HBM configuration, 0 for the
+// others, whose bandwidth depends on the part
+inline double get_gemm_ranking_bandwidth_gbs(const std::string& arch)
+{
+    if(arch == "gfx940" || arch == "gfx941" || arch == "gfx942")
+        return 5300.; // MI300X and MI300A
+    if(arch == "gfx90a")
+        return 1638.4; // one die of an MI250X, MI210
+    if(arch == "gfx908")
+        return 1228.8; // MI100
+    return 0.;
+}
+
+// peak dense matrix rate of a device for the compute type of a problem
+inline double get_gemm_peak_tflops(const GemmRankingDevice& device, GemmRankingComputeType type)
+{
+    return static_cast<double>(device.num_cu_) * device.clock_mhz_ *
+           get_gemm_flops_per_clock_per_cu(device.arch_, type) * 1e-6;
+}
+
+// analytic estimate of the time of an instance on a problem
+struct GemmInstanceEstimate
+{
+    std::size_t index_ = 0; // of the instance in the ranked list or catalog
+
+    // the instance cannot run the problem: its specialization does not pad a dimension the
+    // problem does not divide, or its LDS does not fit on a CU
+    bool covers_problem_ = false;
+
+    double time_ms_ = std::numeric_limits<double>::infinity();
+
+    double wave_efficiency_      = 0; // useful share of the tile rounds over the CUs
+    double padding_efficiency_   = 0; // useful share of the padded problem
+    double arithmetic_intensity_ = 0; // flops per byte of global traffic
+    int occupancy_               = 0; // workgroups per CU
+};
+
+namespace detail {
+
+inline long integer_divide_ceil(long x, long y) { return (x + y - 1) / y; }
+
+inline bool gemm_spec_pads(GemmSpecialization spec, char dim)
+{
+    switch(spec)
+    {
+    case GemmSpecialization::MPadding: return dim == 'M';
+    case GemmSpecialization::NPadding: return dim == 'N';
+    case GemmSpecialization::KPadding: return dim == 'K';
+    case GemmSpecialization::MNPadding: return dim == 'M' || dim == 'N';
+    case GemmSpecialization::MKPadding: return dim == 'M' || dim == 'K';
+    case GemmSpecialization::NKPadding: return dim == 'N' || dim == 'K';
+    case GemmSpecialization::MNKPadding: return true;
+    default: return false;
+    }
+}
+
+// global reads narrower than 16 bytes per lane do not reach full bandwidth
+inline double get_read_efficiency(int scalar_per_vector, int element_bytes)
+{
+    return std::clamp(scalar_per_vector * element_bytes / 16., 1. / 16, 1.);
+}
+
+} // namespace detail
+
+// Estimate the time of an instance on a problem from its descriptor alone.
+//
+// A roofline over the padded problem. The compute time is that of the rounds the output tiles
+// are dispatched in, occupancy workgroups per CU at a time: a CU runs the tiles it holds at its
+// share of the peak rate of the compute type, all of it once their waves fill every SIMD, and
+// the last round holds only the remaining tiles. The memory time is the global traffic of all
+// tiles at full bandwidth, stretched for narrow vector reads and for too few loads in flight
+// per CU. The estimate is the larger of the two. Occupancy is bounded by LDS and waves per CU
+// only, register use is not known from the descriptor.
+inline GemmInstanceEstimate estimate_gemm_instance(const DeviceGemmInstanceDescriptor& desc,
+                                                   const GemmRankingProblem& problem,
+                                                   const GemmRankingDevice& device)
+{
+    using detail::integer_divide_ceil;
+
+    GemmInstanceEstimate e;
+
+    if(problem.M_ <= 0 || problem.N_ <= 0 || problem.K_ <= 0 || desc.m_per_block_ <= 0 ||
+       desc.n_per_block_ <= 0 || desc.k_per_block_ <= 0 || desc.block_size_ <= 0)
+        return e;
+
+    const auto covers = [&](long length, int per_block, char dim) {
+        return length % per_block == 0 || detail::gemm_spec_pads(desc.gemm_spec_, dim);
+    };
+
+    if(!covers(problem.M_, desc.m_per_block_, 'M') ||
+       !covers(problem.N_, desc.n_per_block_, 'N') || !covers(problem.K_, desc.k_per_block_, 'K'))
+        return e;
+
+    const int waves_per_workgroup = integer_divide_ceil(desc.block_size_, device.wave_size_);
+
+    e.occupancy_ = device.max_waves_per_cu_ / waves_per_workgroup;
+    if(desc.lds_bytes_ > 0)
+        e.occupancy_ = std::min(e.occupancy_, device.lds_bytes_per_cu_ / desc.lds_bytes_);
+
+    if(e.occupancy_ < 1)
+        return e;
+
+    e.covers_problem_ = true;
+
+    const long num_tile_m = integer_divide_ceil(problem.M_, desc.m_per_block_);
+    const long num_tile_n = integer_divide_ceil(problem.N_, desc.n_per_block_);
+    const long num_tile   = num_tile_m * num_tile_n;
+
+    const double m_pad = static_cast<double>(num_tile_m) * desc.m_per_block_;
+    const double n_pad = static_cast<double>(num_tile_n) * desc.n_per_block_;
+    const double k_pad = static_cast<double>(integer_divide_ceil(problem.K_, desc.k_per_block_)) *
+                         desc.k_per_block_;
+
+    const double flops        = 2. * problem.M_ * problem.N_ * problem.K_;
+    const double padded_flops = 2. * m_pad * n_pad * k_pad;
+
+    // a CU with num_tile_cu tiles runs them at this share of its peak rate
+    const auto cu_utilization = [&](long num_tile_cu) {
+        return std::min(1., static_cast<double>(num_tile_cu) * waves_per_workgroup /
+                                std::max(device.simd_per_cu_, 1));
+    };
+
+    const long num_slot      = static_cast<long>(device.num_cu_) * e.occupancy_;
+    const long num_round     = num_tile / num_slot;
+    const long num_tile_last = integer_divide_ceil(num_tile % num_slot, device.num_cu_);
+
+    // in units of the time of one tile at the peak rate of a CU
+    const double round_time = e.occupancy_ / cu_utilization(e.occupancy_);
+    const double cu_time =
+        num_round * round_time +
+        (num_tile_last > 0 ? num_tile_last / cu_utilization(num_tile_last) : 0.);
+
+    e.wave_efficiency_    = static_cast<double>(num_tile) / device.num_cu_ / cu_time;
+    e.padding_efficiency_ = flops / padded_flops;
+
+    // every tile reads its rows of A and columns of B, C is written once
+    const double a_bytes = num_tile_n * m_pad * k_pad * problem.a_element_bytes_;
+    const double b_bytes = num_tile_m * n_pad * k_pad * problem.b_element_bytes_;
+    const double c_bytes = m_pad * n_pad * problem.c_element_bytes_;
+
+    const double a_read_efficiency =
+        detail::get_read_efficiency(desc.a_src_scalar_per_vector_, problem.a_element_bytes_);
+    const double b_read_efficiency =
+        detail::get_read_efficiency(desc.b_src_scalar_per_vector_, problem.b_element_bytes_);
+
+    e.arithmetic_intensity_ = padded_flops / (a_bytes + b_bytes + c_bytes);
+
+    // every prefetch stage of the pipeline keeps another load of a wave in flight
+    const double latency_hiding =
+        std::min(1.,
+                 static_cast<double>(e.occupancy_) * waves_per_workgroup *
+                     std::max(desc.pipeline_prefetch_, 1) / device.latency_hiding_waves_);
+
+    const double compute_ms =
+        padded_flops / (get_gemm_peak_tflops(device, problem.compute_type_) * 1e9) /
+        e.wave_efficiency_;
+    const double memory_ms =
+        (a_bytes / a_read_efficiency + b_bytes / b_read_efficiency + c_bytes) /
+        (device.bandwidth_gbs_ * 1e6) / latency_hiding;
+
+    e.time_ms_ = std::max(compute_ms, memory_ms);
+
+    return e;
+}
+
+// The top_k instances by estimated time, fastest first; instances that do not cover the
+// problem are left out. Ties keep the order of descs. Callers time only the shortlist instead
+// of every instance.
+inline std::vector<GemmInstanceEstimate>
+rank_gemm_instances(const std::vector<DeviceGemmInstanceDescriptor>& descs,
+                    const GemmRankingProblem& problem,
+                    const GemmRankingDevice& device,
+                    std::size_t top_k)
+{
+    std::vector<GemmInstanceEstimate> estimates;
+    for(std::size_t i = 0; i < descs.size(); ++i)
+    {
+        auto e = estimate_gemm_instance(descs[i], problem, device);
+        if(e.covers_problem_)
+        {
+            e.index_ = i;
+            estimates.push_back(e);
+        }
+    }
+
+    std::stable_sort(estimates.begin(),
+                     estimates.end(),
+                     [](const GemmInstanceEstimate& x, const GemmInstanceEstimate& y) {
+                         return x.time_ms_ < y.time_ms_;
+                     });
+
+    if(estimates.size() > top_k)
+        estimates.resize(top_k);
+
+    return estimates;
+}
+
+// rank_gemm_instances() over the descriptors of a catalog; index_ is the catalog index
+template <typename BaseOp>
+std::vector<GemmInstanceEstimate>
+rank_gemm_instances(const DeviceOperationInstanceCatalog<BaseOp>& catalog,
+                    const GemmRankingProblem& problem,
+                    const GemmRankingDevice& device,
+                    std::size_t top_k)
+{
+    std::vector<DeviceGemmInstanceDescriptor> descs;
+    descs.reserve(catalog.GetNumInstance());
+    for(std::size_t i = 0; i < catalog.GetNumInstance(); ++i)
+        descs.push_back(catalog.GetDescriptor(i));
+
+    return rank_gemm_instances(descs, problem, device, top_k);
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
@@ -11,12 +11,18 @@
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 
 #include "ck/library/tensor_operation_instance/device_operation_instance_factory.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_catalog.hpp"
+#include "ck/library/tensor_operation_instance/device_operation_instance_module.hpp"
+#include "ck/library/tensor_operation_instance/gemm_instance_prefilter.hpp"
 
 namespace ck {
 namespace tensor_operation {
 namespace device {
 namespace instance {
+// The add_*_instances() functions are only linked into device_gemm_operations without
+// CK_BUILD_INSTANCE_MODULES; the modules are reached through the entries alone.
 #ifdef CK_ENABLE_FP16
+#ifndef CK_LAZY_LOAD_INSTANCE_MODULES
 void add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_comp_default_instances(
     std::vector<std::unique_ptr<
         DeviceGemmV2<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
@@ -97,7 +103,89 @@ void add_device_gemm_xdl_universal_f16_f16_f16_mk_nk_mn_mem_v2_kpadding_instance
         DeviceGemmV2<Row, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
         instances);
 #endif
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f16_f16,
+    add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_comp_default_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f16_f16,
+    add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_comp_kpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f16_f16,
+    add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_comp_mnpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f16_f16,
+    add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_comp_mnkpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f16_f16,
+    add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_mem_v1_default_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f16_f16,
+    add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_mem_v1_kpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f16_f16,
+    add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_mem_v1_mnkpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f16_f16,
+    add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_mem_v2_default_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f16_f16,
+    add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_mem_v2_kpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f16_f16,
+    add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_mem_v2_mnkpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f16_f16,
+    add_device_gemm_xdl_universal_f16_f16_f16_mk_nk_mn_comp_default_entries,
+    DeviceGemmV2<Row, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f16_f16,
+    add_device_gemm_xdl_universal_f16_f16_f16_mk_nk_mn_comp_kpadding_entries,
+    DeviceGemmV2<Row, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f16_f16,
+    add_device_gemm_xdl_universal_f16_f16_f16_mk_nk_mn_mem_v1_default_entries,
+    DeviceGemmV2<Row, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f16_f16,
+    add_device_gemm_xdl_universal_f16_f16_f16_mk_nk_mn_mem_v1_kpadding_entries,
+    DeviceGemmV2<Row, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f16_f16,
+    add_device_gemm_xdl_universal_f16_f16_f16_mk_nk_mn_mem_v2_default_entries,
+    DeviceGemmV2<Row, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f16_f16,
+    add_device_gemm_xdl_universal_f16_f16_f16_mk_nk_mn_mem_v2_kpadding_entries,
+    DeviceGemmV2<Row, Col, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>);
+#endif
 #if(defined(CK_ENABLE_FP16) && defined(CK_ENABLE_FP8))
+#ifndef CK_LAZY_LOAD_INSTANCE_MODULES
 void add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_comp_default_instances(
     std::vector<std::unique_ptr<
         DeviceGemmV2<Row, Row, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>>>&
@@ -147,10 +235,6 @@ void add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_mem_v2_mnkpadding_instanc
     std::vector<std::unique_ptr<
         DeviceGemmV2<Row, Row, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>>>&
         instances);
-void add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_comp_default_instances(
-    std::vector<std::unique_ptr<
-        DeviceGemmV2<Row, Col, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>>>&
-        instances);
 
 void add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_comp_kpadding_instances(
     std::vector<std::unique_ptr<
@@ -166,10 +250,6 @@ void add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_mem_v1_kpadding_instances
     std::vector<std::unique_ptr<
         DeviceGemmV2<Row, Col, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>>>&
         instances);
-void add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_mem_v2_default_instances(
-    std::vector<std::unique_ptr<
-        DeviceGemmV2<Row, Col, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>>>&
-        instances);
 
 void add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_mem_v2_kpadding_instances(
     std::vector<std::unique_ptr<
@@ -225,10 +305,6 @@ void add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_mem_v2_mnkpadding_instanc
     std::vector<std::unique_ptr<
         DeviceGemmV2<Row, Row, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>>>&
         instances);
-void add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_comp_default_instances(
-    std::vector<std::unique_ptr<
-        DeviceGemmV2<Row, Col, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>>>&
-        instances);
 
 void add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_comp_kpadding_instances(
     std::vector<std::unique_ptr<
@@ -255,7 +331,181 @@ void add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_mem_v2_kpadding_instances
         DeviceGemmV2<Row, Col, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>>>&
         instances);
 #endif
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f8_f16,
+    add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_comp_default_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f8_f16,
+    add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_comp_kpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f8_f16,
+    add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_comp_mnpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f8_f16,
+    add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_comp_mnkpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f8_f16,
+    add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_mem_v1_default_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f8_f16,
+    add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_mem_v1_kpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f8_f16,
+    add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_mem_v1_mnkpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f8_f16,
+    add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_mem_v2_default_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f8_f16,
+    add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_mem_v2_kpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f8_f16,
+    add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_mem_v2_mnkpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>);
+void add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_comp_default_instances(
+    std::vector<std::unique_ptr<
+        DeviceGemmV2<Row, Col, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>>>&
+        instances);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f8_f16,
+    add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_comp_default_entries,
+    DeviceGemmV2<Row, Col, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f8_f16,
+    add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_comp_kpadding_entries,
+    DeviceGemmV2<Row, Col, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f8_f16,
+    add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_mem_v1_default_entries,
+    DeviceGemmV2<Row, Col, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f8_f16,
+    add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_mem_v1_kpadding_entries,
+    DeviceGemmV2<Row, Col, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>);
+void add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_mem_v2_default_instances(
+    std::vector<std::unique_ptr<
+        DeviceGemmV2<Row, Col, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>>>&
+        instances);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f8_f16,
+    add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_mem_v2_default_entries,
+    DeviceGemmV2<Row, Col, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f16_f8_f16,
+    add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_mem_v2_kpadding_entries,
+    DeviceGemmV2<Row, Col, Row, F16, F8, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f16_f16,
+    add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_comp_default_entries,
+    DeviceGemmV2<Row, Row, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f16_f16,
+    add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_comp_kpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f16_f16,
+    add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_comp_mnpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f16_f16,
+    add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_comp_mnkpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f16_f16,
+    add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_mem_v1_default_entries,
+    DeviceGemmV2<Row, Row, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f16_f16,
+    add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_mem_v1_kpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f16_f16,
+    add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_mem_v1_mnkpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f16_f16,
+    add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_mem_v2_default_entries,
+    DeviceGemmV2<Row, Row, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f16_f16,
+    add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_mem_v2_kpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f16_f16,
+    add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_mem_v2_mnkpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>);
+void add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_comp_default_instances(
+    std::vector<std::unique_ptr<
+        DeviceGemmV2<Row, Col, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>>>&
+        instances);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f16_f16,
+    add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_comp_default_entries,
+    DeviceGemmV2<Row, Col, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f16_f16,
+    add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_comp_kpadding_entries,
+    DeviceGemmV2<Row, Col, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f16_f16,
+    add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_mem_v1_default_entries,
+    DeviceGemmV2<Row, Col, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f16_f16,
+    add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_mem_v1_kpadding_entries,
+    DeviceGemmV2<Row, Col, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f16_f16,
+    add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_mem_v2_default_entries,
+    DeviceGemmV2<Row, Col, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f16_f16,
+    add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_mem_v2_kpadding_entries,
+    DeviceGemmV2<Row, Col, Row, F8, F16, F16, PassThrough, PassThrough, PassThrough>);
+#endif
 #ifdef CK_ENABLE_BF16
+#ifndef CK_LAZY_LOAD_INSTANCE_MODULES
 void add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_comp_default_instances(
     std::vector<std::unique_ptr<
         DeviceGemmV2<Row, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>>>&
@@ -335,10 +585,6 @@ void add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_mem_v2_kpadding_insta
     std::vector<std::unique_ptr<
         DeviceGemmV2<Row, Col, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>>>&
         instances);
-void add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_default_instances(
-    std::vector<std::unique_ptr<
-        DeviceGemmV2<Col, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>>>&
-        instances);
 
 void add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_kpadding_instances(
     std::vector<std::unique_ptr<
@@ -435,7 +681,193 @@ void add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_mem_v2_mkpadding_inst
         DeviceGemmV2<Col, Col, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>>>&
         instances);
 #endif
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_comp_default_entries,
+    DeviceGemmV2<Row, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_comp_kpadding_entries,
+    DeviceGemmV2<Row, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_comp_mnpadding_entries,
+    DeviceGemmV2<Row, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_comp_mnkpadding_entries,
+    DeviceGemmV2<Row, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_mem_v1_default_entries,
+    DeviceGemmV2<Row, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_mem_v1_kpadding_entries,
+    DeviceGemmV2<Row, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_mem_v1_mnkpadding_entries,
+    DeviceGemmV2<Row, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_mem_v2_default_entries,
+    DeviceGemmV2<Row, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_mem_v2_kpadding_entries,
+    DeviceGemmV2<Row, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_mem_v2_mnkpadding_entries,
+    DeviceGemmV2<Row, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_comp_default_entries,
+    DeviceGemmV2<Row, Col, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_comp_kpadding_entries,
+    DeviceGemmV2<Row, Col, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_mem_v1_default_entries,
+    DeviceGemmV2<Row, Col, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_mem_v1_kpadding_entries,
+    DeviceGemmV2<Row, Col, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_mem_v2_default_entries,
+    DeviceGemmV2<Row, Col, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_mem_v2_kpadding_entries,
+    DeviceGemmV2<Row, Col, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+void add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_default_instances(
+    std::vector<std::unique_ptr<
+        DeviceGemmV2<Col, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>>>&
+        instances);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_default_entries,
+    DeviceGemmV2<Col, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_kpadding_entries,
+    DeviceGemmV2<Col, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_mnpadding_entries,
+    DeviceGemmV2<Col, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_mnkpadding_entries,
+    DeviceGemmV2<Col, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_mem_v1_default_entries,
+    DeviceGemmV2<Col, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_mem_v1_kpadding_entries,
+    DeviceGemmV2<Col, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_mem_v1_mnkpadding_entries,
+    DeviceGemmV2<Col, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_mem_v2_default_entries,
+    DeviceGemmV2<Col, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_mem_v2_kpadding_entries,
+    DeviceGemmV2<Col, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_mem_v2_mnkpadding_entries,
+    DeviceGemmV2<Col, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_comp_default_entries,
+    DeviceGemmV2<Col, Col, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_comp_kpadding_entries,
+    DeviceGemmV2<Col, Col, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_comp_mpadding_entries,
+    DeviceGemmV2<Col, Col, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_comp_mkpadding_entries,
+    DeviceGemmV2<Col, Col, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_mem_v1_default_entries,
+    DeviceGemmV2<Col, Col, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_mem_v1_kpadding_entries,
+    DeviceGemmV2<Col, Col, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_mem_v1_mkpadding_entries,
+    DeviceGemmV2<Col, Col, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_mem_v2_default_entries,
+    DeviceGemmV2<Col, Col, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_mem_v2_kpadding_entries,
+    DeviceGemmV2<Col, Col, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_bf16_bf16_bf16,
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_mem_v2_mkpadding_entries,
+    DeviceGemmV2<Col, Col, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>);
+#endif
 #if(defined(CK_ENABLE_BF16) && defined(CK_ENABLE_FP8))
+#ifndef CK_LAZY_LOAD_INSTANCE_MODULES
 void add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_comp_default_instances(
     std::vector<std::unique_ptr<
         DeviceGemmV2<Row, Row, Row, F8, F8, BF16, PassThrough, PassThrough, PassThrough>>>&
@@ -512,6 +944,82 @@ void add_device_gemm_xdl_universal_f8_f8_bf16_mk_nk_mn_mem_v2_kpadding_instances
         instances);
 #endif
 
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f8_bf16,
+    add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_comp_default_entries,
+    DeviceGemmV2<Row, Row, Row, F8, F8, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f8_bf16,
+    add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_comp_kpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F8, F8, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f8_bf16,
+    add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_comp_nkpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F8, F8, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f8_bf16,
+    add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_mem_v1_default_entries,
+    DeviceGemmV2<Row, Row, Row, F8, F8, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f8_bf16,
+    add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_mem_v1_kpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F8, F8, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f8_bf16,
+    add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_mem_v1_nkpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F8, F8, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f8_bf16,
+    add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_mem_v2_default_entries,
+    DeviceGemmV2<Row, Row, Row, F8, F8, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f8_bf16,
+    add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_mem_v2_kpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F8, F8, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f8_bf16,
+    add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_mem_v2_nkpadding_entries,
+    DeviceGemmV2<Row, Row, Row, F8, F8, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f8_bf16,
+    add_device_gemm_xdl_universal_f8_f8_bf16_mk_nk_mn_comp_default_entries,
+    DeviceGemmV2<Row, Col, Row, F8, F8, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f8_bf16,
+    add_device_gemm_xdl_universal_f8_f8_bf16_mk_nk_mn_comp_kpadding_entries,
+    DeviceGemmV2<Row, Col, Row, F8, F8, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f8_bf16,
+    add_device_gemm_xdl_universal_f8_f8_bf16_mk_nk_mn_mem_v1_default_entries,
+    DeviceGemmV2<Row, Col, Row, F8, F8, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f8_bf16,
+    add_device_gemm_xdl_universal_f8_f8_bf16_mk_nk_mn_mem_v1_kpadding_entries,
+    DeviceGemmV2<Row, Col, Row, F8, F8, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f8_bf16,
+    add_device_gemm_xdl_universal_f8_f8_bf16_mk_nk_mn_mem_v2_default_entries,
+    DeviceGemmV2<Row, Col, Row, F8, F8, BF16, PassThrough, PassThrough, PassThrough>);
+
+CK_DECLARE_INSTANCE_ENTRIES(
+    device_gemm_xdl_universal_f8_f8_bf16,
+    add_device_gemm_xdl_universal_f8_f8_bf16_mk_nk_mn_mem_v2_kpadding_entries,
+    DeviceGemmV2<Row, Col, Row, F8, F8, BF16, PassThrough, PassThrough, PassThrough>);
+#endif
+
 template <typename ADataType,
           typename BDataType,
           typename CDataType,
@@ -539,9 +1047,10 @@ struct DeviceOperationInstanceFactory<
                                   ck::tensor_operation::element_wise::PassThrough,
                                   ck::tensor_operation::element_wise::PassThrough>;
 
-    static auto GetInstances()
+    // entries of all instances, in the order of GetInstances()
+    static auto GetInstanceEntries()
     {
-        std::vector<std::unique_ptr<DeviceOp>> op_ptrs;
+        std::vector<DeviceOperationInstanceEntry<DeviceOp>> entries;
 
 #ifdef CK_ENABLE_FP16
         if constexpr(is_same_v<ADataType, half_t> && is_same_v<BDataType, half_t> &&
@@ -550,42 +1059,32 @@ struct DeviceOperationInstanceFactory<
             if constexpr(is_same_v<ALayout, Row> && is_same_v<BLayout, Row> &&
                          is_same_v<CLayout, Row>)
             {
-                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_comp_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_comp_kpadding_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_comp_mnpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_comp_mnkpadding_instances(
-                    op_ptrs);
-
-                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_mem_v1_default_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_mem_v1_kpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_mem_v1_mnkpadding_instances(
-                    op_ptrs);
-
-                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_mem_v2_default_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_mem_v2_kpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_mem_v2_mnkpadding_instances(
-                    op_ptrs);
+                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_comp_default_entries(entries);
+                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_comp_kpadding_entries(entries);
+                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_comp_mnpadding_entries(entries);
+                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_comp_mnkpadding_entries(entries);
+
+                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_mem_v1_default_entries(entries);
+                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_mem_v1_kpadding_entries(entries);
+                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_mem_v1_mnkpadding_entries(
+                    entries);
+
+                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_mem_v2_default_entries(entries);
+                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_mem_v2_kpadding_entries(entries);
+                add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_mem_v2_mnkpadding_entries(
+                    entries);
             }
             else if constexpr(is_same_v<ALayout, Row> && is_same_v<BLayout, Col> &&
                               is_same_v<CLayout, Row>)
             {
-                add_device_gemm_xdl_universal_f16_f16_f16_mk_nk_mn_comp_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f16_f16_f16_mk_nk_mn_comp_kpadding_instances(op_ptrs);
-
-                add_device_gemm_xdl_universal_f16_f16_f16_mk_nk_mn_mem_v1_default_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_f16_f16_f16_mk_nk_mn_mem_v1_kpadding_instances(
-                    op_ptrs);
-
-                add_device_gemm_xdl_universal_f16_f16_f16_mk_nk_mn_mem_v2_default_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_f16_f16_f16_mk_nk_mn_mem_v2_kpadding_instances(
-                    op_ptrs);
+                add_device_gemm_xdl_universal_f16_f16_f16_mk_nk_mn_comp_default_entries(entries);
+                add_device_gemm_xdl_universal_f16_f16_f16_mk_nk_mn_comp_kpadding_entries(entries);
+
+                add_device_gemm_xdl_universal_f16_f16_f16_mk_nk_mn_mem_v1_default_entries(entries);
+                add_device_gemm_xdl_universal_f16_f16_f16_mk_nk_mn_mem_v1_kpadding_entries(entries);
+
+                add_device_gemm_xdl_universal_f16_f16_f16_mk_nk_mn_mem_v2_default_entries(entries);
+                add_device_gemm_xdl_universal_f16_f16_f16_mk_nk_mn_mem_v2_kpadding_entries(entries);
             }
         }
 #endif
@@ -596,37 +1095,32 @@ struct DeviceOperationInstanceFactory<
             if constexpr(is_same_v<ALayout, Row> && is_same_v<BLayout, Col> &&
                          is_same_v<CLayout, Row>)
             {
-                add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_comp_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_comp_kpadding_instances(op_ptrs);
+                add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_comp_default_entries(entries);
+                add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_comp_kpadding_entries(entries);
 
-                add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_mem_v1_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_mem_v1_kpadding_instances(
-                    op_ptrs);
+                add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_mem_v1_default_entries(entries);
+                add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_mem_v1_kpadding_entries(entries);
 
-                add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_mem_v2_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_mem_v2_kpadding_instances(
-                    op_ptrs);
+                add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_mem_v2_default_entries(entries);
+                add_device_gemm_xdl_universal_f16_f8_f16_mk_nk_mn_mem_v2_kpadding_entries(entries);
             }
             else if constexpr(is_same_v<ALayout, Row> && is_same_v<BLayout, Row> &&
                               is_same_v<CLayout, Row>)
             {
-                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_comp_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_comp_kpadding_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_comp_mnpadding_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_comp_mnkpadding_instances(
-                    op_ptrs);
-
-                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_mem_v1_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_mem_v1_kpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_mem_v1_mnkpadding_instances(
-                    op_ptrs);
-
-                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_mem_v2_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_mem_v2_kpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_mem_v2_mnkpadding_instances(
-                    op_ptrs);
+                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_comp_default_entries(entries);
+                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_comp_kpadding_entries(entries);
+                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_comp_mnpadding_entries(entries);
+                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_comp_mnkpadding_entries(entries);
+
+                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_mem_v1_default_entries(entries);
+                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_mem_v1_kpadding_entries(entries);
+                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_mem_v1_mnkpadding_entries(
+                    entries);
+
+                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_mem_v2_default_entries(entries);
+                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_mem_v2_kpadding_entries(entries);
+                add_device_gemm_xdl_universal_f16_f8_f16_mk_kn_mn_mem_v2_mnkpadding_entries(
+                    entries);
             }
         }
         else if constexpr(is_same_v<ADataType, f8_t> && is_same_v<BDataType, half_t> &&
@@ -635,37 +1129,32 @@ struct DeviceOperationInstanceFactory<
             if constexpr(is_same_v<ALayout, Row> && is_same_v<BLayout, Col> &&
                          is_same_v<CLayout, Row>)
             {
-                add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_comp_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_comp_kpadding_instances(op_ptrs);
+                add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_comp_default_entries(entries);
+                add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_comp_kpadding_entries(entries);
 
-                add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_mem_v1_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_mem_v1_kpadding_instances(
-                    op_ptrs);
+                add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_mem_v1_default_entries(entries);
+                add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_mem_v1_kpadding_entries(entries);
 
-                add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_mem_v2_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_mem_v2_kpadding_instances(
-                    op_ptrs);
+                add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_mem_v2_default_entries(entries);
+                add_device_gemm_xdl_universal_f8_f16_f16_mk_nk_mn_mem_v2_kpadding_entries(entries);
             }
             else if constexpr(is_same_v<ALayout, Row> && is_same_v<BLayout, Row> &&
                               is_same_v<CLayout, Row>)
             {
-                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_comp_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_comp_kpadding_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_comp_mnpadding_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_comp_mnkpadding_instances(
-                    op_ptrs);
-
-                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_mem_v1_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_mem_v1_kpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_mem_v1_mnkpadding_instances(
-                    op_ptrs);
-
-                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_mem_v2_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_mem_v2_kpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_mem_v2_mnkpadding_instances(
-                    op_ptrs);
+                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_comp_default_entries(entries);
+                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_comp_kpadding_entries(entries);
+                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_comp_mnpadding_entries(entries);
+                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_comp_mnkpadding_entries(entries);
+
+                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_mem_v1_default_entries(entries);
+                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_mem_v1_kpadding_entries(entries);
+                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_mem_v1_mnkpadding_entries(
+                    entries);
+
+                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_mem_v2_default_entries(entries);
+                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_mem_v2_kpadding_entries(entries);
+                add_device_gemm_xdl_universal_f8_f16_f16_mk_kn_mn_mem_v2_mnkpadding_entries(
+                    entries);
             }
         }
 #endif
@@ -676,98 +1165,94 @@ struct DeviceOperationInstanceFactory<
             if constexpr(is_same_v<ALayout, Row> && is_same_v<BLayout, Row> &&
                          is_same_v<CLayout, Row>)
             {
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_comp_default_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_comp_kpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_comp_mnpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_comp_mnkpadding_instances(
-                    op_ptrs);
-
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_mem_v1_default_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_mem_v1_kpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_mem_v1_mnkpadding_instances(
-                    op_ptrs);
-
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_mem_v2_default_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_mem_v2_kpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_mem_v2_mnkpadding_instances(
-                    op_ptrs);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_comp_default_entries(entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_comp_kpadding_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_comp_mnpadding_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_comp_mnkpadding_entries(
+                    entries);
+
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_mem_v1_default_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_mem_v1_kpadding_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_mem_v1_mnkpadding_entries(
+                    entries);
+
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_mem_v2_default_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_mem_v2_kpadding_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_kn_mn_mem_v2_mnkpadding_entries(
+                    entries);
             }
             else if constexpr(is_same_v<ALayout, Row> && is_same_v<BLayout, Col> &&
                               is_same_v<CLayout, Row>)
             {
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_comp_default_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_comp_kpadding_instances(
-                    op_ptrs);
-
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_mem_v1_default_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_mem_v1_kpadding_instances(
-                    op_ptrs);
-
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_mem_v2_default_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_mem_v2_kpadding_instances(
-                    op_ptrs);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_comp_default_entries(entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_comp_kpadding_entries(
+                    entries);
+
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_mem_v1_default_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_mem_v1_kpadding_entries(
+                    entries);
+
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_mem_v2_default_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_mem_v2_kpadding_entries(
+                    entries);
             }
             else if constexpr(is_same_v<ALayout, Col> && is_same_v<BLayout, Row> &&
                               is_same_v<CLayout, Row>)
             {
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_default_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_kpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_mnpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_mnkpadding_instances(
-                    op_ptrs);
-
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_mem_v1_default_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_mem_v1_kpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_mem_v1_mnkpadding_instances(
-                    op_ptrs);
-
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_mem_v2_default_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_mem_v2_kpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_mem_v2_mnkpadding_instances(
-                    op_ptrs);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_default_entries(entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_kpadding_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_mnpadding_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_mnkpadding_entries(
+                    entries);
+
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_mem_v1_default_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_mem_v1_kpadding_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_mem_v1_mnkpadding_entries(
+                    entries);
+
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_mem_v2_default_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_mem_v2_kpadding_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_mem_v2_mnkpadding_entries(
+                    entries);
             }
             else if constexpr(is_same_v<ALayout, Col> && is_same_v<BLayout, Col> &&
                               is_same_v<CLayout, Row>)
             {
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_comp_default_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_comp_kpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_comp_mpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_comp_mkpadding_instances(
-                    op_ptrs);
-
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_mem_v1_default_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_mem_v1_kpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_mem_v1_mkpadding_instances(
-                    op_ptrs);
-
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_mem_v2_default_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_mem_v2_kpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_mem_v2_mkpadding_instances(
-                    op_ptrs);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_comp_default_entries(entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_comp_kpadding_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_comp_mpadding_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_comp_mkpadding_entries(
+                    entries);
+
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_mem_v1_default_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_mem_v1_kpadding_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_mem_v1_mkpadding_entries(
+                    entries);
+
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_mem_v2_default_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_mem_v2_kpadding_entries(
+                    entries);
+                add_device_gemm_xdl_universal_bf16_bf16_bf16_km_nk_mn_mem_v2_mkpadding_entries(
+                    entries);
             }
         }
 #endif
@@ -778,40 +1263,57 @@ struct DeviceOperationInstanceFactory<
             if constexpr(is_same_v<ALayout, Row> && is_same_v<BLayout, Row> &&
                          is_same_v<CLayout, Row>)
             {
-                add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_comp_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_comp_kpadding_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_comp_nkpadding_instances(op_ptrs);
-
-                add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_mem_v1_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_mem_v1_kpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_mem_v1_nkpadding_instances(
-                    op_ptrs);
-
-                add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_mem_v2_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_mem_v2_kpadding_instances(
-                    op_ptrs);
-                add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_mem_v2_nkpadding_instances(
-                    op_ptrs);
+                add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_comp_default_entries(entries);
+                add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_comp_kpadding_entries(entries);
+                add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_comp_nkpadding_entries(entries);
+
+                add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_mem_v1_default_entries(entries);
+                add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_mem_v1_kpadding_entries(entries);
+                add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_mem_v1_nkpadding_entries(entries);
+
+                add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_mem_v2_default_entries(entries);
+                add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_mem_v2_kpadding_entries(entries);
+                add_device_gemm_xdl_universal_f8_f8_bf16_mk_kn_mn_mem_v2_nkpadding_entries(entries);
             }
             else if constexpr(is_same_v<ALayout, Row> && is_same_v<BLayout, Col> &&
                               is_same_v<CLayout, Row>)
             {
-                add_device_gemm_xdl_universal_f8_f8_bf16_mk_nk_mn_comp_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f8_f8_bf16_mk_nk_mn_comp_kpadding_instances(op_ptrs);
+                add_device_gemm_xdl_universal_f8_f8_bf16_mk_nk_mn_comp_default_entries(entries);
+                add_device_gemm_xdl_universal_f8_f8_bf16_mk_nk_mn_comp_kpadding_entries(entries);
 
-                add_device_gemm_xdl_universal_f8_f8_bf16_mk_nk_mn_mem_v1_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f8_f8_bf16_mk_nk_mn_mem_v1_kpadding_instances(
-                    op_ptrs);
+                add_device_gemm_xdl_universal_f8_f8_bf16_mk_nk_mn_mem_v1_default_entries(entries);
+                add_device_gemm_xdl_universal_f8_f8_bf16_mk_nk_mn_mem_v1_kpadding_entries(entries);
 
-                add_device_gemm_xdl_universal_f8_f8_bf16_mk_nk_mn_mem_v2_default_instances(op_ptrs);
-                add_device_gemm_xdl_universal_f8_f8_bf16_mk_nk_mn_mem_v2_kpadding_instances(
-                    op_ptrs);
+                add_device_gemm_xdl_universal_f8_f8_bf16_mk_nk_mn_mem_v2_default_entries(entries);
+                add_device_gemm_xdl_universal_f8_f8_bf16_mk_nk_mn_mem_v2_kpadding_entries(entries);
             }
         }
 #endif
-        return op_ptrs;
+        return entries;
+    }
+
+    // the catalog is built once and holds no instance
+    static const DeviceOperationInstanceCatalog<DeviceOp>& GetCatalog()
+    {
+        static const DeviceOperationInstanceCatalog<DeviceOp> catalog(GetInstanceEntries());
+        return catalog;
+    }
+
+    // stable instance ids of the catalog
+    static const DeviceOperationInstanceRegistry<DeviceOp>& GetRegistry()
+    {
+        static const DeviceOperationInstanceRegistry<DeviceOp> registry(GetCatalog());
+        return registry;
     }
+
+    // candidates of a problem by the static checks of IsSupportedArgument(), cached per problem
+    static const GemmInstancePrefilter<DeviceOp>& GetPrefilter()
+    {
+        static const GemmInstancePrefilter<DeviceOp> prefilter(GetCatalog());
+        return prefilter;
+    }
+
+    static auto GetInstances() { return GetCatalog().MakeInstances(); }
 };
 
 } // namespace instance
@@ -0,0 +1,470 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/utility/type_convert.hpp"
+
+#include "ck_tile/host/host_philox.hpp"
+#include "ck_tile/host/host_thread_pool.hpp"
+
+namespace ck {
+namespace utils {
+
+// Rounding of a conversion to a narrower floating point type.
+//
+// Default rounds like ck::type_convert: to nearest even, except for bhalf_t, which is truncated,
+// and for f8_t/bf8_t when CK_USE_SR_F8_CONVERSION selects stochastic rounding. Stochastic rounds
+// up with a probability equal to the dropped fraction of an ulp, using Philox random bits that
+// only depend on the seed and the element index.
+enum class RoundingMode
+{
+    Default,
+    NearestEven,
+    TowardZero,
+    Stochastic,
+};
+
+namespace detail {
+
+// Layout of the floating point types converted without ck::type_convert. The IEEE types have
+// infinities and signed zeros; f8_t and bf8_t are the fnuz variants, whose only NaN is 0x80,
+// which have no negative zero and which saturate on overflow.
+template <typename T>
+struct ConvertFormat
+{
+    static constexpr bool value = false;
+};
+
+template <>
+struct ConvertFormat<half_t>
+{
+    static constexpr bool value = true;
+    using Bits                  = std::uint16_t;
+
+    static constexpr int kMant          = 10;
+    static constexpr int kMinExp        = -14;
+    static constexpr std::uint32_t kMax = 0x7BFF; // magnitude bits of the largest finite value
+    static constexpr bool kIeee         = true;
+};
+
+template <>
+struct ConvertFormat<bhalf_t>
+{
+    static constexpr bool value = true;
+    using Bits                  = std::uint16_t;
+
+    static constexpr int kMant          = 7;
+    static constexpr int kMinExp        = -126;
+    static constexpr std::uint32_t kMax = 0x7F7F;
+    static constexpr bool kIeee         = true;
+};
+
+template <>
+struct ConvertFormat<f8_t>
+{
+    static constexpr bool value = true;
+    using Bits                  = std::uint8_t;
+
+    static constexpr int kMant          = 3;
+    static constexpr int kMinExp        = -7;
+    static constexpr std::uint32_t kMax = 0x7F;
+    static constexpr bool kIeee         = false;
+};
+
+template <>
+struct ConvertFormat<bf8_t>
+{
+    static constexpr bool value = true;
+    using Bits                  = std::uint8_t;
+
+    static constexpr int kMant          = 2;
+    static constexpr int kMinExp        = -15;
+    static constexpr std::uint32_t kMax = 0x7F;
+    static constexpr bool kIeee         = false;
+};
+
+template <typename T>
+inline constexpr bool is_convert_format_v = ConvertFormat<T>::value;
+
+// The conversions that ck::type_convert defines through the float value, so that they can be
+// computed on the bits instead: float or half_t on one side, a convert format or float on the
+// other. Every other pair keeps ck::type_convert.
+template <typename Y, typename X>
+inline constexpr bool is_bulk_convertible_v =
+    !std::is_same_v<Y, X> &&
+    (((std::is_same_v<X, float> || std::is_same_v<X, half_t>) &&
+      (std::is_same_v<Y, float> || is_convert_format_v<Y>)) ||
+     ((std::is_same_v<Y, float> || std::is_same_v<Y, half_t>) &&
+      (std::is_same_v<X, float> || is_convert_format_v<X>)));
+
+template <typename Bits, typename T>
+Bits to_bits(const T& x)
+{
+    static_assert(sizeof(Bits) == sizeof(T));
+
+    Bits bits;
+    std::memcpy(&bits, &x, sizeof(bits));
+    return bits;
+}
+
+template <typename T, typename Bits>
+T from_bits(Bits bits)
+{
+    static_assert(sizeof(Bits) == sizeof(T));
+
+    T x;
+    std::memcpy(&x, &bits, sizeof(x));
+    return x;
+}
+
+// float value of every 8-bit code, computed once with ck::type_convert
+template <typename T>
+const std::array<float, 256>& get_decode_table()
+{
+    static const std::array<float, 256> table = [] {
+        std::array<float, 256> t{};
+        for(std::size_t i = 0; i < t.size(); ++i)
+            t[i] = ck::type_convert<float>(from_bits<T>(static_cast<std::uint8_t>(i)));
+        return t;
+    }();
+
+    return table;
+}
+
+inline float decode_half(std::uint16_t h)
+{
+    const std::uint32_t sign      = static_cast<std::uint32_t>(h & 0x8000) << 16;
+    const std::uint32_t magnitude = h & 0x7FFF;
+
+    std::uint32_t bits;
+    if(magnitude >= 0x7C00) // infinity or NaN
+        bits = 0x7F800000 | ((magnitude & 0x3FF) << 13);
+    else if(magnitude >= 0x400) // normal, rebias the exponent
+        bits = (magnitude + ((127 - 15) << 10)) << 13;
+    else // subnormal, exactly representable as a float
+        bits = to_bits<std::uint32_t>(static_cast<float>(magnitude) * (1.f / 16777216.f));
+
+    return from_bits<float>(sign | bits);
+}
+
+template <typename X>
+float to_float(const X& x, const float* decode_table)
+{
+    if constexpr(std::is_same_v<X, float>)
+        return x;
+    else if constexpr(std::is_same_v<X, half_t>)
+        return decode_half(to_bits<std::uint16_t>(x));
+    else if constexpr(std::is_same_v<X, bhalf_t>)
+        return from_bits<float>(static_cast<std::uint32_t>(to_bits<std::uint16_t>(x)) << 16);
+    else
+        return decode_table[to_bits<std::uint8_t>(x)];
+}
+
+// Rounds x to the format of Y and returns its bits. The significand, including the implicit
+// one, is shifted right by the number of bits the format lacks at the exponent of x, rounding
+// with the dropped bits; adding the rounded significand to the exponent field then carries into
+// the exponent on its own.
+template <typename Y, RoundingMode Mode>
+typename ConvertFormat<Y>::Bits encode_float(float x, std::uint32_t random_bits)
+{
+    using Format = ConvertFormat<Y>;
+    using Bits   = typename Format::Bits;
+
+    constexpr int kSignShift = 8 * sizeof(Bits) - 1;
+    constexpr int kMinBiased = Format::kMinExp + 127;
+
+    const std::uint32_t bits      = to_bits<std::uint32_t>(x);
+    const std::uint32_t sign      = bits >> 31;
+    const std::uint32_t magnitude = bits & 0x7FFFFFFF;
+
+    if(magnitude >= 0x7F800000)
+    {
+        if constexpr(!Format::kIeee)
+            return 0x80;
+        else if(magnitude == 0x7F800000)
+            return static_cast<Bits>((sign << kSignShift) | (Format::kMax + 1));
+        else
+            return static_cast<Bits>((sign << kSignShift) | (Format::kMax + 1) |
+                                     (1u << (Format::kMant - 1)));
+    }
+
+    const int exponent = std::max(static_cast<int>(magnitude >> 23), 1);
+    const std::uint64_t significand =
+        (magnitude & 0x7FFFFF) | (magnitude >= 0x800000 ? 0x800000 : 0);
+    const int shift = std::min(23 - Format::kMant + std::max(kMinBiased - exponent, 0), 31);
+
+    const std::uint64_t dropped_mask = (std::uint64_t{1} << shift) - 1;
+
+    std::uint64_t rounded;
+    if constexpr(Mode == RoundingMode::NearestEven)
+        rounded = (significand + (dropped_mask >> 1) + ((significand >> shift) & 1)) >> shift;
+    else if constexpr(Mode == RoundingMode::TowardZero)
+        rounded = significand >> shift;
+    else
+        rounded = (significand + (random_bits & dropped_mask)) >> shift;
+
+    std::uint32_t code =
+        (static_cast<std::uint32_t>(std::max(exponent - kMinBiased, 0)) << Format::kMant) +
+        static_cast<std::uint32_t>(rounded);
+
+    if(code > Format::kMax)
+    {
+        // IEEE formats overflow to infinity unless truncating, the fnuz formats saturate
+        code = Format::kIeee && Mode != RoundingMode::TowardZero ? Format::kMax + 1 : Format::kMax;
+    }
+
+    if constexpr(!Format::kIeee)
+    {
+        if(code == 0)
+            return 0;
+    }
+
+    return static_cast<Bits>((sign << kSignShift) | code);
+}
+
+// the rounding ck::type_convert uses for Y
+template <typename Y>
+constexpr RoundingMode get_default_rounding()
+{
+    if constexpr(std::is_same_v<Y, bhalf_t>)
+        return RoundingMode::TowardZero;
+    else if constexpr(!std::is_same_v<Y, half_t> && CK_USE_SR_F8_CONVERSION)
+        return RoundingMode::Stochastic;
+    else
+        return RoundingMode::NearestEven;
+}
+
+template <typename Y, typename X, RoundingMode Mode>
+Y convert_value(const X& x, const float* decode_table, std::uint32_t random_bits)
+{
+    if constexpr(std::is_same_v<Y, bhalf_t> && std::is_same_v<X, float> &&
+                 Mode == RoundingMode::TowardZero)
+    {
+        // the truncation of ck::type_convert, NaN payloads included
+        return from_bits<Y>(static_cast<std::uint16_t>(to_bits<std::uint32_t>(x) >> 16));
+    }
+    else
+    {
+        const float f = to_float(x, decode_table);
+
+        if constexpr(std::is_same_v<Y, float>)
+            return f;
+        else
+            return from_bits<Y>(encode_float<Y, Mode>(f, random_bits));
+    }
+}
+
+template <typename Y, typename X, RoundingMode Mode>
+void convert_block_impl(const X* src,
+                        Y* dst,
+                        std::size_t n,
+                        const float* decode_table,
+                        const std::uint32_t* random_bits)
+{
+    for(std::size_t i = 0; i < n; ++i)
+        dst[i] = convert_value<Y, X, Mode>(
+            src[i], decode_table, Mode == RoundingMode::Stochastic ? random_bits[i] : 0);
+}
+
+template <typename Y, typename X, RoundingMode Mode>
+using convert_block_kernel_t =
+    void (*)(const X*, Y*, std::size_t, const float*, const std::uint32_t*);
+
+template <typename Y, typename X, RoundingMode Mode>
+void convert_block_generic(const X* src,
+                           Y* dst,
+                           std::size_t n,
+                           const float* decode_table,
+                           const std::uint32_t* random_bits)
+{
+    convert_block_impl<Y, X, Mode>(src, dst, n, decode_table, random_bits);
+}
+
+#if defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__)
+template <typename Y, typename X, RoundingMode Mode>
+__attribute__((target("avx2,f16c"))) void convert_block_avx2(const X* src,
+                                                             Y* dst,
+                                                             std::size_t n,
+                                                             const float* decode_table,
+                                                             const std::uint32_t* random_bits)
+{
+    convert_block_impl<Y, X, Mode>(src, dst, n, decode_table, random_bits);
+}
+
+template <typename Y, typename X, RoundingMode Mode>
+__attribute__((target("avx512f,avx512bw"))) void
+convert_block_avx512(const X* src,
+                     Y* dst,
+                     std::size_t n,
+                     const float* decode_table,
+                     const std::uint32_t* random_bits)
+{
+    convert_block_impl<Y, X, Mode>(src, dst, n, decode_table, random_bits);
+}
+#endif
+
+// pick the widest block kernel the running CPU supports
+template <typename Y, typename X, RoundingMode Mode>
+convert_block_kernel_t<Y, X, Mode> get_convert_block_kernel()
+{
+    static const convert_block_kernel_t<Y, X, Mode> kernel = [] {
+#if defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__)
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw"))
+            return &convert_block_avx512<Y, X, Mode>;
+        if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c"))
+            return &convert_block_avx2<Y, X, Mode>;
+#endif
+        return &convert_block_generic<Y, X, Mode>;
+    }();
+
+    return kernel;
+}
+
+// elements per task; a multiple of the Philox lanes, so that no counter is split across tasks
+inline constexpr std::size_t kConvertBlock = 4096;
+
+template <typename Y, typename X, RoundingMode Mode>
+void bulk_convert_impl(const X* src, Y* dst, std::size_t n, std::uint64_t seed)
+{
+    const float* decode_table = nullptr;
+    if constexpr(sizeof(X) == 1)
+        decode_table = get_decode_table<X>().data();
+
+    const auto kernel = get_convert_block_kernel<Y, X, Mode>();
+    const ck_tile::HostPhilox philox(seed);
+
+    const std::size_t num_block = (n + kConvertBlock - 1) / kConvertBlock;
+
+    ck_tile::HostThreadPool::instance().parallel_for(
+        num_block, [&](std::size_t block_begin, std::size_t block_end) {
+            std::array<std::uint32_t, kConvertBlock> random_bits;
+
+            for(std::size_t b = block_begin; b < block_end; ++b)
+            {
+                const std::size_t begin = b * kConvertBlock;
+                const std::size_t count = std::min(kConvertBlock, n - begin);
+
+                if constexpr(Mode == RoundingMode::Stochastic)
+                {
+                    const std::size_t num_counter =
+                        (count + ck_tile::HostPhilox::kNumLane - 1) / ck_tile::HostPhilox::kNumLane;
+                    philox.generate(
+                        begin / ck_tile::HostPhilox::kNumLane, num_counter, random_bits.data());
+                }
+
+                kernel(src + begin, dst + begin, count, decode_table, random_bits.data());
+            }
+        });
+}
+
+} // namespace detail
+
+// Converts one value like ck::type_convert<Y>(x), but with the bit-level routines of
+// bulk_convert() where they apply. Stochastic rounding takes its random bits from random_bits.
+template <typename Y, typename X>
+Y convert_value(const X& x,
+                RoundingMode mode          = RoundingMode::Default,
+                std::uint32_t random_bits = 0)
+{
+    if constexpr(detail::is_bulk_convertible_v<Y, X>)
+    {
+        const float* decode_table = nullptr;
+        if constexpr(sizeof(X) == 1)
+            decode_table = detail::get_decode_table<X>().data();
+
+        if(mode == RoundingMode::Default)
+        {
+            // a single value has no index to draw stochastic rounding bits for
+            if constexpr(detail::get_default_rounding<Y>() == RoundingMode::Stochastic)
+                return ck::type_convert<Y>(x);
+
+            mode = detail::get_default_rounding<Y>();
+        }
+
+        switch(mode)
+        {
+        case RoundingMode::TowardZero:
+            return detail::convert_value<Y, X, RoundingMode::TowardZero>(x, decode_table, 0);
+        case RoundingMode::Stochastic:
+            return detail::convert_value<Y, X, RoundingMode::Stochastic>(
+                x, decode_table, random_bits);
+        default:
+            return detail::convert_value<Y, X, RoundingMode::NearestEven>(x, decode_table, 0);
+        }
+    }
+    else
+    {
+        if(mode != RoundingMode::Default)
+        {
+            throw std::runtime_error("wrong! rounding mode not supported for this conversion");
+        }
+
+        return ck::type_convert<Y>(x);
+    }
+}
+
+// dst[i] = src[i] converted to Y, for i in [0, n), on the host thread pool.
+//
+// Conversions between float or half_t and half_t, bhalf_t, f8_t or bf8_t work on the bits in
+// branch-free loops that are compiled for AVX2/F16C and AVX-512 and picked at run time; 8-bit
+// types are decoded through a 256-entry table. In the default rounding mode the results equal
+// those of ck::type_convert, except for the payload of NaNs. Other conversions fall back to
+// ck::type_convert and only support the default rounding mode. The seed only matters for
+// stochastic rounding; the result does not depend on the number of threads.
+template <typename Y, typename X>
+void bulk_convert(const X* src,
+                  Y* dst,
+                  std::size_t n,
+                  RoundingMode mode  = RoundingMode::Default,
+                  std::uint64_t seed = 0)
+{
+    if constexpr(detail::is_bulk_convertible_v<Y, X>)
+    {
+        if(mode == RoundingMode::Default)
+            mode = detail::get_default_rounding<Y>();
+
+        switch(mode)
+        {
+        case RoundingMode::TowardZero:
+            detail::bulk_convert_impl<Y, X, RoundingMode::TowardZero>(src, dst, n, seed);
+            break;
+        case RoundingMode::Stochastic:
+            detail::bulk_convert_impl<Y, X, RoundingMode::Stochastic>(src, dst, n, seed);
+            break;
+        default:
+            detail::bulk_convert_impl<Y, X, RoundingMode::NearestEven>(src, dst, n, seed);
+            break;
+        }
+    }
+    else
+    {
+        if(mode != RoundingMode::Default)
+        {
+            throw std::runtime_error("wrong! rounding mode not supported for this conversion");
+        }
+
+        ck_tile::HostThreadPool::instance().parallel_for(
+            n,
+            [&](std::size_t begin, std::size_t end) {
+                for(std::size_t i = begin; i < end; ++i)
+                    dst[i] = ck::type_convert<Y>(src[i]);
+            },
+            0,
+            detail::kConvertBlock);
+    }
+}
+
+} // namespace utils
+} // namespace ck
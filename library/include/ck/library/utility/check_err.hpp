@@ -4,13 +4,19 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib>
+#include <cstring>
 #include <iostream>
 #include <iomanip>
 #include <iterator>
 #include <limits>
+#include <numeric>
+#include <string>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "ck/ck.hpp"
@@ -18,161 +24,862 @@
 #include "ck/utility/type.hpp"
 #include "ck/host_utility/io.hpp"
 
+#include "ck/library/utility/bulk_convert.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_view.hpp"
 #include "ck/library/utility/ranges.hpp"
 
+#include "ck_tile/host/host_thread_pool.hpp"
+
 namespace ck {
 namespace utils {
 
-template <typename Range, typename RefRange>
-typename std::enable_if<
-    std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
-        std::is_floating_point_v<ranges::range_value_t<Range>> &&
-        !std::is_same_v<ranges::range_value_t<Range>, half_t>,
-    bool>::type
-check_err(const Range& out,
-          const RefRange& ref,
-          const std::string& msg = "Error: Incorrect results!",
-          double rtol            = 1e-5,
-          double atol            = 3e-6)
+// Result of an elementwise comparison of an output range against a reference range.
+//
+// An element is wrong if |out - ref| > atol + rtol * |ref| or if either value is not finite
+// (integral types only use atol). Besides the error count the report carries the distance
+// in units in the last place of the element type, a histogram of those distances over all
+// elements and over every tile, the per-tile error counts and the worst offending element.
+struct CheckErrReport
 {
-    if(out.size() != ref.size())
+    // 0 ulp, [1, 2), [2, 4), ..., [2^31, 2^32), >= 2^32 ulp, non-finite
+    static constexpr std::size_t kNumUlpBucket        = 35;
+    static constexpr std::size_t kNumReportedMismatch = 4;
+    static constexpr std::size_t kDefaultTileSize     = std::size_t{1} << 16;
+
+    struct Mismatch
+    {
+        std::size_t index_;
+        double out_;
+        double ref_;
+    };
+
+    struct TileError
+    {
+        std::size_t tile_;
+        std::size_t num_error_;
+        double max_err_;
+    };
+
+    std::size_t size_      = 0;
+    std::size_t ref_size_  = 0;
+    std::size_t tile_size_ = kDefaultTileSize;
+    std::size_t num_tile_  = 0;
+    bool is_integral_      = false;
+
+    std::size_t num_error_     = 0;
+    std::size_t num_nonfinite_ = 0;
+
+    // largest |out - ref| among the wrong elements
+    double max_err_ = 0;
+    // largest |out - ref| and |out - ref| / |ref| among all finite elements
+    double max_abs_err_ = 0;
+    double max_rel_err_ = 0;
+    // largest ulp distance among all finite elements
+    std::uint64_t max_ulp_ = 0;
+
+    using UlpHistogram = std::array<std::size_t, kNumUlpBucket>;
+
+    UlpHistogram ulp_histogram_{};
+
+    // first wrong elements in index order
+    std::vector<Mismatch> mismatches_;
+
+    // element with the largest error, wrong elements ranked first and non-finite ones highest
+    bool has_worst_ = false;
+    Mismatch worst_{};
+    // multi-index of the worst element, filled in when the output is a host Tensor
+    std::vector<std::size_t> worst_coordinate_;
+
+    // tiles of tile_size_ consecutive elements that contain wrong elements, in tile order
+    std::vector<TileError> tile_errors_;
+    // ulp histogram of every tile, in tile order; ulp_histogram_ is their sum
+    std::vector<UlpHistogram> tile_ulp_histograms_;
+
+    bool IsPass() const { return size_ == ref_size_ && num_error_ == 0; }
+
+    // Append the report of the next part of a comparison that is split into consecutive parts.
+    // The elements of the part are numbered from index_offset, its tiles after the tiles
+    // already appended, so that tiles never straddle two parts.
+    void Append(const CheckErrReport& part, std::size_t index_offset)
     {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
-        return false;
+        const std::size_t tile_offset = num_tile_;
+        const auto worst_rank         = GetWorstRank();
+
+        size_ += part.size_;
+        ref_size_ += part.ref_size_;
+        tile_size_   = part.tile_size_;
+        num_tile_    = tile_offset + part.num_tile_;
+        is_integral_ = part.is_integral_;
+
+        num_error_ += part.num_error_;
+        num_nonfinite_ += part.num_nonfinite_;
+        max_err_     = std::max(max_err_, part.max_err_);
+        max_abs_err_ = std::max(max_abs_err_, part.max_abs_err_);
+        max_rel_err_ = std::max(max_rel_err_, part.max_rel_err_);
+        max_ulp_     = std::max(max_ulp_, part.max_ulp_);
+
+        for(std::size_t b = 0; b < kNumUlpBucket; ++b)
+            ulp_histogram_[b] += part.ulp_histogram_[b];
+
+        for(const auto& mismatch : part.mismatches_)
+            if(mismatches_.size() < kNumReportedMismatch)
+                mismatches_.push_back(
+                    {mismatch.index_ + index_offset, mismatch.out_, mismatch.ref_});
+
+        for(const auto& tile : part.tile_errors_)
+            tile_errors_.push_back({tile.tile_ + tile_offset, tile.num_error_, tile.max_err_});
+
+        tile_ulp_histograms_.insert(tile_ulp_histograms_.end(),
+                                    part.tile_ulp_histograms_.begin(),
+                                    part.tile_ulp_histograms_.end());
+
+        if(part.has_worst_ && (!has_worst_ || part.GetWorstRank() > worst_rank))
+        {
+            has_worst_ = true;
+            worst_     = part.worst_;
+            worst_.index_ += index_offset;
+            worst_coordinate_ = part.worst_coordinate_;
+        }
     }
 
-    bool res{true};
-    int err_count  = 0;
-    double err     = 0;
-    double max_err = std::numeric_limits<double>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
+    // the worst element is wrong if any element is; among those with the same verdict the
+    // larger error ranks higher, non-finite values highest
+    std::pair<bool, double> GetWorstRank() const
     {
-        const double o = *std::next(std::begin(out), i);
-        const double r = *std::next(std::begin(ref), i);
-        err            = std::abs(o - r);
-        if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
+        const bool finite = std::abs(worst_.out_) <= std::numeric_limits<double>::max() &&
+                            std::abs(worst_.ref_) <= std::numeric_limits<double>::max();
+
+        return {num_error_ > 0,
+                finite ? std::abs(worst_.out_ - worst_.ref_)
+                       : std::numeric_limits<double>::infinity()};
+    }
+
+    static std::size_t GetUlpBucket(std::uint64_t ulp)
+    {
+        if(ulp == 0)
+            return 0;
+
+        const auto log2_ulp = static_cast<std::size_t>(63 - __builtin_clzll(ulp));
+
+        return std::min(log2_ulp + 1, kNumUlpBucket - 2);
+    }
+
+    // report the failure in the format of the former check_err(), followed by the ulp,
+    // worst offender and tile statistics; prints nothing on success
+    void Print(std::ostream& os, const std::string& msg) const
+    {
+        if(size_ != ref_size_)
+        {
+            os << msg << " out.size() != ref.size(), :" << size_ << " != " << ref_size_
+               << std::endl;
+            return;
+        }
+
+        if(IsPass())
+            return;
+
+        auto print_value = [&](double v) {
+            if(is_integral_)
+                os << static_cast<int64_t>(v);
+            else
+                os << v;
+        };
+
+        for(const auto& mismatch : mismatches_)
         {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
+            os << msg;
+            if(!is_integral_)
+                os << std::setw(12) << std::setprecision(7);
+            os << " out[" << mismatch.index_ << "] != ref[" << mismatch.index_ << "]: ";
+            print_value(mismatch.out_);
+            os << " != ";
+            print_value(mismatch.ref_);
+            os << std::endl;
+        }
+
+        const float error_percent =
+            static_cast<float>(num_error_) / static_cast<float>(size_) * 100.f;
+        os << "max err: ";
+        print_value(max_err_);
+        os << ", number of errors: " << num_error_;
+        os << ", " << error_percent << "% wrong values" << std::endl;
+
+        if(num_nonfinite_ > 0)
+            os << "non-finite values: " << num_nonfinite_ << std::endl;
+
+        if(has_worst_)
+        {
+            os << "max ulp: " << max_ulp_ << ", worst: out[" << worst_.index_ << "]";
+            if(!worst_coordinate_.empty())
             {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
+                os << " at (";
+                for(std::size_t i = 0; i < worst_coordinate_.size(); ++i)
+                    os << (i == 0 ? "" : ", ") << worst_coordinate_[i];
+                os << ")";
             }
-            res = false;
+            os << ": ";
+            print_value(worst_.out_);
+            os << " != ";
+            print_value(worst_.ref_);
+            os << std::endl;
+        }
+
+        os << "ulp histogram:";
+        PrintUlpHistogram(os, ulp_histogram_);
+        os << std::endl;
+
+        os << "tiles with errors: " << tile_errors_.size() << " of " << num_tile_ << " (tile size "
+           << tile_size_ << ")";
+
+        std::vector<TileError> worst_tiles(tile_errors_);
+        const std::size_t num_print = std::min(kNumReportedMismatch, worst_tiles.size());
+        std::partial_sort(worst_tiles.begin(),
+                          worst_tiles.begin() + num_print,
+                          worst_tiles.end(),
+                          [](const TileError& a, const TileError& b) {
+                              return a.num_error_ != b.num_error_ ? a.num_error_ > b.num_error_
+                                                                  : a.tile_ < b.tile_;
+                          });
+        for(std::size_t i = 0; i < num_print; ++i)
+        {
+            os << (i == 0 ? ", most errors in tile " : ", tile ") << worst_tiles[i].tile_ << ": "
+               << worst_tiles[i].num_error_ << " errors, max err ";
+            print_value(worst_tiles[i].max_err_);
+        }
+        os << std::endl;
+
+        for(std::size_t i = 0; i < num_print; ++i)
+        {
+            const std::size_t t = worst_tiles[i].tile_;
+            if(t >= tile_ulp_histograms_.size())
+                continue;
+
+            os << "ulp histogram of tile " << t << ":";
+            PrintUlpHistogram(os, tile_ulp_histograms_[t]);
+            os << std::endl;
         }
     }
-    if(!res)
+
+    // the non-empty buckets as " [lo, hi): count"
+    static void PrintUlpHistogram(std::ostream& os, const UlpHistogram& histogram)
     {
-        const float error_percent =
-            static_cast<float>(err_count) / static_cast<float>(out.size()) * 100.f;
-        std::cerr << "max err: " << max_err;
-        std::cerr << ", number of errors: " << err_count;
-        std::cerr << ", " << error_percent << "% wrong values" << std::endl;
+        for(std::size_t b = 0; b < kNumUlpBucket; ++b)
+        {
+            if(histogram[b] == 0)
+                continue;
+
+            if(b == 0)
+                os << " [0]";
+            else if(b == kNumUlpBucket - 1)
+                os << " [nonfinite]";
+            else if(b == kNumUlpBucket - 2)
+                os << " [2^" << b - 1 << ", inf)";
+            else
+                os << " [2^" << b - 1 << ", 2^" << b << ")";
+
+            os << ": " << histogram[b];
+        }
     }
-    return res;
+};
+
+namespace detail {
+
+// element types compared in floating point; everything else is compared as int64_t
+template <typename T>
+inline constexpr bool is_check_err_floating_v =
+    std::is_floating_point_v<T> || is_same_v<T, half_t> || is_same_v<T, bhalf_t> ||
+    is_same_v<T, f8_t> || is_same_v<T, bf8_t>;
+
+// default tolerances of check_err() for element type T: 1e-5 and 3e-6 for float and double,
+// 1e-3 for the narrower floating point types and exact equality for integers
+template <typename T>
+inline constexpr bool is_check_err_wide_floating_v =
+    std::is_floating_point_v<T> && !is_same_v<T, half_t>;
+
+template <typename T>
+inline constexpr double default_check_err_rtol_v =
+    is_check_err_wide_floating_v<T> ? 1e-5 : is_check_err_floating_v<T> ? 1e-3 : 0;
+
+template <typename T>
+inline constexpr double default_check_err_atol_v =
+    is_check_err_wide_floating_v<T> ? 3e-6 : is_check_err_floating_v<T> ? 1e-3 : 0;
+
+template <typename T>
+auto to_check_err_value(const T& x)
+{
+    if constexpr(std::is_floating_point_v<T> && !is_same_v<T, half_t>)
+        return static_cast<double>(x);
+    else if constexpr(is_check_err_floating_v<T>)
+        return static_cast<double>(convert_value<float>(x));
+    else
+        return static_cast<int64_t>(x);
 }
 
-template <typename Range, typename RefRange>
-typename std::enable_if<
-    std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
-        std::is_same_v<ranges::range_value_t<Range>, bhalf_t>,
-    bool>::type
-check_err(const Range& out,
-          const RefRange& ref,
-          const std::string& msg = "Error: Incorrect results!",
-          double rtol            = 1e-3,
-          double atol            = 1e-3)
+// distance between two values in units in the last place of T
+template <typename T>
+std::uint64_t ulp_distance(const T& a, const T& b)
 {
-    if(out.size() != ref.size())
+    if constexpr(is_check_err_floating_v<T> && sizeof(T) <= sizeof(std::uint64_t))
     {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
-        return false;
+        // all floating point element types are sign-magnitude encoded: the magnitude bits are
+        // monotonic in |x|, so the ulp distance is a difference of magnitudes on the same side
+        // of zero and a sum of magnitudes across zero
+        using Bits = std::conditional_t<
+            sizeof(T) == 1,
+            std::uint8_t,
+            std::conditional_t<sizeof(T) == 2,
+                               std::uint16_t,
+                               std::conditional_t<sizeof(T) == 4, std::uint32_t, std::uint64_t>>>;
+
+        constexpr std::uint64_t sign_mask = std::uint64_t{1} << (8 * sizeof(T) - 1);
+
+        Bits bits_a = 0;
+        Bits bits_b = 0;
+        std::memcpy(&bits_a, &a, sizeof(T));
+        std::memcpy(&bits_b, &b, sizeof(T));
+
+        const std::uint64_t mag_a = bits_a & ~sign_mask;
+        const std::uint64_t mag_b = bits_b & ~sign_mask;
+
+        const std::uint64_t same_side = mag_a > mag_b ? mag_a - mag_b : mag_b - mag_a;
+
+        return ((bits_a ^ bits_b) & sign_mask) == 0 ? same_side : mag_a + mag_b;
+    }
+    else if constexpr(is_check_err_floating_v<T>)
+    {
+        return ulp_distance(static_cast<double>(a), static_cast<double>(b));
+    }
+    else
+    {
+        const auto int_a = static_cast<int64_t>(a);
+        const auto int_b = static_cast<int64_t>(b);
+
+        // wraps correctly even where int_a - int_b overflows
+        const auto diff = static_cast<std::uint64_t>(int_a) - static_cast<std::uint64_t>(int_b);
+
+        return int_a > int_b ? diff : std::uint64_t{0} - diff;
     }
+}
+
+// statistics of one tile, merged in tile order so that the report is independent of the
+// number of threads
+struct CheckErrTileResult
+{
+    std::size_t num_error     = 0;
+    std::size_t num_nonfinite = 0;
+    double max_err            = 0;
+    double max_abs_err        = 0;
+    double max_rel_err        = 0;
+    std::uint64_t max_ulp     = 0;
+
+    CheckErrReport::UlpHistogram ulp_histogram{};
+    std::vector<CheckErrReport::Mismatch> mismatches;
+
+    bool has_worst     = false;
+    bool worst_is_bad  = false;
+    double worst_score = 0;
+    CheckErrReport::Mismatch worst{};
+};
+
+template <typename OutIter, typename RefIter>
+[[gnu::always_inline]] inline void check_err_tile_impl(OutIter out,
+                                                       RefIter ref,
+                                                       std::size_t begin,
+                                                       std::size_t end,
+                                                       double rtol,
+                                                       double atol,
+                                                       CheckErrTileResult& result)
+{
+    using T     = std::remove_cv_t<std::remove_reference_t<decltype(out[0])>>;
+    using Value = decltype(to_check_err_value(std::declval<T>()));
+
+    constexpr bool is_floating = is_check_err_floating_v<T>;
+
+    // elements are converted and compared in fixed-size blocks with branch-free loops that the
+    // compiler turns into SIMD code; the maxima are kept per lane and only reduced once per tile,
+    // and only blocks holding wrong elements take the scalar path
+    constexpr std::size_t kBlock = 64;
+
+    Value o[kBlock];
+    Value r[kBlock];
+    double err[kBlock];
+    std::uint64_t ulp[kBlock];
+    // 0/1 flags as wide as the values, so that the flag and value lanes line up
+    std::uint64_t finite[kBlock];
+    std::uint64_t bad[kBlock];
 
-    bool res{true};
-    int err_count = 0;
-    double err    = 0;
-    // TODO: This is a hack. We should have proper specialization for bhalf_t data type.
-    double max_err = std::numeric_limits<float>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
+    // largest finite error of every lane and its first index, -1 marks an unused lane
+    double lane_err[kBlock];
+    std::size_t lane_err_index[kBlock];
+    double lane_rel[kBlock];
+    std::uint64_t lane_ulp[kBlock];
+
+    std::fill_n(lane_err, kBlock, -1.0);
+    std::fill_n(lane_err_index, kBlock, begin);
+    std::fill_n(lane_rel, kBlock, 0.0);
+    std::fill_n(lane_ulp, kBlock, std::uint64_t{0});
+
+    // interleaved sub-histograms keep runs of equal buckets from serializing on one counter
+    constexpr std::size_t kNumSubHistogram = 4;
+
+    std::size_t histogram[kNumSubHistogram][CheckErrReport::kNumUlpBucket] = {};
+
+    for(std::size_t block_begin = begin; block_begin < end; block_begin += kBlock)
     {
-        const double o = type_convert<float>(*std::next(std::begin(out), i));
-        const double r = type_convert<float>(*std::next(std::begin(ref), i));
-        err            = std::abs(o - r);
-        if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
+        const std::size_t n = std::min(kBlock, end - block_begin);
+
+        for(std::size_t j = 0; j < n; ++j)
         {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
+            o[j]   = to_check_err_value(out[block_begin + j]);
+            r[j]   = to_check_err_value(ref[block_begin + j]);
+            ulp[j] = ulp_distance(out[block_begin + j], ref[block_begin + j]);
+        }
+
+        std::size_t num_bad = 0;
+        for(std::size_t j = 0; j < n; ++j)
+        {
+            double abs_ref;
+            if constexpr(is_floating)
             {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
+                // NaN compares false, infinities exceed the largest finite value
+                abs_ref             = std::abs(r[j]);
+                const bool finite_o = std::abs(o[j]) <= std::numeric_limits<double>::max();
+                const bool finite_r = abs_ref <= std::numeric_limits<double>::max();
+                const bool over_tol = std::abs(o[j] - r[j]) > atol + rtol * abs_ref;
+
+                err[j]    = std::abs(o[j] - r[j]);
+                finite[j] = static_cast<std::uint64_t>(finite_o & finite_r);
+                bad[j]    = static_cast<std::uint64_t>(over_tol | (finite[j] == 0));
+            }
+            else
+            {
+                const int64_t diff = o[j] - r[j];
+                abs_ref            = static_cast<double>(r[j] < 0 ? -r[j] : r[j]);
+                err[j]             = static_cast<double>(diff < 0 ? -diff : diff);
+                finite[j]          = 1;
+                bad[j]             = static_cast<std::uint64_t>(err[j] > atol);
+            }
+            num_bad += bad[j];
+
+            const double e     = finite[j] ? err[j] : -1.0;
+            const bool has_rel = (finite[j] != 0) & (abs_ref > 0);
+            const double rel   = has_rel ? err[j] / abs_ref : 0.0;
+            const auto u       = finite[j] ? ulp[j] : std::uint64_t{0};
+
+            lane_err_index[j] = e > lane_err[j] ? block_begin + j : lane_err_index[j];
+            lane_err[j]       = e > lane_err[j] ? e : lane_err[j];
+            lane_rel[j]       = rel > lane_rel[j] ? rel : lane_rel[j];
+            lane_ulp[j]       = u > lane_ulp[j] ? u : lane_ulp[j];
+        }
+
+        for(std::size_t j = 0; j < n; ++j)
+            ++histogram[j % kNumSubHistogram][finite[j] ? CheckErrReport::GetUlpBucket(ulp[j])
+                                                        : CheckErrReport::kNumUlpBucket - 1];
+
+        if(num_bad == 0)
+            continue;
+
+        for(std::size_t j = 0; j < n; ++j)
+        {
+            if(!bad[j])
+                continue;
+
+            const std::size_t i = block_begin + j;
+
+            // NaN errors compare false, so rank non-finite elements explicitly
+            const double score = finite[j] ? err[j] : std::numeric_limits<double>::infinity();
+
+            ++result.num_error;
+            result.num_nonfinite += static_cast<std::size_t>(!finite[j]);
+            result.max_err = err[j] > result.max_err ? err[j] : result.max_err;
+
+            if(result.mismatches.size() < CheckErrReport::kNumReportedMismatch)
+                result.mismatches.push_back(
+                    {i, static_cast<double>(o[j]), static_cast<double>(r[j])});
+
+            if(!result.worst_is_bad || score > result.worst_score)
+            {
+                result.has_worst    = true;
+                result.worst_is_bad = true;
+                result.worst_score  = score;
+                result.worst        = {i, static_cast<double>(o[j]), static_cast<double>(r[j])};
             }
-            res = false;
         }
     }
-    if(!res)
+
+    for(std::size_t h = 0; h < kNumSubHistogram; ++h)
+        for(std::size_t b = 0; b < CheckErrReport::kNumUlpBucket; ++b)
+            result.ulp_histogram[b] += histogram[h][b];
+
+    double max_err           = -1.0;
+    std::size_t max_err_index = begin;
+
+    for(std::size_t j = 0; j < kBlock; ++j)
     {
-        const float error_percent =
-            static_cast<float>(err_count) / static_cast<float>(out.size()) * 100.f;
-        std::cerr << "max err: " << max_err;
-        std::cerr << ", number of errors: " << err_count;
-        std::cerr << ", " << error_percent << "% wrong values" << std::endl;
+        if(lane_err[j] > max_err || (!(lane_err[j] < max_err) && lane_err_index[j] < max_err_index))
+        {
+            max_err       = lane_err[j];
+            max_err_index = lane_err_index[j];
+        }
+
+        result.max_rel_err = std::max(result.max_rel_err, lane_rel[j]);
+        result.max_ulp     = std::max(result.max_ulp, lane_ulp[j]);
+    }
+
+    if(max_err >= 0)
+    {
+        result.max_abs_err = max_err;
+
+        // without wrong elements the worst one is the one with the largest error
+        if(!result.worst_is_bad)
+        {
+            result.has_worst   = true;
+            result.worst_score = max_err;
+            result.worst       = {max_err_index,
+                            static_cast<double>(to_check_err_value(out[max_err_index])),
+                            static_cast<double>(to_check_err_value(ref[max_err_index]))};
+        }
     }
-    return res;
 }
 
-template <typename Range, typename RefRange>
-typename std::enable_if<
-    std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
-        std::is_same_v<ranges::range_value_t<Range>, half_t>,
-    bool>::type
-check_err(const Range& out,
-          const RefRange& ref,
-          const std::string& msg = "Error: Incorrect results!",
-          double rtol            = 1e-3,
-          double atol            = 1e-3)
+template <typename OutIter, typename RefIter>
+using check_err_tile_kernel_t = void (*)(
+    OutIter, RefIter, std::size_t, std::size_t, double, double, CheckErrTileResult&);
+
+template <typename OutIter, typename RefIter>
+void check_err_tile_generic(OutIter out,
+                            RefIter ref,
+                            std::size_t begin,
+                            std::size_t end,
+                            double rtol,
+                            double atol,
+                            CheckErrTileResult& result)
+{
+    check_err_tile_impl(out, ref, begin, end, rtol, atol, result);
+}
+
+#if defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__)
+// the lane maxima need 64-bit integer compares, which the baseline x86-64 ISA lacks
+template <typename OutIter, typename RefIter>
+__attribute__((target("avx2"))) void check_err_tile_avx2(OutIter out,
+                                                         RefIter ref,
+                                                         std::size_t begin,
+                                                         std::size_t end,
+                                                         double rtol,
+                                                         double atol,
+                                                         CheckErrTileResult& result)
+{
+    check_err_tile_impl(out, ref, begin, end, rtol, atol, result);
+}
+
+template <typename OutIter, typename RefIter>
+__attribute__((target("avx512f"))) void check_err_tile_avx512(OutIter out,
+                                                              RefIter ref,
+                                                              std::size_t begin,
+                                                              std::size_t end,
+                                                              double rtol,
+                                                              double atol,
+                                                              CheckErrTileResult& result)
+{
+    check_err_tile_impl(out, ref, begin, end, rtol, atol, result);
+}
+#endif
+
+// pick the widest tile kernel the running CPU supports
+template <typename OutIter, typename RefIter>
+check_err_tile_kernel_t<OutIter, RefIter> get_check_err_tile_kernel()
+{
+    static const check_err_tile_kernel_t<OutIter, RefIter> kernel = [] {
+#if defined(__x86_64__) && !defined(__HIP_DEVICE_COMPILE__)
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx512f"))
+            return &check_err_tile_avx512<OutIter, RefIter>;
+        if(__builtin_cpu_supports("avx2"))
+            return &check_err_tile_avx2<OutIter, RefIter>;
+#endif
+        return &check_err_tile_generic<OutIter, RefIter>;
+    }();
+
+    return kernel;
+}
+
+template <typename R, typename = void>
+struct has_lengths_and_strides : std::false_type
+{
+};
+
+template <typename R>
+struct has_lengths_and_strides<
+    R,
+    std::void_t<decltype(std::declval<const R&>().GetLengths()),
+                decltype(std::declval<const R&>().GetStrides())>> : std::true_type
+{
+};
+
+// ranges that iterate in index order rather than over the element space, e.g. TensorView,
+// provide the multi-index of the i-th element themselves
+template <typename R, typename = void>
+struct has_multi_index : std::false_type
+{
+};
+
+template <typename R>
+struct has_multi_index<
+    R,
+    std::void_t<decltype(std::declval<const R&>().GetMultiIndex(std::size_t{}))>>
+    : std::true_type
+{
+};
+
+template <typename R>
+struct is_host_tensor : std::false_type
 {
-    if(out.size() != ref.size())
+};
+
+template <typename T>
+struct is_host_tensor<Tensor<T>> : std::true_type
+{
+};
+
+// recover the multi-index of an element offset from the lengths and strides of a tensor whose
+// elements do not overlap; returns an empty vector if the offset is not addressed
+template <typename Lengths, typename Strides>
+std::vector<std::size_t>
+offset_to_coordinate(std::size_t offset, const Lengths& lengths, const Strides& strides)
+{
+    const std::size_t rank = std::size(lengths);
+
+    std::vector<std::size_t> order(rank);
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&](std::size_t a, std::size_t b) {
+        return strides[a] > strides[b];
+    });
+
+    std::vector<std::size_t> coord(rank, 0);
+    std::size_t remaining = offset;
+
+    for(const std::size_t d : order)
     {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
-        return false;
+        const auto stride = static_cast<std::size_t>(strides[d]);
+        const auto length = static_cast<std::size_t>(lengths[d]);
+
+        if(stride == 0)
+            continue;
+
+        coord[d] = std::min(remaining / stride, length - 1);
+        remaining -= coord[d] * stride;
     }
 
-    bool res{true};
-    int err_count  = 0;
-    double err     = 0;
-    double max_err = NumericLimits<ranges::range_value_t<Range>>::Min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
+    if(remaining != 0)
+        return {};
+
+    return coord;
+}
+
+} // namespace detail
+
+// compare out against ref on the host thread pool, the element types must match
+template <typename Range, typename RefRange>
+CheckErrReport check_err_report(const Range& out,
+                                const RefRange& ref,
+                                double rtol           = 1e-5,
+                                double atol           = 3e-6,
+                                std::size_t tile_size = CheckErrReport::kDefaultTileSize)
+{
+    using T = ranges::range_value_t<Range>;
+
+    static_assert(std::is_same_v<T, ranges::range_value_t<RefRange>>,
+                  "wrong! out and ref must have the same element type");
+
+    // a tensor iterates over its element space and a view in index order, so a tensor compared
+    // against a view is compared through a view of it, which matches the elements by index
+    if constexpr(detail::is_host_tensor<Range>::value && detail::has_multi_index<RefRange>::value)
+        return check_err_report(TensorView<const T>(out), ref, rtol, atol, tile_size);
+    else if constexpr(detail::has_multi_index<Range>::value &&
+                      detail::is_host_tensor<RefRange>::value)
+        return check_err_report(out, TensorView<const T>(ref), rtol, atol, tile_size);
+
+    CheckErrReport report;
+
+    report.size_        = std::size(out);
+    report.ref_size_    = std::size(ref);
+    report.tile_size_   = std::max<std::size_t>(tile_size, 1);
+    report.is_integral_ = !detail::is_check_err_floating_v<T>;
+
+    if(report.size_ != report.ref_size_)
+        return report;
+
+    const std::size_t num_tile = (report.size_ + report.tile_size_ - 1) / report.tile_size_;
+
+    report.num_tile_ = num_tile;
+
+    std::vector<detail::CheckErrTileResult> tiles(num_tile);
+
+    using OutIter = decltype(std::begin(out));
+    using RefIter = decltype(std::begin(ref));
+
+    constexpr bool is_random_access =
+        std::is_base_of_v<std::random_access_iterator_tag,
+                          typename std::iterator_traits<OutIter>::iterator_category> &&
+        std::is_base_of_v<std::random_access_iterator_tag,
+                          typename std::iterator_traits<RefIter>::iterator_category>;
+
+    if constexpr(is_random_access)
     {
-        const double o = type_convert<float>(*std::next(std::begin(out), i));
-        const double r = type_convert<float>(*std::next(std::begin(ref), i));
-        err            = std::abs(o - r);
-        if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
+        const auto out_begin = std::begin(out);
+        const auto ref_begin = std::begin(ref);
+
+        const auto tile_kernel = detail::get_check_err_tile_kernel<OutIter, RefIter>();
+
+        ck_tile::HostThreadPool::instance().parallel_for(
+            num_tile, [&](std::size_t tile_begin, std::size_t tile_end) {
+                for(std::size_t t = tile_begin; t < tile_end; ++t)
+                {
+                    const std::size_t begin = t * report.tile_size_;
+                    const std::size_t end   = std::min(begin + report.tile_size_, report.size_);
+
+                    tile_kernel(out_begin, ref_begin, begin, end, rtol, atol, tiles[t]);
+                }
+            });
+    }
+    else
+    {
+        // ranges that cannot be indexed are walked once on the calling thread, every tile is
+        // copied into a buffer and checked there
+        std::vector<T> out_tile(std::min(report.tile_size_, report.size_));
+        std::vector<T> ref_tile(out_tile.size());
+
+        auto out_it = std::begin(out);
+        auto ref_it = std::begin(ref);
+
+        const auto tile_kernel = detail::get_check_err_tile_kernel<const T*, const T*>();
+
+        for(std::size_t t = 0; t < num_tile; ++t)
         {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
+            const std::size_t begin = t * report.tile_size_;
+            const std::size_t n     = std::min(report.tile_size_, report.size_ - begin);
+
+            for(std::size_t i = 0; i < n; ++i, ++out_it, ++ref_it)
             {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
+                out_tile[i] = *out_it;
+                ref_tile[i] = *ref_it;
             }
-            res = false;
+
+            auto& tile = tiles[t];
+
+            tile_kernel(out_tile.data(), ref_tile.data(), 0, n, rtol, atol, tile);
+
+            for(auto& mismatch : tile.mismatches)
+                mismatch.index_ += begin;
+            if(tile.has_worst)
+                tile.worst.index_ += begin;
         }
     }
-    if(!res)
+
+    detail::CheckErrTileResult worst;
+
+    report.tile_ulp_histograms_.reserve(num_tile);
+
+    for(std::size_t t = 0; t < num_tile; ++t)
     {
-        const float error_percent =
-            static_cast<float>(err_count) / static_cast<float>(out.size()) * 100.f;
-        std::cerr << "max err: " << max_err;
-        std::cerr << ", number of errors: " << err_count;
-        std::cerr << ", " << error_percent << "% wrong values" << std::endl;
+        const auto& tile = tiles[t];
+
+        report.num_error_ += tile.num_error;
+        report.num_nonfinite_ += tile.num_nonfinite;
+        report.max_err_     = std::max(report.max_err_, tile.max_err);
+        report.max_abs_err_ = std::max(report.max_abs_err_, tile.max_abs_err);
+        report.max_rel_err_ = std::max(report.max_rel_err_, tile.max_rel_err);
+        report.max_ulp_     = std::max(report.max_ulp_, tile.max_ulp);
+
+        for(std::size_t b = 0; b < CheckErrReport::kNumUlpBucket; ++b)
+            report.ulp_histogram_[b] += tile.ulp_histogram[b];
+
+        report.tile_ulp_histograms_.push_back(tile.ulp_histogram);
+
+        for(const auto& mismatch : tile.mismatches)
+            if(report.mismatches_.size() < CheckErrReport::kNumReportedMismatch)
+                report.mismatches_.push_back(mismatch);
+
+        if(tile.num_error > 0)
+            report.tile_errors_.push_back({t, tile.num_error, tile.max_err});
+
+        if(tile.has_worst &&
+           (!worst.has_worst || (tile.worst_is_bad && !worst.worst_is_bad) ||
+            (tile.worst_is_bad == worst.worst_is_bad && tile.worst_score > worst.worst_score)))
+        {
+            worst.has_worst    = true;
+            worst.worst_is_bad = tile.worst_is_bad;
+            worst.worst_score  = tile.worst_score;
+            worst.worst        = tile.worst;
+        }
+    }
+
+    report.has_worst_ = worst.has_worst;
+    report.worst_     = worst.worst;
+
+    if constexpr(detail::has_multi_index<Range>::value)
+    {
+        if(report.has_worst_)
+            report.worst_coordinate_ = out.GetMultiIndex(report.worst_.index_);
+    }
+    else if constexpr(detail::has_lengths_and_strides<Range>::value)
+    {
+        if(report.has_worst_)
+            report.worst_coordinate_ = detail::offset_to_coordinate(
+                report.worst_.index_, out.GetLengths(), out.GetStrides());
     }
-    return res;
+
+    return report;
+}
+
+template <typename Range, typename RefRange>
+typename std::enable_if<
+    std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
+        std::is_floating_point_v<ranges::range_value_t<Range>> &&
+        !std::is_same_v<ranges::range_value_t<Range>, half_t>,
+    bool>::type
+check_err(const Range& out,
+          const RefRange& ref,
+          const std::string& msg = "Error: Incorrect results!",
+          double rtol            = detail::default_check_err_rtol_v<ranges::range_value_t<Range>>,
+          double atol            = detail::default_check_err_atol_v<ranges::range_value_t<Range>>)
+{
+    const auto report = check_err_report(out, ref, rtol, atol);
+    report.Print(std::cerr, msg);
+    return report.IsPass();
+}
+
+template <typename Range, typename RefRange>
+typename std::enable_if<
+    std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
+        std::is_same_v<ranges::range_value_t<Range>, bhalf_t>,
+    bool>::type
+check_err(const Range& out,
+          const RefRange& ref,
+          const std::string& msg = "Error: Incorrect results!",
+          double rtol            = detail::default_check_err_rtol_v<ranges::range_value_t<Range>>,
+          double atol            = detail::default_check_err_atol_v<ranges::range_value_t<Range>>)
+{
+    const auto report = check_err_report(out, ref, rtol, atol);
+    report.Print(std::cerr, msg);
+    return report.IsPass();
+}
+
+template <typename Range, typename RefRange>
+typename std::enable_if<
+    std::is_same_v<ranges::range_value_t<Range>, ranges::range_value_t<RefRange>> &&
+        std::is_same_v<ranges::range_value_t<Range>, half_t>,
+    bool>::type
+check_err(const Range& out,
+          const RefRange& ref,
+          const std::string& msg = "Error: Incorrect results!",
+          double rtol            = detail::default_check_err_rtol_v<ranges::range_value_t<Range>>,
+          double atol            = detail::default_check_err_atol_v<ranges::range_value_t<Range>>)
+{
+    const auto report = check_err_report(out, ref, rtol, atol);
+    report.Print(std::cerr, msg);
+    return report.IsPass();
 }
 
 template <typename Range, typename RefRange>
@@ -190,46 +897,11 @@ check_err(const Range& out,
           const RefRange& ref,
           const std::string& msg = "Error: Incorrect results!",
           double                 = 0,
-          double atol            = 0)
+          double atol            = detail::default_check_err_atol_v<ranges::range_value_t<Range>>)
 {
-    if(out.size() != ref.size())
-    {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
-        return false;
-    }
-
-    bool res{true};
-    int err_count   = 0;
-    int64_t err     = 0;
-    int64_t max_err = std::numeric_limits<int64_t>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
-    {
-        const int64_t o = *std::next(std::begin(out), i);
-        const int64_t r = *std::next(std::begin(ref), i);
-        err             = std::abs(o - r);
-
-        if(err > atol)
-        {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
-            {
-                std::cerr << msg << " out[" << i << "] != ref[" << i << "]: " << o << " != " << r
-                          << std::endl;
-            }
-            res = false;
-        }
-    }
-    if(!res)
-    {
-        const float error_percent =
-            static_cast<float>(err_count) / static_cast<float>(out.size()) * 100.f;
-        std::cerr << "max err: " << max_err;
-        std::cerr << ", number of errors: " << err_count;
-        std::cerr << ", " << error_percent << "% wrong values" << std::endl;
-    }
-    return res;
+    const auto report = check_err_report(out, ref, 0, atol);
+    report.Print(std::cerr, msg);
+    return report.IsPass();
 }
 
 template <typename Range, typename RefRange>
@@ -239,43 +911,12 @@ std::enable_if_t<(std::is_same_v<ranges::range_value_t<Range>, ranges::range_val
 check_err(const Range& out,
           const RefRange& ref,
           const std::string& msg = "Error: Incorrect results!",
-          double rtol            = 1e-3,
-          double atol            = 1e-3)
+          double rtol            = detail::default_check_err_rtol_v<ranges::range_value_t<Range>>,
+          double atol            = detail::default_check_err_atol_v<ranges::range_value_t<Range>>)
 {
-    if(out.size() != ref.size())
-    {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
-        return false;
-    }
-
-    bool res{true};
-    int err_count  = 0;
-    double err     = 0;
-    double max_err = std::numeric_limits<float>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
-    {
-        const double o = type_convert<float>(*std::next(std::begin(out), i));
-        const double r = type_convert<float>(*std::next(std::begin(ref), i));
-        err            = std::abs(o - r);
-        if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
-        {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
-            {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
-            }
-            res = false;
-        }
-    }
-    if(!res)
-    {
-        std::cerr << std::setw(12) << std::setprecision(7) << "max err: " << max_err
-                  << " number of errors: " << err_count << std::endl;
-    }
-    return res;
+    const auto report = check_err_report(out, ref, rtol, atol);
+    report.Print(std::cerr, msg);
+    return report.IsPass();
 }
 
 template <typename Range, typename RefRange>
@@ -285,42 +926,12 @@ std::enable_if_t<(std::is_same_v<ranges::range_value_t<Range>, ranges::range_val
 check_err(const Range& out,
           const RefRange& ref,
           const std::string& msg = "Error: Incorrect results!",
-          double rtol            = 1e-3,
-          double atol            = 1e-3)
+          double rtol            = detail::default_check_err_rtol_v<ranges::range_value_t<Range>>,
+          double atol            = detail::default_check_err_atol_v<ranges::range_value_t<Range>>)
 {
-    if(out.size() != ref.size())
-    {
-        std::cerr << msg << " out.size() != ref.size(), :" << out.size() << " != " << ref.size()
-                  << std::endl;
-        return false;
-    }
-
-    bool res{true};
-    int err_count  = 0;
-    double err     = 0;
-    double max_err = std::numeric_limits<float>::min();
-    for(std::size_t i = 0; i < ref.size(); ++i)
-    {
-        const double o = type_convert<float>(*std::next(std::begin(out), i));
-        const double r = type_convert<float>(*std::next(std::begin(ref), i));
-        err            = std::abs(o - r);
-        if(err > atol + rtol * std::abs(r) || !std::isfinite(o) || !std::isfinite(r))
-        {
-            max_err = err > max_err ? err : max_err;
-            err_count++;
-            if(err_count < 5)
-            {
-                std::cerr << msg << std::setw(12) << std::setprecision(7) << " out[" << i
-                          << "] != ref[" << i << "]: " << o << " != " << r << std::endl;
-            }
-            res = false;
-        }
-    }
-    if(!res)
-    {
-        std::cerr << std::setw(12) << std::setprecision(7) << "max err: " << max_err << std::endl;
-    }
-    return res;
+    const auto report = check_err_report(out, ref, rtol, atol);
+    report.Print(std::cerr, msg);
+    return report.IsPass();
 }
 
 } // namespace utils
@@ -0,0 +1,196 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <future>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_view.hpp"
+
+namespace ck {
+namespace utils {
+
+// host memory a slab of check_err_streamed() may take by default
+inline constexpr std::size_t kDefaultStreamedSlabBytes = std::size_t{256} << 20;
+
+// Compare the results of several device operations against one host reference, slab by slab,
+// without holding any of them in host memory in full.
+//
+// The results, all described by desc, are cut along their outermost dimension in memory, the one
+// with the largest stride, into slabs of at most max_slab_bytes. For every slab
+//   compute_reference(ref, dim, begin, end)
+// writes the reference of indices [begin, end) of dimension dim into the TensorView<T> ref, in
+// which dimension dim has length end - begin, once, and for every result i in turn
+//   read_device(i, dst, offset, count)
+// copies count elements of result i from element offset on into dst, e.g. with
+// DeviceMem::FromDevice(dst, count * sizeof(T), offset * sizeof(T)). The reads are done on
+// another thread while the reference is computed and the previous read compared, so host memory
+// is bounded by two device slabs and one reference slab. They never overlap each other, each
+// starts after the previous one returned, so the results may share one device buffer that
+// read_device refills.
+//
+// Element indices of the reports count with dimension dim outermost.
+template <typename T, typename ReadDevice, typename ComputeReference>
+std::vector<CheckErrReport>
+check_err_streamed_reports(const HostTensorDescriptor& desc,
+                           std::size_t num_result,
+                           ReadDevice&& read_device,
+                           ComputeReference&& compute_reference,
+                           double rtol,
+                           double atol,
+                           std::size_t max_slab_bytes = kDefaultStreamedSlabBytes)
+{
+    const auto& lengths = desc.GetLengths();
+    const auto& strides = desc.GetStrides();
+
+    std::vector<CheckErrReport> reports(num_result);
+    for(auto& report : reports)
+        report.is_integral_ = !detail::is_check_err_floating_v<T>;
+
+    if(num_result == 0 || lengths.empty() || desc.GetElementSize() == 0)
+        return reports;
+
+    const auto dim = static_cast<std::size_t>(
+        std::distance(strides.begin(), std::max_element(strides.begin(), strides.end())));
+
+    auto get_slab_desc = [&](std::size_t num_row) {
+        auto slab_lengths = lengths;
+        slab_lengths[dim] = num_row;
+        return HostTensorDescriptor(slab_lengths, strides);
+    };
+
+    // whole hyperplanes of dimension dim per slab, at least one
+    const std::size_t plane_space   = get_slab_desc(1).GetElementSpaceSize();
+    const std::size_t max_slab_size = max_slab_bytes / sizeof(T);
+
+    std::size_t num_row_per_slab = lengths[dim];
+    if(strides[dim] > 0)
+    {
+        num_row_per_slab =
+            max_slab_size > plane_space ? (max_slab_size - plane_space) / strides[dim] + 1 : 1;
+        num_row_per_slab = std::min(num_row_per_slab, lengths[dim]);
+    }
+
+    const std::size_t num_slab   = (lengths[dim] + num_row_per_slab - 1) / num_row_per_slab;
+    const std::size_t plane_size = desc.GetElementSize() / lengths[dim];
+
+    // compare in the order with dimension dim outermost
+    std::vector<std::size_t> new2old{dim};
+    for(std::size_t d = 0; d < lengths.size(); ++d)
+        if(d != dim)
+            new2old.push_back(d);
+
+    // the reads in order: all results of slab 0, then of slab 1, ...
+    const std::size_t num_read = num_slab * num_result;
+
+    std::vector<T> device_slabs[2];
+    std::vector<T> ref_slab;
+
+    auto read_slab = [&](std::size_t read) {
+        const std::size_t slab  = read / num_result;
+        const std::size_t begin = slab * num_row_per_slab;
+        const std::size_t end   = std::min(begin + num_row_per_slab, lengths[dim]);
+
+        auto& device_slab = device_slabs[read % 2];
+        device_slab.resize(get_slab_desc(end - begin).GetElementSpaceSize());
+
+        read_device(
+            read % num_result, device_slab.data(), begin * strides[dim], device_slab.size());
+    };
+
+    auto next_read = std::async(std::launch::async, read_slab, std::size_t{0});
+
+    for(std::size_t read = 0; read < num_read; ++read)
+    {
+        const std::size_t slab  = read / num_result;
+        const std::size_t begin = slab * num_row_per_slab;
+        const std::size_t end   = std::min(begin + num_row_per_slab, lengths[dim]);
+
+        const auto slab_desc = get_slab_desc(end - begin);
+
+        if(read % num_result == 0)
+        {
+            ref_slab.resize(slab_desc.GetElementSpaceSize());
+            compute_reference(TensorView<T>(ref_slab.data(), slab_desc), dim, begin, end);
+        }
+
+        next_read.get();
+
+        // the other buffer was released by the previous comparison
+        if(read + 1 < num_read)
+            next_read = std::async(std::launch::async, read_slab, read + 1);
+
+        const auto out = TensorView<const T>(device_slabs[read % 2].data(), slab_desc);
+        const auto ref = TensorView<const T>(ref_slab.data(), slab_desc);
+
+        auto slab_report = check_err_report(out.Permute(new2old), ref.Permute(new2old), rtol, atol);
+
+        // back to the dimension order of desc and the index of the full result
+        if(!slab_report.worst_coordinate_.empty())
+        {
+            std::vector<std::size_t> coordinate(lengths.size());
+            for(std::size_t i = 0; i < new2old.size(); ++i)
+                coordinate[new2old[i]] = slab_report.worst_coordinate_[i];
+            coordinate[dim] += begin;
+
+            slab_report.worst_coordinate_ = std::move(coordinate);
+        }
+
+        reports[read % num_result].Append(slab_report, begin * plane_size);
+    }
+
+    return reports;
+}
+
+// check_err_streamed_reports() of a single device result
+//   read_device(dst, offset, count)
+template <typename T, typename ReadDevice, typename ComputeReference>
+CheckErrReport check_err_streamed_report(const HostTensorDescriptor& desc,
+                                         ReadDevice&& read_device,
+                                         ComputeReference&& compute_reference,
+                                         double rtol,
+                                         double atol,
+                                         std::size_t max_slab_bytes = kDefaultStreamedSlabBytes)
+{
+    return check_err_streamed_reports<T>(
+               desc,
+               1,
+               [&](std::size_t, T* dst, std::size_t offset, std::size_t count) {
+                   read_device(dst, offset, count);
+               },
+               compute_reference,
+               rtol,
+               atol,
+               max_slab_bytes)
+        .front();
+}
+
+// check_err() of a device result against a host reference computed slab by slab, see
+// check_err_streamed_report(), with the default tolerances of check_err()
+template <typename T, typename ReadDevice, typename ComputeReference>
+bool check_err_streamed(const HostTensorDescriptor& desc,
+                        ReadDevice&& read_device,
+                        ComputeReference&& compute_reference,
+                        const std::string& msg     = "Error: Incorrect results!",
+                        std::size_t max_slab_bytes = kDefaultStreamedSlabBytes)
+{
+    const auto report = check_err_streamed_report<T>(desc,
+                                                     read_device,
+                                                     compute_reference,
+                                                     detail::default_check_err_rtol_v<T>,
+                                                     detail::default_check_err_atol_v<T>,
+                                                     max_slab_bytes);
+    report.Print(std::cerr, msg);
+    return report.IsPass();
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace ck {
+namespace utils {
+
+// Non-cryptographic 128-bit hash of byte blocks, shared by the reference cache keys and the
+// tensor file checksums. Callers hash large ranges as a sequence of fixed size blocks, which can
+// be processed in parallel, and fold the block hashes in order with content_hash_combine().
+struct ContentHash
+{
+    std::uint64_t h0;
+    std::uint64_t h1;
+};
+
+inline constexpr std::uint64_t kContentHashMul0 = 0x87C37B91114253D5;
+inline constexpr std::uint64_t kContentHashMul1 = 0x4CF5AD432745937F;
+
+inline std::uint64_t content_hash_rotl(std::uint64_t x, int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+// murmur3 finalizer
+inline std::uint64_t content_hash_fmix(std::uint64_t k)
+{
+    k ^= k >> 33;
+    k *= 0xFF51AFD7ED558CCD;
+    k ^= k >> 33;
+    k *= 0xC4CEB9FE1A85EC53;
+    k ^= k >> 33;
+    return k;
+}
+
+// four independent multiply-rotate lanes over 32-byte blocks, folded into 128 bits
+inline ContentHash content_hash_block(const void* p, std::size_t n)
+{
+    const auto* bytes = static_cast<const unsigned char*>(p);
+
+    std::uint64_t acc[4] = {
+        kContentHashMul0, kContentHashMul1, ~kContentHashMul0, ~kContentHashMul1};
+
+    auto mix_block = [&](const unsigned char* block) {
+        for(int lane = 0; lane < 4; ++lane)
+        {
+            std::uint64_t w;
+            std::memcpy(&w, block + 8 * lane, sizeof(w));
+            acc[lane] =
+                content_hash_rotl(acc[lane] ^ (w * kContentHashMul0), 31) * kContentHashMul1;
+        }
+    };
+
+    const std::size_t num_block = n / 32;
+    for(std::size_t i = 0; i < num_block; ++i)
+        mix_block(bytes + 32 * i);
+
+    if(const std::size_t tail = n % 32; tail > 0)
+    {
+        unsigned char block[32] = {};
+        std::memcpy(block, bytes + 32 * num_block, tail);
+        mix_block(block);
+    }
+
+    return {content_hash_fmix(acc[0] ^ content_hash_rotl(acc[2], 17) ^ n),
+            content_hash_fmix(acc[1] ^ content_hash_rotl(acc[3], 43) ^ ~n)};
+}
+
+// fold the next block hash into a running hash, order dependent
+inline void content_hash_combine(ContentHash& h, const ContentHash& block)
+{
+    h.h0 = content_hash_rotl(h.h0 ^ block.h0, 27) * kContentHashMul0 + h.h1;
+    h.h1 = content_hash_rotl(h.h1 ^ block.h1, 31) * kContentHashMul1 + h.h0;
+}
+
+} // namespace utils
+} // namespace ck
@@ -29,6 +29,8 @@ struct DeviceMem
     void ToDevice(const void* p, const std::size_t cpySize) const;
     void FromDevice(void* p) const;
     void FromDevice(void* p, const std::size_t cpySize) const;
+    // copy cpySize bytes starting at byte offset of the buffer, e.g. one slab of a result
+    void FromDevice(void* p, const std::size_t cpySize, const std::size_t offset) const;
     void SetZero() const;
     template <typename T>
     void SetValue(T x) const;
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <iterator>
 #include <random>
 #include <type_traits>
@@ -12,6 +13,10 @@
 
 #include "ck/utility/data_type.hpp"
 
+#include "ck/library/utility/bulk_convert.hpp"
+
+#include "ck_tile/host/host_philox.hpp"
+
 namespace ck {
 namespace utils {
 
@@ -24,9 +29,13 @@ struct FillUniformDistribution
     template <typename ForwardIter>
     void operator()(ForwardIter first, ForwardIter last) const
     {
-        std::mt19937 gen(11939);
-        std::uniform_real_distribution<float> dis(a_, b_);
-        std::generate(first, last, [&dis, &gen]() { return ck::type_convert<T>(dis(gen)); });
+        const float a     = a_;
+        const float scale = b_ - a_;
+
+        ck_tile::host_philox_fill(first, last, 11939, [=](std::uint32_t bits) {
+            return ck::utils::convert_value<T>(a +
+                                               scale * ck_tile::HostPhilox::to_uniform_float(bits));
+        });
     }
 
     template <typename ForwardRange>
@@ -68,10 +77,13 @@ struct FillUniformDistributionIntegerValue
     template <typename ForwardIter>
     void operator()(ForwardIter first, ForwardIter last) const
     {
-        std::mt19937 gen(11939);
-        std::uniform_real_distribution<float> dis(a_, b_);
-        std::generate(
-            first, last, [&dis, &gen]() { return ck::type_convert<T>(std::round(dis(gen))); });
+        const float a     = a_;
+        const float scale = b_ - a_;
+
+        ck_tile::host_philox_fill(first, last, 11939, [=](std::uint32_t bits) {
+            return ck::utils::convert_value<T>(
+                std::round(a + scale * ck_tile::HostPhilox::to_uniform_float(bits)));
+        });
     }
 
     template <typename ForwardRange>
@@ -4,10 +4,15 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cstdint>
 #include <iostream>
 #include <numeric>
+#include <stdexcept>
+#include <string>
 #include <thread>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -16,8 +21,12 @@
 #include "ck/utility/type_convert.hpp"
 
 #include "ck/library/utility/algorithm.hpp"
+#include "ck/library/utility/bulk_convert.hpp"
 #include "ck/library/utility/ranges.hpp"
 
+#include "ck_tile/host/host_allocator.hpp"
+#include "ck_tile/host/host_thread_pool.hpp"
+
 template <typename Range>
 std::ostream& LogRange(std::ostream& os, Range&& range, std::string delim)
 {
@@ -57,7 +66,7 @@ std::ostream& LogRangeAsType(std::ostream& os, Range&& range, std::string delim)
 }
 
 template <typename F, typename T, std::size_t... Is>
-auto call_f_unpack_args_impl(F f, T args, std::index_sequence<Is...>)
+auto call_f_unpack_args_impl(F f, [[maybe_unused]] T args, std::index_sequence<Is...>)
 {
     return f(std::get<Is>(args)...);
 }
@@ -154,7 +163,12 @@ struct HostTensorDescriptor
         return std::inner_product(iss.begin(), iss.end(), mStrides.begin(), std::size_t{0});
     }
 
-    std::size_t GetOffsetFromMultiIndex(std::vector<std::size_t> iss) const
+    std::size_t GetOffsetFromMultiIndex(const std::vector<std::size_t>& iss) const
+    {
+        return std::inner_product(iss.begin(), iss.end(), mStrides.begin(), std::size_t{0});
+    }
+
+    std::size_t GetOffsetFromMultiIndex(ck::span<const std::size_t> iss) const
     {
         return std::inner_product(iss.begin(), iss.end(), mStrides.begin(), std::size_t{0});
     }
@@ -231,39 +245,110 @@ struct ParallelTensorFunctor
         return indices;
     }
 
+    // runs on the process-wide HostThreadPool with at most num_thread threads
     void operator()(std::size_t num_thread = 1) const
     {
-        std::size_t work_per_thread = (mN1d + num_thread - 1) / num_thread;
+        auto f = [this](std::size_t iw_begin, std::size_t iw_end) {
+            for(std::size_t iw = iw_begin; iw < iw_end; ++iw)
+            {
+                call_f_unpack_args(this->mF, this->GetNdIndices(iw));
+            }
+        };
 
-        std::vector<joinable_thread> threads(num_thread);
-
-        for(std::size_t it = 0; it < num_thread; ++it)
-        {
-            std::size_t iw_begin = it * work_per_thread;
-            std::size_t iw_end   = std::min((it + 1) * work_per_thread, mN1d);
-
-            auto f = [=] {
-                for(std::size_t iw = iw_begin; iw < iw_end; ++iw)
-                {
-                    call_f_unpack_args(mF, GetNdIndices(iw));
-                }
-            };
-            threads[it] = joinable_thread(f);
-        }
+        ck_tile::HostThreadPool::instance().parallel_for(mN1d, f, num_thread);
     }
 };
 
+// Generators whose value does not depend on the index, e.g. random fills, declare
+//     static constexpr bool is_index_independent = true;
+// and may then be called without arguments.
+template <typename G, typename = void>
+struct is_index_independent_generator : std::false_type
+{
+};
+
+template <typename G>
+struct is_index_independent_generator<G, std::enable_if_t<G::is_index_independent>>
+    : std::true_type
+{
+};
+
 template <typename F, typename... Xs>
 auto make_ParallelTensorFunctor(F f, Xs... xs)
 {
     return ParallelTensorFunctor<F, Xs...>(f, xs...);
 }
 
+// Visits the row-major linear indices [begin, end) of a tensor with the given lengths and
+// strides, calling f(idx, offset) with the multi-index in idx and its element offset; idx is a
+// std::vector or std::array with one element per dimension. The start index is decomposed once;
+// after that the index and the offset are advanced incrementally, a carry into the outer
+// dimensions only happening at the end of each innermost row.
+template <typename Index, typename F>
+void for_each_strided_index(const std::vector<std::size_t>& lengths,
+                            const std::vector<std::size_t>& strides,
+                            std::size_t begin,
+                            std::size_t end,
+                            Index& idx,
+                            F&& f)
+{
+    if(begin >= end)
+        return;
+
+    const std::size_t rank = lengths.size();
+    assert(idx.size() == rank);
+
+    std::size_t offset = 0;
+    for(std::size_t d = rank, rest = begin; d-- > 0;)
+    {
+        idx[d] = rest % lengths[d];
+        rest /= lengths[d];
+        offset += idx[d] * strides[d];
+    }
+
+    if(rank == 0)
+    {
+        f(idx, offset);
+        return;
+    }
+
+    const std::size_t inner_length = lengths[rank - 1];
+    const std::size_t inner_stride = strides[rank - 1];
+
+    for(std::size_t i = begin;;)
+    {
+        const std::size_t run = std::min(inner_length - idx[rank - 1], end - i);
+        for(std::size_t r = 0; r < run; ++r)
+        {
+            f(idx, offset);
+            ++idx[rank - 1];
+            offset += inner_stride;
+        }
+
+        i += run;
+        if(i >= end)
+            return;
+
+        offset -= inner_length * inner_stride;
+        idx[rank - 1] = 0;
+
+        for(std::size_t d = rank - 1; d-- > 0;)
+        {
+            offset += strides[d];
+            if(++idx[d] < lengths[d])
+                break;
+
+            offset -= idx[d] * strides[d];
+            idx[d] = 0;
+        }
+    }
+}
+
 template <typename T>
 struct Tensor
 {
     using Descriptor = HostTensorDescriptor;
-    using Data       = std::vector<T>;
+    using Data       = std::vector<T, ck_tile::HostAllocator<T>>;
 
     template <typename X>
     Tensor(std::initializer_list<X> lens) : mDesc(lens), mData(mDesc.GetElementSpaceSize())
@@ -289,13 +374,14 @@ struct Tensor
 
     Tensor(const Descriptor& desc) : mDesc(desc), mData(mDesc.GetElementSpaceSize()) {}
 
+    // copy with every element converted to OutT; see ck::utils::bulk_convert() for the rounding
     template <typename OutT>
-    Tensor<OutT> CopyAsType() const
+    Tensor<OutT> CopyAsType(ck::utils::RoundingMode mode = ck::utils::RoundingMode::Default,
+                            std::uint64_t seed           = 0) const
     {
         Tensor<OutT> ret(mDesc);
 
-        ck::ranges::transform(
-            mData, ret.mData.begin(), [](auto value) { return ck::type_convert<OutT>(value); });
+        ck::utils::bulk_convert(mData.data(), ret.mData.data(), mData.size(), mode, seed);
 
         return ret;
     }
@@ -328,142 +414,132 @@ struct Tensor
 
     void SetZero() { ck::ranges::fill<T>(mData, 0); }
 
+    // f(*this, idx) for every multi-index idx (a std::vector) in row-major order
     template <typename F>
-    void ForEach_impl(F&& f, std::vector<size_t>& idx, size_t rank)
+    void ForEach(F&& f)
     {
-        if(rank == mDesc.GetNumOfDimension())
-        {
-            f(*this, idx);
-            return;
-        }
-        // else
-        for(size_t i = 0; i < mDesc.GetLengths()[rank]; i++)
-        {
-            idx[rank] = i;
-            ForEach_impl(std::forward<F>(f), idx, rank + 1);
-        }
+        std::vector<std::size_t> idx(mDesc.GetNumOfDimension());
+        for_each_strided_index(mDesc.GetLengths(),
+                               mDesc.GetStrides(),
+                               0,
+                               mDesc.GetElementSize(),
+                               idx,
+                               [&](std::vector<std::size_t>& i, std::size_t) { f(*this, i); });
     }
 
     template <typename F>
-    void ForEach(F&& f)
+    void ForEach(F&& f) const
     {
-        std::vector<size_t> idx(mDesc.GetNumOfDimension(), 0);
-        ForEach_impl(std::forward<F>(f), idx, size_t(0));
+        std::vector<std::size_t> idx(mDesc.GetNumOfDimension());
+        for_each_strided_index(mDesc.GetLengths(),
+                               mDesc.GetStrides(),
+                               0,
+                               mDesc.GetElementSize(),
+                               idx,
+                               [&](std::vector<std::size_t>& i, std::size_t) { f(*this, i); });
     }
 
+    // f(idx, offset) for every multi-index, idx being a ck::span<const std::size_t> and offset
+    // the position of the element in mData. With num_thread > 1 the index space is split between
+    // the threads of the HostThreadPool over the outer dimensions; f is then called concurrently
+    // and the order of the calls is unspecified.
     template <typename F>
-    void ForEach_impl(const F&& f, std::vector<size_t>& idx, size_t rank) const
+    void ForEachIndex(F&& f, std::size_t num_thread = 1) const
     {
-        if(rank == mDesc.GetNumOfDimension())
-        {
-            f(*this, idx);
+        const auto& lengths = mDesc.GetLengths();
+        const auto& strides = mDesc.GetStrides();
+
+        // a row is the innermost dimension, so a range of rows is a range of outer indices
+        const std::size_t row = lengths.empty() ? 1 : lengths.back();
+        if(row == 0)
             return;
-        }
-        // else
-        for(size_t i = 0; i < mDesc.GetLengths()[rank]; i++)
-        {
-            idx[rank] = i;
-            ForEach_impl(std::forward<const F>(f), idx, rank + 1);
-        }
+
+        ck_tile::HostThreadPool::instance().parallel_for(
+            mDesc.GetElementSize() / row,
+            [&](std::size_t row_begin, std::size_t row_end) {
+                std::vector<std::size_t> idx(lengths.size());
+                for_each_strided_index(lengths,
+                                       strides,
+                                       row_begin * row,
+                                       row_end * row,
+                                       idx,
+                                       [&](auto& i, std::size_t offset) {
+                                           f(ck::span<const std::size_t>{i.data(), i.size()},
+                                             offset);
+                                       });
+            },
+            num_thread);
+    }
+
+    // highest rank GenerateTensorValue() can call a generator with
+    static constexpr std::size_t kMaxGenerateRank = 12;
+
+    // mData[offset] = g(i0, i1, ...) for every multi-index, NDim being the rank of the tensor
+    template <std::size_t NDim, typename G>
+    void GenerateTensorValueNd(G& g, std::size_t num_thread)
+    {
+        const auto& lengths = mDesc.GetLengths();
+        const auto& strides = mDesc.GetStrides();
+
+        const std::size_t row = NDim == 0 ? 1 : lengths.back();
+        if(row == 0)
+            return;
+
+        auto call_g = [&](auto... is) { return g(is...); };
+
+        ck_tile::HostThreadPool::instance().parallel_for(
+            mDesc.GetElementSize() / row,
+            [&](std::size_t row_begin, std::size_t row_end) {
+                std::array<std::size_t, NDim> idx;
+                for_each_strided_index(lengths,
+                                       strides,
+                                       row_begin * row,
+                                       row_end * row,
+                                       idx,
+                                       [&](const auto& i, std::size_t offset) {
+                                           mData[offset] = call_f_unpack_args(call_g, i);
+                                       });
+            },
+            num_thread);
     }
 
-    template <typename F>
-    void ForEach(const F&& f) const
+    template <typename G, std::size_t... NDims>
+    void GenerateTensorValueNd(G& g, std::size_t num_thread, std::index_sequence<NDims...>)
     {
-        std::vector<size_t> idx(mDesc.GetNumOfDimension(), 0);
-        ForEach_impl(std::forward<const F>(f), idx, size_t(0));
+        const std::size_t rank = mDesc.GetNumOfDimension();
+
+        const bool found =
+            ((rank == NDims && (GenerateTensorValueNd<NDims>(g, num_thread), true)) || ...);
+        if(!found)
+        {
+            throw std::runtime_error("wrong! GenerateTensorValue supports up to " +
+                                     std::to_string(kMaxGenerateRank) + " dimensions, got " +
+                                     std::to_string(rank));
+        }
     }
 
+    // Fills the tensor with g(i0, i1, ...) on up to num_thread threads. Index-independent
+    // generators (see is_index_independent_generator) skip the index computation on tensors
+    // without padding, whose element space holds nothing but tensor elements.
     template <typename G>
     void GenerateTensorValue(G g, std::size_t num_thread = 1)
     {
-        switch(mDesc.GetNumOfDimension())
+        if constexpr(is_index_independent_generator<G>::value)
         {
-        case 1: {
-            auto f = [&](auto i) { (*this)(i) = g(i); };
-            make_ParallelTensorFunctor(f, mDesc.GetLengths()[0])(num_thread);
-            break;
-        }
-        case 2: {
-            auto f = [&](auto i0, auto i1) { (*this)(i0, i1) = g(i0, i1); };
-            make_ParallelTensorFunctor(f, mDesc.GetLengths()[0], mDesc.GetLengths()[1])(num_thread);
-            break;
-        }
-        case 3: {
-            auto f = [&](auto i0, auto i1, auto i2) { (*this)(i0, i1, i2) = g(i0, i1, i2); };
-            make_ParallelTensorFunctor(
-                f, mDesc.GetLengths()[0], mDesc.GetLengths()[1], mDesc.GetLengths()[2])(num_thread);
-            break;
-        }
-        case 4: {
-            auto f = [&](auto i0, auto i1, auto i2, auto i3) {
-                (*this)(i0, i1, i2, i3) = g(i0, i1, i2, i3);
-            };
-            make_ParallelTensorFunctor(f,
-                                       mDesc.GetLengths()[0],
-                                       mDesc.GetLengths()[1],
-                                       mDesc.GetLengths()[2],
-                                       mDesc.GetLengths()[3])(num_thread);
-            break;
-        }
-        case 5: {
-            auto f = [&](auto i0, auto i1, auto i2, auto i3, auto i4) {
-                (*this)(i0, i1, i2, i3, i4) = g(i0, i1, i2, i3, i4);
-            };
-            make_ParallelTensorFunctor(f,
-                                       mDesc.GetLengths()[0],
-                                       mDesc.GetLengths()[1],
-                                       mDesc.GetLengths()[2],
-                                       mDesc.GetLengths()[3],
-                                       mDesc.GetLengths()[4])(num_thread);
-            break;
-        }
-        case 6: {
-            auto f = [&](auto i0, auto i1, auto i2, auto i3, auto i4, auto i5) {
-                (*this)(i0, i1, i2, i3, i4, i5) = g(i0, i1, i2, i3, i4, i5);
-            };
-            make_ParallelTensorFunctor(f,
-                                       mDesc.GetLengths()[0],
-                                       mDesc.GetLengths()[1],
-                                       mDesc.GetLengths()[2],
-                                       mDesc.GetLengths()[3],
-                                       mDesc.GetLengths()[4],
-                                       mDesc.GetLengths()[5])(num_thread);
-            break;
-        }
-        case 12: {
-            auto f = [&](auto i0,
-                         auto i1,
-                         auto i2,
-                         auto i3,
-                         auto i4,
-                         auto i5,
-                         auto i6,
-                         auto i7,
-                         auto i8,
-                         auto i9,
-                         auto i10,
-                         auto i11) {
-                (*this)(i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11) =
-                    g(i0, i1, i2, i3, i4, i5, i6, i7, i8, i9, i10, i11);
-            };
-            make_ParallelTensorFunctor(f,
-                                       mDesc.GetLengths()[0],
-                                       mDesc.GetLengths()[1],
-                                       mDesc.GetLengths()[2],
-                                       mDesc.GetLengths()[3],
-                                       mDesc.GetLengths()[4],
-                                       mDesc.GetLengths()[5],
-                                       mDesc.GetLengths()[6],
-                                       mDesc.GetLengths()[7],
-                                       mDesc.GetLengths()[8],
-                                       mDesc.GetLengths()[9],
-                                       mDesc.GetLengths()[10],
-                                       mDesc.GetLengths()[11])(num_thread);
-            break;
-        }
-        default: throw std::runtime_error("unspported dimension");
+            if(mDesc.GetElementSize() == mDesc.GetElementSpaceSize())
+            {
+                ck_tile::HostThreadPool::instance().parallel_for(
+                    mData.size(),
+                    [&](std::size_t begin, std::size_t end) {
+                        for(std::size_t i = begin; i < end; ++i)
+                            mData[i] = g();
+                    },
+                    num_thread);
+                return;
+            }
         }
+
+        GenerateTensorValueNd(g, num_thread, std::make_index_sequence<kMaxGenerateRank + 1>{});
     }
 
     template <typename... Is>
@@ -484,12 +560,22 @@ struct Tensor
         return mData[mDesc.GetOffsetFromMultiIndex(is...)];
     }
 
-    T& operator()(std::vector<std::size_t> idx)
+    T& operator()(const std::vector<std::size_t>& idx)
+    {
+        return mData[mDesc.GetOffsetFromMultiIndex(idx)];
+    }
+
+    const T& operator()(const std::vector<std::size_t>& idx) const
+    {
+        return mData[mDesc.GetOffsetFromMultiIndex(idx)];
+    }
+
+    T& operator()(ck::span<const std::size_t> idx)
     {
         return mData[mDesc.GetOffsetFromMultiIndex(idx)];
     }
 
-    const T& operator()(std::vector<std::size_t> idx) const
+    const T& operator()(ck::span<const std::size_t> idx) const
     {
         return mData[mDesc.GetOffsetFromMultiIndex(idx)];
     }
@@ -12,6 +12,8 @@
 template <typename T>
 struct GeneratorTensor_0
 {
+    static constexpr bool is_index_independent = true;
+
     template <typename... Is>
     T operator()(Is...)
     {
@@ -22,6 +24,8 @@ struct GeneratorTensor_0
 template <typename T>
 struct GeneratorTensor_1
 {
+    static constexpr bool is_index_independent = true;
+
     T value = 1;
 
     template <typename... Is>
@@ -34,6 +38,8 @@ struct GeneratorTensor_1
 template <>
 struct GeneratorTensor_1<ck::half_t>
 {
+    static constexpr bool is_index_independent = true;
+
     float value = 1.0;
 
     template <typename... Is>
@@ -46,6 +52,8 @@ struct GeneratorTensor_1<ck::half_t>
 template <>
 struct GeneratorTensor_1<ck::bhalf_t>
 {
+    static constexpr bool is_index_independent = true;
+
     float value = 1.0;
 
     template <typename... Is>
@@ -59,6 +67,8 @@ struct GeneratorTensor_1<ck::bhalf_t>
 template <>
 struct GeneratorTensor_1<ck::f8_t>
 {
+    static constexpr bool is_index_independent = true;
+
     float value = 1.0;
 
     template <typename... Is>
@@ -72,6 +82,8 @@ struct GeneratorTensor_1<ck::f8_t>
 template <>
 struct GeneratorTensor_1<int8_t>
 {
+    static constexpr bool is_index_independent = true;
+
     int8_t value = 1;
 
     template <typename... Is>
@@ -84,6 +96,8 @@ struct GeneratorTensor_1<int8_t>
 template <typename T>
 struct GeneratorTensor_2
 {
+    static constexpr bool is_index_independent = true;
+
     int min_value = 0;
     int max_value = 1;
 
@@ -97,6 +111,8 @@ struct GeneratorTensor_2
 template <>
 struct GeneratorTensor_2<ck::bhalf_t>
 {
+    static constexpr bool is_index_independent = true;
+
     int min_value = 0;
     int max_value = 1;
 
@@ -111,6 +127,8 @@ struct GeneratorTensor_2<ck::bhalf_t>
 template <>
 struct GeneratorTensor_2<int8_t>
 {
+    static constexpr bool is_index_independent = true;
+
     int min_value = 0;
     int max_value = 1;
 
@@ -125,6 +143,8 @@ struct GeneratorTensor_2<int8_t>
 template <>
 struct GeneratorTensor_2<ck::f8_t>
 {
+    static constexpr bool is_index_independent = true;
+
     int min_value = 0;
     int max_value = 1;
 
@@ -141,6 +161,8 @@ struct GeneratorTensor_2<ck::f8_t>
 template <>
 struct GeneratorTensor_2<ck::bf8_t>
 {
+    static constexpr bool is_index_independent = true;
+
     int min_value = 0;
     int max_value = 1;
 
@@ -156,6 +178,8 @@ struct GeneratorTensor_2<ck::bf8_t>
 template <typename T>
 struct GeneratorTensor_3
 {
+    static constexpr bool is_index_independent = true;
+
     float min_value = 0;
     float max_value = 1;
 
@@ -171,6 +195,8 @@ struct GeneratorTensor_3
 template <>
 struct GeneratorTensor_3<ck::bhalf_t>
 {
+    static constexpr bool is_index_independent = true;
+
     float min_value = 0;
     float max_value = 1;
 
@@ -189,6 +215,8 @@ struct GeneratorTensor_3<ck::bhalf_t>
 template <>
 struct GeneratorTensor_3<ck::f8_t>
 {
+    static constexpr bool is_index_independent = true;
+
     float min_value = 0;
     float max_value = 1;
 
@@ -208,6 +236,8 @@ struct GeneratorTensor_3<ck::f8_t>
 template <>
 struct GeneratorTensor_3<ck::bf8_t>
 {
+    static constexpr bool is_index_independent = true;
+
     float min_value = 0;
     float max_value = 1;
 
@@ -0,0 +1,375 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "ck/utility/span.hpp"
+
+#include "ck/library/utility/host_tensor.hpp"
+
+template <typename T>
+struct TensorView;
+
+// Random access iterator over the elements of a TensorView in row-major index order, which
+// need not be the order of the element space. It refers to the view, so it must not outlive it.
+template <typename T>
+struct TensorViewIterator
+{
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type        = std::remove_const_t<T>;
+    using difference_type   = std::ptrdiff_t;
+    using pointer           = T*;
+    using reference         = T&;
+
+    TensorViewIterator() = default;
+
+    TensorViewIterator(const TensorView<T>* view, std::size_t i) : view_(view), i_(i) {}
+
+    reference operator*() const { return view_->GetElement(i_); }
+
+    reference operator[](difference_type n) const { return view_->GetElement(i_ + n); }
+
+    TensorViewIterator& operator++()
+    {
+        ++i_;
+        return *this;
+    }
+
+    TensorViewIterator operator++(int) { return TensorViewIterator(view_, i_++); }
+
+    TensorViewIterator& operator--()
+    {
+        --i_;
+        return *this;
+    }
+
+    TensorViewIterator operator--(int) { return TensorViewIterator(view_, i_--); }
+
+    TensorViewIterator& operator+=(difference_type n)
+    {
+        i_ += n;
+        return *this;
+    }
+
+    TensorViewIterator& operator-=(difference_type n)
+    {
+        i_ -= n;
+        return *this;
+    }
+
+    friend TensorViewIterator operator+(TensorViewIterator it, difference_type n)
+    {
+        return it += n;
+    }
+
+    friend TensorViewIterator operator+(difference_type n, TensorViewIterator it)
+    {
+        return it += n;
+    }
+
+    friend TensorViewIterator operator-(TensorViewIterator it, difference_type n)
+    {
+        return it -= n;
+    }
+
+    friend difference_type operator-(const TensorViewIterator& a, const TensorViewIterator& b)
+    {
+        return static_cast<difference_type>(a.i_) - static_cast<difference_type>(b.i_);
+    }
+
+    friend bool operator==(const TensorViewIterator& a, const TensorViewIterator& b)
+    {
+        return a.i_ == b.i_;
+    }
+
+    friend bool operator!=(const TensorViewIterator& a, const TensorViewIterator& b)
+    {
+        return a.i_ != b.i_;
+    }
+
+    friend bool operator<(const TensorViewIterator& a, const TensorViewIterator& b)
+    {
+        return a.i_ < b.i_;
+    }
+
+    friend bool operator>(const TensorViewIterator& a, const TensorViewIterator& b)
+    {
+        return a.i_ > b.i_;
+    }
+
+    friend bool operator<=(const TensorViewIterator& a, const TensorViewIterator& b)
+    {
+        return a.i_ <= b.i_;
+    }
+
+    friend bool operator>=(const TensorViewIterator& a, const TensorViewIterator& b)
+    {
+        return a.i_ >= b.i_;
+    }
+
+    private:
+    const TensorView<T>* view_ = nullptr;
+    std::size_t i_             = 0;
+};
+
+// Non-owning view of tensor elements in an existing buffer, described by lengths and strides.
+//
+// A view has the parts of the Tensor interface the host references use (mDesc, mData over the
+// element space, element access by multi-index), so a batch, head or group of a larger tensor
+// can be passed to a reference or to check_err() without copying it out. Slice(), Select(),
+// Permute(), Reshape() and Broadcast() return new views of the same buffer. Unlike Tensor, a
+// view iterates over its elements in index order, so that views with gaps or repeated elements
+// compare correctly. Views are shallow: a const view of T still gives write access to the
+// elements; use TensorView<const T> for read-only access.
+template <typename T>
+struct TensorView
+{
+    using value_type = std::remove_const_t<T>;
+    using iterator   = TensorViewIterator<T>;
+
+    TensorView(T* data, const HostTensorDescriptor& desc)
+        : mDesc(desc), mData(data, desc.GetElementSpaceSize())
+    {
+        if(mDesc.GetLengths().size() != mDesc.GetStrides().size())
+        {
+            throw std::runtime_error("wrong! tensor view lengths and strides differ in rank");
+        }
+
+        // row-major packed views address element i at offset i
+        std::size_t stride = 1;
+        is_packed_         = true;
+        for(std::size_t d = mDesc.GetNumOfDimension(); d-- > 0;)
+        {
+            if(mDesc.GetLengths()[d] != 1 && mDesc.GetStrides()[d] != stride)
+                is_packed_ = false;
+            stride *= mDesc.GetLengths()[d];
+        }
+    }
+
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+    TensorView(Tensor<U>& tensor) : TensorView(tensor.mData.data(), tensor.mDesc)
+    {
+    }
+
+    template <typename U, typename = std::enable_if_t<std::is_convertible_v<const U*, T*>>>
+    TensorView(const Tensor<U>& tensor) : TensorView(tensor.mData.data(), tensor.mDesc)
+    {
+    }
+
+    template <typename U,
+              typename = std::enable_if_t<!std::is_same_v<U, T> && std::is_convertible_v<U*, T*>>>
+    TensorView(const TensorView<U>& other) : TensorView(other.mData.data(), other.mDesc)
+    {
+    }
+
+    decltype(auto) GetLengths() const { return mDesc.GetLengths(); }
+
+    decltype(auto) GetStrides() const { return mDesc.GetStrides(); }
+
+    std::size_t GetNumOfDimension() const { return mDesc.GetNumOfDimension(); }
+
+    std::size_t GetElementSize() const { return mDesc.GetElementSize(); }
+
+    std::size_t GetElementSpaceSize() const { return mDesc.GetElementSpaceSize(); }
+
+    // the elements [begin, end) of dimension dim
+    TensorView Slice(std::size_t dim, std::size_t begin, std::size_t end) const
+    {
+        CheckDim(dim);
+
+        if(begin > end || end > GetLengths()[dim])
+        {
+            throw std::runtime_error("wrong! slice [" + std::to_string(begin) + ", " +
+                                     std::to_string(end) + ") is out of the range of dimension " +
+                                     std::to_string(dim));
+        }
+
+        auto lengths = GetLengths();
+        lengths[dim] = end - begin;
+
+        return TensorView(mData.data() + (begin < end ? begin * GetStrides()[dim] : 0),
+                          HostTensorDescriptor(lengths, GetStrides()));
+    }
+
+    // the elements with index i in dimension dim, which is removed
+    TensorView Select(std::size_t dim, std::size_t i) const
+    {
+        CheckDim(dim);
+
+        if(i >= GetLengths()[dim])
+        {
+            throw std::runtime_error("wrong! index " + std::to_string(i) +
+                                     " is out of the range of dimension " + std::to_string(dim));
+        }
+
+        auto lengths = GetLengths();
+        auto strides = GetStrides();
+        lengths.erase(lengths.begin() + dim);
+        strides.erase(strides.begin() + dim);
+
+        return TensorView(mData.data() + i * GetStrides()[dim],
+                          HostTensorDescriptor(lengths, strides));
+    }
+
+    // dimension i of the result is dimension new2old[i] of this view
+    template <typename New2Old>
+    TensorView Permute(const New2Old& new2old) const
+    {
+        std::vector<bool> seen(GetNumOfDimension(), false);
+        for(const auto d : new2old)
+        {
+            if(static_cast<std::size_t>(d) >= seen.size() || seen[d])
+                throw std::runtime_error("wrong! permutation does not match the view rank");
+            seen[d] = true;
+        }
+
+        if(std::size(new2old) != seen.size())
+            throw std::runtime_error("wrong! permutation does not match the view rank");
+
+        return TensorView(mData.data(),
+                          transpose_host_tensor_descriptor_given_new2old(mDesc, new2old));
+    }
+
+    // the same elements in row-major order with new lengths; only packed views can be reshaped
+    template <typename Lengths>
+    TensorView Reshape(const Lengths& lengths) const
+    {
+        const HostTensorDescriptor desc(lengths);
+
+        if(!is_packed_ || desc.GetElementSize() != GetElementSize())
+        {
+            throw std::runtime_error("wrong! only a packed view can be reshaped, to the same "
+                                     "number of elements");
+        }
+
+        return TensorView(mData.data(), desc);
+    }
+
+    // Broadcast to lengths, aligning the trailing dimensions as numpy does: new leading
+    // dimensions and dimensions of length 1 are repeated with stride 0.
+    template <typename Lengths>
+    TensorView Broadcast(const Lengths& lengths) const
+    {
+        const std::vector<std::size_t> new_lengths(std::begin(lengths), std::end(lengths));
+        const std::size_t rank = GetNumOfDimension();
+
+        if(new_lengths.size() < rank)
+            throw std::runtime_error("wrong! cannot broadcast a view to a lower rank");
+
+        const std::size_t lead = new_lengths.size() - rank;
+
+        std::vector<std::size_t> new_strides(new_lengths.size(), 0);
+        for(std::size_t d = 0; d < rank; ++d)
+        {
+            if(GetLengths()[d] == new_lengths[lead + d])
+                new_strides[lead + d] = GetStrides()[d];
+            else if(GetLengths()[d] != 1)
+                throw std::runtime_error("wrong! cannot broadcast dimension " + std::to_string(d) +
+                                         " of length " + std::to_string(GetLengths()[d]) +
+                                         " to " + std::to_string(new_lengths[lead + d]));
+        }
+
+        return TensorView(mData.data(), HostTensorDescriptor(new_lengths, new_strides));
+    }
+
+    template <typename... Is>
+    std::size_t GetOffsetFromMultiIndex(Is... is) const
+    {
+        return mDesc.GetOffsetFromMultiIndex(is...);
+    }
+
+    template <typename... Is>
+    T& operator()(Is... is) const
+    {
+        return mData[mDesc.GetOffsetFromMultiIndex(is...)];
+    }
+
+    T& operator()(const std::vector<std::size_t>& idx) const
+    {
+        return mData[mDesc.GetOffsetFromMultiIndex(idx)];
+    }
+
+    T& operator()(ck::span<const std::size_t> idx) const
+    {
+        return mData[mDesc.GetOffsetFromMultiIndex(idx)];
+    }
+
+    // element offset of the i-th element in row-major index order
+    std::size_t GetOffsetFromLinearIndex(std::size_t i) const
+    {
+        if(is_packed_)
+            return i;
+
+        const auto& lengths = GetLengths();
+        const auto& strides = GetStrides();
+
+        std::size_t offset = 0;
+        for(std::size_t d = lengths.size(); d-- > 0;)
+        {
+            offset += (i % lengths[d]) * strides[d];
+            i /= lengths[d];
+        }
+        return offset;
+    }
+
+    // multi-index of the i-th element in row-major index order
+    std::vector<std::size_t> GetMultiIndex(std::size_t i) const
+    {
+        const auto& lengths = GetLengths();
+
+        std::vector<std::size_t> idx(lengths.size());
+        for(std::size_t d = lengths.size(); d-- > 0;)
+        {
+            idx[d] = i % lengths[d];
+            i /= lengths[d];
+        }
+        return idx;
+    }
+
+    T& GetElement(std::size_t i) const { return mData[GetOffsetFromLinearIndex(i)]; }
+
+    iterator begin() const { return iterator(this, 0); }
+
+    iterator end() const { return iterator(this, size()); }
+
+    T* data() const { return mData.data(); }
+
+    // number of elements, not the element space size
+    std::size_t size() const { return GetElementSize(); }
+
+    private:
+    void CheckDim(std::size_t dim) const
+    {
+        if(dim >= GetNumOfDimension())
+        {
+            throw std::runtime_error("wrong! dimension " + std::to_string(dim) +
+                                     " is out of the view rank " +
+                                     std::to_string(GetNumOfDimension()));
+        }
+    }
+
+    bool is_packed_ = true;
+
+    public:
+    HostTensorDescriptor mDesc;
+    ck::span<T> mData; // the element space
+};
+
+template <typename T>
+TensorView<T> make_tensor_view(Tensor<T>& tensor)
+{
+    return TensorView<T>(tensor);
+}
+
+template <typename T>
+TensorView<const T> make_tensor_view(const Tensor<T>& tensor)
+{
+    return TensorView<const T>(tensor);
+}
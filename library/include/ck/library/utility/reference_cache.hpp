@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+// directory of the reference output cache used by ReferenceCache::FromEnvironment():
+// export CK_REFERENCE_CACHE=/path/to/cache/dir
+CK_DECLARE_ENV_VAR_STR(CK_REFERENCE_CACHE)
+
+namespace ck {
+namespace utils {
+
+// 128-bit content address of a reference computation.
+//
+// Everything the reference output depends on is added in order: the operation, the data types,
+// the problem and the input tensors themselves. Hashing the input data instead of trusting the
+// init method and seed keeps the key valid when an initializer changes. Large byte ranges are
+// hashed in fixed chunks on the host thread pool, so the digest does not depend on the number of
+// threads. Not a cryptographic hash.
+//
+// A key starts with the name and cache version of the reference implementation. A change to a
+// reference that alters its output, e.g. its summation order, must bump its CacheVersion, so
+// results cached by the old implementation are no longer found.
+class ReferenceCacheKey
+{
+    public:
+    ReferenceCacheKey(std::string_view reference, int version) { Add(reference).Add(version); }
+
+    ReferenceCacheKey& Add(const void* p, std::size_t bytes);
+
+    ReferenceCacheKey& Add(std::string_view s) { return Add(s.data(), s.size()); }
+
+    template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    ReferenceCacheKey& Add(T x)
+    {
+        return Add(&x, sizeof(x));
+    }
+
+    // a template, so that strings never convert to a descriptor
+    template <typename Desc,
+              typename = std::enable_if_t<std::is_same_v<Desc, HostTensorDescriptor>>>
+    ReferenceCacheKey& Add(const Desc& desc)
+    {
+        Add(desc.GetNumOfDimension());
+        for(const auto length : desc.GetLengths())
+            Add(length);
+        for(const auto stride : desc.GetStrides())
+            Add(stride);
+
+        return *this;
+    }
+
+    // descriptor and element bytes of a host tensor
+    template <typename T>
+    ReferenceCacheKey& Add(const Tensor<T>& tensor)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+
+        Add(sizeof(T));
+        Add(tensor.mDesc);
+
+        return Add(tensor.mData.data(), tensor.mData.size() * sizeof(T));
+    }
+
+    // 32 hex digits
+    std::string GetDigest() const;
+
+    private:
+    std::uint64_t h0_ = 0x243F6A8885A308D3; // digits of pi
+    std::uint64_t h1_ = 0x13198A2E03707344;
+    std::uint64_t num_byte_ = 0;
+};
+
+// Directory of cached CPU reference outputs, one file per content address.
+//
+// Store() writes a temporary file and renames it into place, so concurrent profiler runs never
+// see a partial file and the last writer of identical contents wins. Load() maps the file and
+// copies it into the destination on the host thread pool.
+class ReferenceCache
+{
+    public:
+    explicit ReferenceCache(std::string dir) : dir_(std::move(dir)) {}
+
+    // the cache in $CK_REFERENCE_CACHE, if set
+    static std::optional<ReferenceCache> FromEnvironment();
+
+    const std::string& GetDirectory() const { return dir_; }
+
+    // true if a cached result of exactly bytes bytes was copied to dst
+    bool Load(const std::string& digest, void* dst, std::size_t bytes) const;
+
+    // false if the result cannot be written; the cache is best effort
+    bool Store(const std::string& digest, const void* src, std::size_t bytes) const;
+
+    template <typename T>
+    bool Load(const std::string& digest, Tensor<T>& tensor) const
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return Load(digest, tensor.mData.data(), tensor.mData.size() * sizeof(T));
+    }
+
+    template <typename T>
+    bool Store(const std::string& digest, const Tensor<T>& tensor) const
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        return Store(digest, tensor.mData.data(), tensor.mData.size() * sizeof(T));
+    }
+
+    private:
+    std::string GetPath(const std::string& digest) const;
+
+    std::string dir_;
+};
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,234 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+#include "ck/library/utility/content_hash.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace utils {
+
+// element type stored in a tensor file; the values are part of the file format
+enum class TensorFileDataType : std::uint32_t
+{
+    fp32  = 1,
+    fp64  = 2,
+    fp16  = 3,
+    bf16  = 4,
+    fp8   = 5,
+    bf8   = 6,
+    int8  = 7,
+    int32 = 8,
+    int4  = 9, // one element per byte, as held by Tensor<int4_t>
+    uint8 = 10,
+};
+
+template <typename T>
+constexpr TensorFileDataType get_tensor_file_data_type()
+{
+    if constexpr(std::is_same_v<T, float>)
+        return TensorFileDataType::fp32;
+    else if constexpr(std::is_same_v<T, double>)
+        return TensorFileDataType::fp64;
+    else if constexpr(std::is_same_v<T, half_t>)
+        return TensorFileDataType::fp16;
+    else if constexpr(std::is_same_v<T, bhalf_t>)
+        return TensorFileDataType::bf16;
+    else if constexpr(std::is_same_v<T, f8_t>)
+        return TensorFileDataType::fp8;
+    else if constexpr(std::is_same_v<T, bf8_t>)
+        return TensorFileDataType::bf8;
+    else if constexpr(std::is_same_v<T, int8_t>)
+        return TensorFileDataType::int8;
+    else if constexpr(std::is_same_v<T, int32_t>)
+        return TensorFileDataType::int32;
+#ifdef CK_EXPERIMENTAL_BIT_INT_EXTENSION_INT4
+    else if constexpr(std::is_same_v<T, int4_t>)
+        return TensorFileDataType::int4;
+#endif
+    else if constexpr(std::is_same_v<T, uint8_t>)
+        return TensorFileDataType::uint8;
+    else
+        static_assert(sizeof(T) == 0, "wrong! data type has no tensor file encoding");
+}
+
+// Fixed part of the tensor file header, followed by the u64 lengths and u64 strides of every
+// dimension. The element data starts at data_offset_, a multiple of the page size, and holds
+// the element space of the descriptor exactly like Tensor::mData, so a file can be mapped and
+// used in place. All fields are little endian.
+struct TensorFileHeader
+{
+    char magic_[8];              // "CKTENSOR"
+    std::uint32_t version_;      // 1
+    TensorFileDataType data_type_;
+    std::uint32_t num_dim_;
+    std::uint32_t element_size_; // bytes per element
+    std::uint64_t data_offset_;  // bytes from the start of the file
+    std::uint64_t data_size_;    // bytes of element data
+    std::uint64_t checksum_;     // of the element data, see TensorFileWriter
+    std::uint64_t reserved_;
+};
+
+static_assert(sizeof(TensorFileHeader) == 56);
+
+// Streaming writer of a tensor file.
+//
+// The header and descriptor are written up front; the element data is appended with Write() in
+// pieces of any size, so a tensor can be saved while it is produced, e.g. chunk by chunk from
+// the device. The checksum is accumulated over fixed 1 MiB blocks as the data streams by and is
+// written into the header by Close(), which throws if fewer or more bytes were written than the
+// descriptor requires.
+class TensorFileWriter
+{
+    public:
+    TensorFileWriter(const std::string& path,
+                     TensorFileDataType data_type,
+                     std::size_t element_size,
+                     const HostTensorDescriptor& desc);
+
+    TensorFileWriter(const TensorFileWriter&) = delete;
+    TensorFileWriter& operator=(const TensorFileWriter&) = delete;
+
+    // closes the file if Close() was not called, without reporting errors
+    ~TensorFileWriter();
+
+    void Write(const void* p, std::size_t bytes);
+
+    void Close();
+
+    private:
+    void HashBlock(const unsigned char* p, std::size_t bytes);
+
+    std::string path_;
+    std::ofstream file_;
+    TensorFileHeader header_;
+    std::uint64_t num_written_ = 0;
+    ContentHash hash_;
+    std::vector<unsigned char> block_; // partial checksum block
+    bool closed_ = false;
+};
+
+// A tensor file mapped read-only into memory.
+class TensorFileMapping
+{
+    public:
+    // verify recomputes the checksum of the element data on the host thread pool
+    explicit TensorFileMapping(const std::string& path, bool verify = true);
+
+    const TensorFileHeader& GetHeader() const { return header_; }
+
+    const HostTensorDescriptor& GetDescriptor() const { return desc_; }
+
+    const void* GetData() const
+    {
+        return static_cast<const char*>(mapping_.get()) + header_.data_offset_;
+    }
+
+    private:
+    TensorFileHeader header_;
+    HostTensorDescriptor desc_;
+    std::shared_ptr<const void> mapping_; // unmapped with the last owner
+};
+
+// Read-only zero-copy view of a tensor file with the element type T.
+//
+// Provides the parts of the Tensor interface used by the host references and check_err():
+// mDesc, element access by multi-index and iteration over the element space. The mapping stays
+// alive as long as any copy of the view.
+template <typename T>
+class MappedTensor
+{
+    public:
+    explicit MappedTensor(const std::string& path, bool verify = true)
+        : mapping_(std::make_shared<TensorFileMapping>(path, verify)),
+          mDesc(mapping_->GetDescriptor())
+    {
+        const auto& header = mapping_->GetHeader();
+
+        if(header.data_type_ != get_tensor_file_data_type<T>() || header.element_size_ != sizeof(T))
+        {
+            throw std::runtime_error("wrong! tensor file " + path +
+                                     " does not hold the requested data type");
+        }
+    }
+
+    decltype(auto) GetLengths() const { return mDesc.GetLengths(); }
+
+    decltype(auto) GetStrides() const { return mDesc.GetStrides(); }
+
+    std::size_t GetNumOfDimension() const { return mDesc.GetNumOfDimension(); }
+
+    std::size_t GetElementSize() const { return mDesc.GetElementSize(); }
+
+    std::size_t GetElementSpaceSize() const { return mDesc.GetElementSpaceSize(); }
+
+    const T* data() const { return static_cast<const T*>(mapping_->GetData()); }
+
+    std::size_t size() const { return GetElementSpaceSize(); }
+
+    const T* begin() const { return data(); }
+
+    const T* end() const { return data() + size(); }
+
+    template <typename... Is>
+    const T& operator()(Is... is) const
+    {
+        return data()[mDesc.GetOffsetFromMultiIndex(is...)];
+    }
+
+    const T& operator()(std::vector<std::size_t> idx) const
+    {
+        return data()[mDesc.GetOffsetFromMultiIndex(idx)];
+    }
+
+    private:
+    std::shared_ptr<const TensorFileMapping> mapping_;
+
+    public:
+    HostTensorDescriptor mDesc;
+};
+
+template <typename T>
+void save_tensor(const std::string& path, const Tensor<T>& tensor)
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+
+    TensorFileWriter writer(path, get_tensor_file_data_type<T>(), sizeof(T), tensor.mDesc);
+    writer.Write(tensor.mData.data(), tensor.mData.size() * sizeof(T));
+    writer.Close();
+}
+
+// zero-copy view of a tensor file
+template <typename T>
+MappedTensor<T> map_tensor(const std::string& path, bool verify = true)
+{
+    return MappedTensor<T>(path, verify);
+}
+
+// copy of a tensor file in a host tensor
+template <typename T>
+Tensor<T> load_tensor(const std::string& path, bool verify = true)
+{
+    const MappedTensor<T> mapped(path, verify);
+
+    Tensor<T> tensor(mapped.mDesc);
+    std::copy(mapped.begin(), mapped.end(), tensor.mData.begin());
+
+    return tensor;
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,134 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/utility/data_type.hpp"
+
+// path of the tuning database written by ckProfiler and read by TuningDb::FromEnvironment():
+// export CK_TUNING_DB=/path/to/ck_tuning.db
+CK_DECLARE_ENV_VAR_STR(CK_TUNING_DB)
+
+namespace ck {
+namespace utils {
+
+// problem a tuning result is valid for
+struct TuningKey
+{
+    std::string op_;         // e.g. "gemm"
+    std::string layouts_;    // e.g. "RowMajor,ColumnMajor,RowMajor"
+    std::string data_types_; // e.g. "fp16,fp16,fp16"
+    std::string problem_;    // e.g. "M=3840 N=4096 K=4096 StrideA=4096 StrideB=4096 StrideC=4096"
+    std::string arch_;       // e.g. "gfx942"
+
+    bool operator==(const TuningKey& other) const
+    {
+        return op_ == other.op_ && layouts_ == other.layouts_ &&
+               data_types_ == other.data_types_ && problem_ == other.problem_ &&
+               arch_ == other.arch_;
+    }
+};
+
+// one profiled instance of a problem
+struct TuningRecord
+{
+    TuningKey key_;
+    std::string instance_id_; // GetInstanceId() of the device op, empty if it has none
+    std::string instance_;    // GetTypeString() of the device op, for display only
+    int split_k_    = 0; // KBatch / SplitK the time was measured with, 0 if not applicable
+    float ave_time_ = 0; // ms
+    float tflops_   = 0;
+};
+
+// On-disk database of the fastest instance per problem.
+//
+// The file is an append-only log of tab separated records, one per line. Every Add() appends a
+// complete line with a single write under an exclusive file lock, so parallel profiling jobs can
+// share one file; Load() reads under a shared lock and skips lines it cannot parse, e.g. the
+// tail of a writer that was killed. When a problem was profiled more than once, the fastest
+// record wins.
+//
+// The first Lookup() loads the file into an in-memory index of the fastest record per problem,
+// which later lookups and the Add() calls of this object keep up to date. Records other
+// processes add afterwards are only seen after Reload(). Copies share the index.
+class TuningDb
+{
+    public:
+    explicit TuningDb(std::string path);
+
+    // the database at $CK_TUNING_DB, if set
+    static std::optional<TuningDb> FromEnvironment();
+
+    const std::string& GetPath() const { return path_; }
+
+    // append a record; false if the file cannot be written
+    bool Add(const TuningRecord& record) const;
+
+    // all valid records in the order they were added
+    std::vector<TuningRecord> Load() const;
+
+    // the fastest record of the problem, if it was profiled before
+    std::optional<TuningRecord> Lookup(const TuningKey& key) const;
+
+    // read the file again on the next Lookup()
+    void Reload() const;
+
+    private:
+    struct Index;
+
+    std::string path_;
+    std::shared_ptr<Index> index_;
+};
+
+template <typename T>
+constexpr const char* get_tuning_data_type_name()
+{
+    if constexpr(std::is_same_v<T, double>)
+        return "fp64";
+    else if constexpr(std::is_same_v<T, float>)
+        return "fp32";
+    else if constexpr(std::is_same_v<T, half_t>)
+        return "fp16";
+    else if constexpr(std::is_same_v<T, bhalf_t>)
+        return "bf16";
+    else if constexpr(std::is_same_v<T, f8_t>)
+        return "fp8";
+    else if constexpr(std::is_same_v<T, bf8_t>)
+        return "bf8";
+    else if constexpr(std::is_same_v<T, int8_t>)
+        return "int8";
+    else if constexpr(std::is_same_v<T, int32_t>)
+        return "int32";
+    else
+        return "unknown";
+}
+
+// comma separated data type names of Ts..., e.g. "fp16,fp16,fp32"
+template <typename... Ts>
+std::string get_tuning_data_type_names()
+{
+    std::string names;
+    ((names += (names.empty() ? "" : ",") + std::string(get_tuning_data_type_name<Ts>())), ...);
+    return names;
+}
+
+// comma separated names of the tensor_layout types Layouts..., e.g. "RowMajor,ColumnMajor"
+template <typename... Layouts>
+std::string get_tuning_layout_names()
+{
+    std::string names;
+    ((names += (names.empty() ? "" : ",") + std::string(Layouts::name)), ...);
+    return names;
+}
+
+} // namespace utils
+} // namespace ck
@@ -18,6 +18,19 @@ void add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_mnpadding_instan
         device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_instances<GemmMNPadding>{});
 }
 
+void add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_mnpadding_entries(
+    std::vector<DeviceOperationInstanceEntry<
+        DeviceGemmV2<Col, Row, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>>>&
+        entries)
+{
+    add_device_operation_instance_entries(
+        entries,
+        device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_instances<GemmMNPadding>{});
+}
+
+CK_EXPORT_INSTANCE_ENTRIES(
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_km_kn_mn_comp_mnpadding_entries);
+
 } // namespace instance
 } // namespace device
 } // namespace tensor_operation
@@ -17,6 +17,18 @@ void add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_comp_default_instance
         instances, device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_comp_instances<GemmDefault>{});
 }
 
+void add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_comp_default_entries(
+    std::vector<DeviceOperationInstanceEntry<
+        DeviceGemmV2<Row, Col, Row, BF16, BF16, BF16, PassThrough, PassThrough, PassThrough>>>&
+        entries)
+{
+    add_device_operation_instance_entries(
+        entries, device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_comp_instances<GemmDefault>{});
+}
+
+CK_EXPORT_INSTANCE_ENTRIES(
+    add_device_gemm_xdl_universal_bf16_bf16_bf16_mk_nk_mn_comp_default_entries);
+
 } // namespace instance
 } // namespace device
 } // namespace tensor_operation
@@ -17,6 +17,17 @@ void add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_comp_default_instances(
         instances, device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_comp_instances<GemmDefault>{});
 }
 
+void add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_comp_default_entries(
+    std::vector<DeviceOperationInstanceEntry<
+        DeviceGemmV2<Row, Row, Row, F16, F16, F16, PassThrough, PassThrough, PassThrough>>>&
+        entries)
+{
+    add_device_operation_instance_entries(
+        entries, device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_comp_instances<GemmDefault>{});
+}
+
+CK_EXPORT_INSTANCE_ENTRIES(add_device_gemm_xdl_universal_f16_f16_f16_mk_kn_mn_comp_default_entries);
+
 } // namespace instance
 } // namespace device
 } // namespace tensor_operation
@@ -59,6 +59,17 @@ void DeviceMem::FromDevice(void* p, const std::size_t cpySize) const
     hip_check_error(hipMemcpy(p, mpDeviceBuf, cpySize, hipMemcpyDeviceToHost));
 }
 
+void DeviceMem::FromDevice(void* p, const std::size_t cpySize, const std::size_t offset) const
+{
+    if(offset > mMemSize || cpySize > mMemSize - offset)
+    {
+        throw std::runtime_error("wrong! FromDevice reads past the end of the buffer");
+    }
+
+    hip_check_error(hipMemcpy(
+        p, static_cast<const char*>(mpDeviceBuf) + offset, cpySize, hipMemcpyDeviceToHost));
+}
+
 void DeviceMem::SetZero() const
 {
     if(mpDeviceBuf)
@@ -0,0 +1,218 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ck/filesystem.hpp"
+#include "ck_tile/host/host_thread_pool.hpp"
+
+#include "ck/library/utility/content_hash.hpp"
+#include "ck/library/utility/reference_cache.hpp"
+
+namespace ck {
+namespace utils {
+
+namespace {
+
+constexpr std::size_t kChunkBytes = std::size_t{1} << 20;
+
+// file header: magic followed by the number of payload bytes
+constexpr char kMagic[8] = {'C', 'K', 'R', 'E', 'F', '0', '0', '1'};
+constexpr std::size_t kHeaderBytes = sizeof(kMagic) + sizeof(std::uint64_t);
+
+#ifndef _WIN32
+void parallel_copy(void* dst, const void* src, std::size_t bytes)
+{
+    auto* d       = static_cast<char*>(dst);
+    const auto* s = static_cast<const char*>(src);
+
+    ck_tile::HostThreadPool::instance().parallel_for(
+        (bytes + kChunkBytes - 1) / kChunkBytes, [&](std::size_t begin, std::size_t end) {
+            const std::size_t offset = begin * kChunkBytes;
+            std::memcpy(d + offset, s + offset, std::min(end * kChunkBytes, bytes) - offset);
+        });
+}
+#endif
+
+} // namespace
+
+ReferenceCacheKey& ReferenceCacheKey::Add(const void* p, std::size_t bytes)
+{
+    const auto* data = static_cast<const unsigned char*>(p);
+
+    const std::size_t num_chunk = (bytes + kChunkBytes - 1) / kChunkBytes;
+
+    std::vector<ContentHash> chunk_hash(num_chunk);
+
+    ck_tile::HostThreadPool::instance().parallel_for(
+        num_chunk, [&](std::size_t begin, std::size_t end) {
+            for(std::size_t c = begin; c < end; ++c)
+            {
+                const std::size_t offset = c * kChunkBytes;
+                chunk_hash[c] =
+                    content_hash_block(data + offset, std::min(kChunkBytes, bytes - offset));
+            }
+        });
+
+    // the length goes in first, so that "ab" + "c" and "a" + "bc" differ
+    ContentHash h{h0_, h1_};
+    content_hash_combine(h, {content_hash_fmix(bytes), content_hash_fmix(~bytes)});
+
+    for(const auto& c : chunk_hash)
+        content_hash_combine(h, c);
+
+    h0_ = h.h0;
+    h1_ = h.h1;
+
+    num_byte_ += bytes;
+
+    return *this;
+}
+
+std::string ReferenceCacheKey::GetDigest() const
+{
+    const std::uint64_t d0 = content_hash_fmix(h0_ ^ num_byte_);
+    const std::uint64_t d1 = content_hash_fmix(h1_ + d0);
+
+    constexpr char kHex[] = "0123456789abcdef";
+
+    std::string digest;
+    for(const std::uint64_t d : {d0, d1})
+    {
+        for(int shift = 60; shift >= 0; shift -= 4)
+            digest += kHex[(d >> shift) & 0xF];
+    }
+
+    return digest;
+}
+
+std::optional<ReferenceCache> ReferenceCache::FromEnvironment()
+{
+    const std::string& dir = ck::EnvGetString(CK_ENV(CK_REFERENCE_CACHE));
+
+    if(dir.empty())
+        return std::nullopt;
+
+    return ReferenceCache(dir);
+}
+
+std::string ReferenceCache::GetPath(const std::string& digest) const
+{
+    return (CK::fs::path(dir_) / (digest + ".bin")).string();
+}
+
+bool ReferenceCache::Load(const std::string& digest, void* dst, std::size_t bytes) const
+{
+    const std::string path = GetPath(digest);
+
+#ifndef _WIN32
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if(fd < 0)
+        return false;
+
+    struct stat st;
+    if(fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) != kHeaderBytes + bytes)
+    {
+        close(fd);
+        return false;
+    }
+
+    void* p = mmap(nullptr, kHeaderBytes + bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if(p == MAP_FAILED)
+        return false;
+
+    const auto* base = static_cast<const char*>(p);
+
+    std::uint64_t stored_bytes;
+    std::memcpy(&stored_bytes, base + sizeof(kMagic), sizeof(stored_bytes));
+
+    const bool valid = std::memcmp(base, kMagic, sizeof(kMagic)) == 0 &&
+                       stored_bytes == static_cast<std::uint64_t>(bytes);
+
+    if(valid)
+    {
+        madvise(p, kHeaderBytes + bytes, MADV_SEQUENTIAL);
+        parallel_copy(dst, base + kHeaderBytes, bytes);
+    }
+
+    munmap(p, kHeaderBytes + bytes);
+
+    return valid;
+#else
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+
+    char magic[sizeof(kMagic)];
+    std::uint64_t stored_bytes = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&stored_bytes), sizeof(stored_bytes));
+
+    if(!file || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+       stored_bytes != static_cast<std::uint64_t>(bytes))
+        return false;
+
+    file.read(static_cast<char*>(dst), static_cast<std::streamsize>(bytes));
+    return file.gcount() == static_cast<std::streamsize>(bytes);
+#endif
+}
+
+bool ReferenceCache::Store(const std::string& digest, const void* src, std::size_t bytes) const
+{
+    static std::atomic<std::uint64_t> counter{0};
+
+    std::error_code ec;
+    CK::fs::create_directories(dir_, ec);
+
+    const std::string path = GetPath(digest);
+    // unique per thread and process, so that concurrent writers of one digest do not collide
+    std::string tmp_path = path + ".tmp." + std::to_string(counter++) + "." +
+                           std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+#ifndef _WIN32
+    tmp_path += "." + std::to_string(getpid());
+#endif
+
+    {
+        std::ofstream file(tmp_path, std::ios::out | std::ios::binary | std::ios::trunc);
+
+        const std::uint64_t stored_bytes = bytes;
+        file.write(kMagic, sizeof(kMagic));
+        file.write(reinterpret_cast<const char*>(&stored_bytes), sizeof(stored_bytes));
+        file.write(static_cast<const char*>(src), static_cast<std::streamsize>(bytes));
+        file.flush();
+
+        if(!file)
+        {
+            file.close();
+            CK::fs::remove(tmp_path, ec);
+            return false;
+        }
+    }
+
+    // readers only ever see complete files
+    CK::fs::rename(tmp_path, path, ec);
+    if(ec)
+    {
+        CK::fs::remove(tmp_path, ec);
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace utils
+} // namespace ck
@@ -0,0 +1,278 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "ck_tile/host/host_thread_pool.hpp"
+
+#include "ck/library/utility/tensor_file.hpp"
+
+namespace ck {
+namespace utils {
+
+namespace {
+
+constexpr char kMagic[8]             = {'C', 'K', 'T', 'E', 'N', 'S', 'O', 'R'};
+constexpr std::uint32_t kVersion     = 1;
+constexpr std::uint64_t kDataAlign   = 4096;
+constexpr std::size_t kChecksumBlock = std::size_t{1} << 20;
+
+constexpr ContentHash kChecksumSeed = {0x452821E638D01377, 0xBE5466CF34E90C6C}; // digits of pi
+
+std::uint64_t get_descriptor_bytes(std::uint64_t num_dim)
+{
+    return 2 * num_dim * sizeof(std::uint64_t);
+}
+
+std::uint64_t get_data_offset(std::uint64_t num_dim)
+{
+    const std::uint64_t end = sizeof(TensorFileHeader) + get_descriptor_bytes(num_dim);
+    return (end + kDataAlign - 1) / kDataAlign * kDataAlign;
+}
+
+// fold the hashes of the whole checksum blocks in [p, p + bytes) into h, in parallel
+void hash_blocks(ContentHash& h, const unsigned char* p, std::size_t bytes)
+{
+    std::vector<ContentHash> block_hash(bytes / kChecksumBlock);
+
+    ck_tile::HostThreadPool::instance().parallel_for(
+        block_hash.size(), [&](std::size_t begin, std::size_t end) {
+            for(std::size_t b = begin; b < end; ++b)
+                block_hash[b] = content_hash_block(p + b * kChecksumBlock, kChecksumBlock);
+        });
+
+    for(const auto& b : block_hash)
+        content_hash_combine(h, b);
+}
+
+std::uint64_t finalize_checksum(const ContentHash& h, std::uint64_t data_size)
+{
+    return content_hash_fmix(h.h0 ^ content_hash_fmix(h.h1 ^ data_size));
+}
+
+std::uint64_t compute_checksum(const void* p, std::size_t bytes)
+{
+    const auto* data = static_cast<const unsigned char*>(p);
+
+    ContentHash h = kChecksumSeed;
+
+    const std::size_t num_full = bytes / kChecksumBlock * kChecksumBlock;
+    hash_blocks(h, data, num_full);
+
+    if(num_full < bytes)
+        content_hash_combine(h, content_hash_block(data + num_full, bytes - num_full));
+
+    return finalize_checksum(h, bytes);
+}
+
+} // namespace
+
+TensorFileWriter::TensorFileWriter(const std::string& path,
+                                   TensorFileDataType data_type,
+                                   std::size_t element_size,
+                                   const HostTensorDescriptor& desc)
+    : path_(path), file_(path, std::ios::out | std::ios::binary | std::ios::trunc)
+{
+    if(!file_)
+    {
+        throw std::runtime_error("wrong! cannot create tensor file " + path);
+    }
+
+    const std::size_t num_dim = desc.GetNumOfDimension();
+
+    std::memset(&header_, 0, sizeof(header_));
+    std::memcpy(header_.magic_, kMagic, sizeof(kMagic));
+    header_.version_      = kVersion;
+    header_.data_type_    = data_type;
+    header_.num_dim_      = static_cast<std::uint32_t>(num_dim);
+    header_.element_size_ = static_cast<std::uint32_t>(element_size);
+    header_.data_offset_  = get_data_offset(num_dim);
+    header_.data_size_    = element_size * desc.GetElementSpaceSize();
+
+    std::vector<std::uint64_t> dims;
+    dims.insert(dims.end(), desc.GetLengths().begin(), desc.GetLengths().end());
+    dims.insert(dims.end(), desc.GetStrides().begin(), desc.GetStrides().end());
+
+    file_.write(reinterpret_cast<const char*>(&header_), sizeof(header_));
+    file_.write(reinterpret_cast<const char*>(dims.data()),
+                static_cast<std::streamsize>(dims.size() * sizeof(std::uint64_t)));
+
+    const std::vector<char> padding(
+        header_.data_offset_ - sizeof(header_) - get_descriptor_bytes(num_dim), 0);
+    file_.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+
+    hash_ = kChecksumSeed;
+    block_.reserve(kChecksumBlock);
+}
+
+TensorFileWriter::~TensorFileWriter()
+{
+    if(!closed_)
+        file_.close();
+}
+
+void TensorFileWriter::HashBlock(const unsigned char* p, std::size_t bytes)
+{
+    hash_blocks(hash_, p, bytes);
+}
+
+void TensorFileWriter::Write(const void* p, std::size_t bytes)
+{
+    if(closed_ || num_written_ + bytes > header_.data_size_)
+    {
+        throw std::runtime_error("wrong! more data written than tensor file " + path_ + " holds");
+    }
+
+    const auto* data = static_cast<const unsigned char*>(p);
+
+    file_.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(bytes));
+    num_written_ += bytes;
+
+    // complete a pending block first, then hash whole blocks in place and keep the remainder
+    if(!block_.empty())
+    {
+        const std::size_t n = std::min(bytes, kChecksumBlock - block_.size());
+        block_.insert(block_.end(), data, data + n);
+        data += n;
+        bytes -= n;
+
+        if(block_.size() < kChecksumBlock)
+            return;
+
+        HashBlock(block_.data(), block_.size());
+        block_.clear();
+    }
+
+    const std::size_t num_full = bytes / kChecksumBlock * kChecksumBlock;
+    HashBlock(data, num_full);
+
+    block_.insert(block_.end(), data + num_full, data + bytes);
+}
+
+void TensorFileWriter::Close()
+{
+    if(closed_)
+        return;
+
+    closed_ = true;
+
+    if(num_written_ != header_.data_size_)
+    {
+        file_.close();
+        throw std::runtime_error("wrong! " + std::to_string(num_written_) + " of " +
+                                 std::to_string(header_.data_size_) +
+                                 " bytes written to tensor file " + path_);
+    }
+
+    if(!block_.empty())
+        content_hash_combine(hash_, content_hash_block(block_.data(), block_.size()));
+
+    header_.checksum_ = finalize_checksum(hash_, header_.data_size_);
+
+    file_.seekp(offsetof(TensorFileHeader, checksum_));
+    file_.write(reinterpret_cast<const char*>(&header_.checksum_), sizeof(header_.checksum_));
+    file_.close();
+
+    if(!file_)
+    {
+        throw std::runtime_error("wrong! cannot write tensor file " + path_);
+    }
+}
+
+TensorFileMapping::TensorFileMapping(const std::string& path, bool verify)
+{
+    std::size_t file_size = 0;
+
+#ifndef _WIN32
+    const int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if(fd < 0)
+    {
+        throw std::runtime_error("wrong! cannot open tensor file " + path);
+    }
+
+    struct stat st;
+    if(fstat(fd, &st) != 0 || static_cast<std::size_t>(st.st_size) < sizeof(TensorFileHeader))
+    {
+        close(fd);
+        throw std::runtime_error("wrong! " + path + " is not a tensor file");
+    }
+
+    file_size = static_cast<std::size_t>(st.st_size);
+
+    void* p = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+
+    if(p == MAP_FAILED)
+    {
+        throw std::runtime_error("wrong! cannot map tensor file " + path);
+    }
+
+    mapping_ = std::shared_ptr<const void>(p, [file_size](const void* q) {
+        munmap(const_cast<void*>(q), file_size);
+    });
+#else
+    // no mapping; the file is read into memory once and shared by the views
+    std::ifstream file(path, std::ios::in | std::ios::binary);
+    if(!file)
+    {
+        throw std::runtime_error("wrong! cannot open tensor file " + path);
+    }
+
+    auto buffer = std::make_shared<std::vector<char>>(std::istreambuf_iterator<char>(file),
+                                                      std::istreambuf_iterator<char>());
+    file_size   = buffer->size();
+    mapping_    = std::shared_ptr<const void>(buffer, buffer->data());
+
+    if(file_size < sizeof(TensorFileHeader))
+    {
+        throw std::runtime_error("wrong! " + path + " is not a tensor file");
+    }
+#endif
+
+    const auto* base = static_cast<const char*>(mapping_.get());
+
+    std::memcpy(&header_, base, sizeof(header_));
+
+    if(std::memcmp(header_.magic_, kMagic, sizeof(kMagic)) != 0 || header_.version_ != kVersion)
+    {
+        throw std::runtime_error("wrong! " + path + " is not a tensor file of version " +
+                                 std::to_string(kVersion));
+    }
+
+    if(header_.data_offset_ < sizeof(header_) + get_descriptor_bytes(header_.num_dim_) ||
+       header_.data_offset_ > file_size || header_.data_size_ > file_size - header_.data_offset_)
+    {
+        throw std::runtime_error("wrong! tensor file " + path + " is truncated");
+    }
+
+    std::vector<std::uint64_t> dims(2 * header_.num_dim_);
+    std::memcpy(dims.data(), base + sizeof(header_), dims.size() * sizeof(std::uint64_t));
+
+    desc_ = HostTensorDescriptor(
+        std::vector<std::size_t>(dims.begin(), dims.begin() + header_.num_dim_),
+        std::vector<std::size_t>(dims.begin() + header_.num_dim_, dims.end()));
+
+    if(header_.data_size_ != std::uint64_t{header_.element_size_} * desc_.GetElementSpaceSize())
+    {
+        throw std::runtime_error("wrong! tensor file " + path +
+                                 " data size does not match its descriptor");
+    }
+
+    if(verify && compute_checksum(GetData(), header_.data_size_) != header_.checksum_)
+    {
+        throw std::runtime_error("wrong! checksum mismatch in tensor file " + path);
+    }
+}
+
+} // namespace utils
+} // namespace ck
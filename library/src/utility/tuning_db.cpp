@@ -0,0 +1,291 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cerrno>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/file.h>
+#include <unistd.h>
+#endif
+
+#include "ck/library/utility/tuning_db.hpp"
+
+namespace ck {
+namespace utils {
+
+namespace {
+
+constexpr std::size_t kNumField = 10;
+
+// fields are separated by tabs and records by newlines, so neither may appear inside a field
+std::string sanitize(const std::string& field)
+{
+    std::string s = field;
+    for(char& c : s)
+    {
+        if(c == '\t' || c == '\n' || c == '\r')
+            c = ' ';
+    }
+    return s;
+}
+
+std::string to_line(const TuningRecord& record)
+{
+    std::ostringstream os;
+    os.precision(9);
+
+    os << sanitize(record.key_.arch_) << '\t' << sanitize(record.key_.op_) << '\t'
+       << sanitize(record.key_.layouts_) << '\t' << sanitize(record.key_.data_types_) << '\t'
+       << sanitize(record.key_.problem_) << '\t' << sanitize(record.instance_id_) << '\t'
+       << sanitize(record.instance_) << '\t' << record.split_k_ << '\t' << record.ave_time_
+       << '\t' << record.tflops_ << '\n';
+
+    return os.str();
+}
+
+template <typename T>
+bool parse_number(const std::string& s, T& value)
+{
+    std::istringstream is(s);
+    is >> value;
+    return !s.empty() && !is.fail() && is.eof();
+}
+
+std::optional<TuningRecord> from_line(const std::string& line)
+{
+    std::vector<std::string> fields;
+
+    std::size_t begin = 0;
+    for(;;)
+    {
+        const std::size_t end = line.find('\t', begin);
+        fields.push_back(line.substr(begin, end - begin));
+
+        if(end == std::string::npos)
+            break;
+        begin = end + 1;
+    }
+
+    if(fields.size() != kNumField)
+        return std::nullopt;
+
+    TuningRecord record;
+    record.key_.arch_       = fields[0];
+    record.key_.op_         = fields[1];
+    record.key_.layouts_    = fields[2];
+    record.key_.data_types_ = fields[3];
+    record.key_.problem_    = fields[4];
+    record.instance_id_     = fields[5];
+    record.instance_        = fields[6];
+
+    if(!parse_number(fields[7], record.split_k_) || !parse_number(fields[8], record.ave_time_) ||
+       !parse_number(fields[9], record.tflops_))
+        return std::nullopt;
+
+    return record;
+}
+
+#ifndef _WIN32
+// advisory lock of a whole file, released on destruction
+struct FileLock
+{
+    FileLock(int fd, int operation) : fd_(fd)
+    {
+        while(flock(fd_, operation) != 0 && errno == EINTR) {}
+    }
+
+    ~FileLock() { flock(fd_, LOCK_UN); }
+
+    FileLock(const FileLock&) = delete;
+    FileLock& operator=(const FileLock&) = delete;
+
+    int fd_;
+};
+#endif
+
+// fields of the key as stored, joined by tabs
+std::string to_index_key(const TuningKey& key)
+{
+    return sanitize(key.arch_) + '\t' + sanitize(key.op_) + '\t' + sanitize(key.layouts_) +
+           '\t' + sanitize(key.data_types_) + '\t' + sanitize(key.problem_);
+}
+
+} // namespace
+
+struct TuningDb::Index
+{
+    std::mutex mutex_;
+    bool loaded_ = false;
+
+    // fastest record per problem
+    std::map<std::string, TuningRecord> best_;
+
+    void Insert(const TuningRecord& record)
+    {
+        if(!(record.ave_time_ > 0))
+            return;
+
+        const auto [it, inserted] = best_.emplace(to_index_key(record.key_), record);
+        if(!inserted && record.ave_time_ < it->second.ave_time_)
+            it->second = record;
+    }
+};
+
+TuningDb::TuningDb(std::string path) : path_(std::move(path)), index_(std::make_shared<Index>())
+{
+}
+
+std::optional<TuningDb> TuningDb::FromEnvironment()
+{
+    const std::string& path = ck::EnvGetString(CK_ENV(CK_TUNING_DB));
+
+    if(path.empty())
+        return std::nullopt;
+
+    return TuningDb(path);
+}
+
+bool TuningDb::Add(const TuningRecord& record) const
+{
+    const std::string line = to_line(record);
+
+#ifndef _WIN32
+    // O_APPEND moves to the end of the file atomically with every write, and the lock keeps a
+    // reader from seeing half of the line
+    const int fd = open(path_.c_str(), O_RDWR | O_APPEND | O_CREAT | O_CLOEXEC, 0644);
+    if(fd < 0)
+        return false;
+
+    bool written = true;
+    {
+        FileLock lock(fd, LOCK_EX);
+
+        // terminate the partial line of an interrupted writer, so that it only loses its own
+        // record and not this one too
+        std::string text = line;
+
+        const off_t size = lseek(fd, 0, SEEK_END);
+        char last        = '\n';
+        if(size > 0 && pread(fd, &last, 1, size - 1) == 1 && last != '\n')
+            text.insert(text.begin(), '\n');
+
+        std::size_t offset = 0;
+        while(offset < text.size())
+        {
+            const ssize_t n = write(fd, text.data() + offset, text.size() - offset);
+            if(n < 0 && errno == EINTR)
+                continue;
+            if(n <= 0)
+            {
+                written = false;
+                break;
+            }
+            offset += static_cast<std::size_t>(n);
+        }
+    }
+
+    if(close(fd) != 0 || !written)
+        return false;
+#else
+    std::ofstream file(path_, std::ios::out | std::ios::app | std::ios::binary);
+    file << line << std::flush;
+    if(!file)
+        return false;
+#endif
+
+    // index the record as it was stored, like Lookup() after a reload would
+    std::lock_guard<std::mutex> lock(index_->mutex_);
+    if(index_->loaded_)
+    {
+        if(const auto stored = from_line(line.substr(0, line.size() - 1)))
+            index_->Insert(*stored);
+    }
+
+    return true;
+}
+
+std::vector<TuningRecord> TuningDb::Load() const
+{
+    std::string text;
+
+#ifndef _WIN32
+    const int fd = open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+    if(fd < 0)
+        return {};
+
+    {
+        FileLock lock(fd, LOCK_SH);
+
+        char buf[1 << 16];
+        for(;;)
+        {
+            const ssize_t n = read(fd, buf, sizeof(buf));
+            if(n < 0 && errno == EINTR)
+                continue;
+            if(n <= 0)
+                break;
+            text.append(buf, static_cast<std::size_t>(n));
+        }
+    }
+
+    close(fd);
+#else
+    std::ifstream file(path_, std::ios::in | std::ios::binary);
+    text.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+#endif
+
+    std::vector<TuningRecord> records;
+
+    std::size_t begin = 0;
+    while(begin < text.size())
+    {
+        const std::size_t end = text.find('\n', begin);
+
+        // a line without newline is an interrupted write
+        if(end == std::string::npos)
+            break;
+
+        if(auto record = from_line(text.substr(begin, end - begin)))
+            records.push_back(std::move(*record));
+
+        begin = end + 1;
+    }
+
+    return records;
+}
+
+std::optional<TuningRecord> TuningDb::Lookup(const TuningKey& key) const
+{
+    std::lock_guard<std::mutex> lock(index_->mutex_);
+
+    if(!index_->loaded_)
+    {
+        index_->best_.clear();
+        for(const auto& record : Load())
+            index_->Insert(record);
+
+        index_->loaded_ = true;
+    }
+
+    // compare in the form the key was stored in
+    const auto it = index_->best_.find(to_index_key(key));
+    if(it == index_->best_.end())
+        return std::nullopt;
+
+    return it->second;
+}
+
+void TuningDb::Reload() const
+{
+    std::lock_guard<std::mutex> lock(index_->mutex_);
+    index_->loaded_ = false;
+}
+
+} // namespace utils
+} // namespace ck
@@ -15,6 +15,8 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_avgpool_bwd.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -123,6 +125,13 @@ bool profile_avg_pool3d_bwd_impl(int do_verification,
 
     std::cout << "found " << instance_ptrs.size() << " instances" << std::endl;
 
+    const std::string problem = "input=" + get_lengths_string(in_length) +
+                                " window=" + get_lengths_string(window_spatial_lengths) +
+                                " strides=" + get_lengths_string(window_strides) +
+                                " dilations=" + get_lengths_string(window_dilations) +
+                                " pads=" + get_lengths_string(input_left_pads) + "," +
+                                get_lengths_string(input_right_pads);
+
     std::string best_instance_name;
     float best_avg_time   = std::numeric_limits<float>::max();
     float best_gb_per_sec = 0;
@@ -174,6 +183,9 @@ bool profile_avg_pool3d_bwd_impl(int do_verification,
                 LogRange(std::cout << "doutput lengths = ", out_length, ", ") << std::endl;
             }
 
+            ProfilerResultSink::GetInstance().Add(
+                {inst_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
+
             continue;
         }
 
@@ -223,6 +235,15 @@ bool profile_avg_pool3d_bwd_impl(int do_verification,
             {
                 std::cout << inst_ptr->GetTypeString() << " failed verification: ";
                 LogRange(std::cout << "doutput lengths = [", out_length, ", ") << "]." << std::endl;
+
+                ProfilerResultSink::GetInstance().Add({inst_ptr->GetTypeString(),
+                                                       true,
+                                                       avg_time,
+                                                       0,
+                                                       gb_per_sec,
+                                                       VerificationStatus::Fail,
+                                                       problem});
+
                 return false;
             }
             else
@@ -231,6 +252,15 @@ bool profile_avg_pool3d_bwd_impl(int do_verification,
                     std::cout << "pass" << std::endl;
             }
         }
+
+        ProfilerResultSink::GetInstance().Add(
+            {inst_ptr->GetTypeString(),
+             true,
+             avg_time,
+             0,
+             gb_per_sec,
+             do_verification ? VerificationStatus::Pass : VerificationStatus::Skipped,
+             problem});
     }
 
     if(time_kernel)
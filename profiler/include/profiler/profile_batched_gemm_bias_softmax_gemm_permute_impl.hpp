@@ -20,6 +20,8 @@
 #include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_softmax.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -203,6 +205,10 @@ bool profile_batched_gemm_bias_softmax_gemm_permute_impl(bool do_verification,
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
+    const std::string problem = "G0=" + std::to_string(G0) + " G1=" + std::to_string(G1) +
+                                " M=" + std::to_string(M) + " N=" + std::to_string(N) +
+                                " K=" + std::to_string(K) + " O=" + std::to_string(O);
+
     if(do_verification)
     {
         c_device_buf.FromDevice(c_gs_ms_os_device_result.mData.data());
@@ -336,6 +342,8 @@ bool profile_batched_gemm_bias_softmax_gemm_permute_impl(bool do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            auto verification = VerificationStatus::Skipped;
+
             if(do_verification)
             {
                 c_device_buf.FromDevice(c_gs_ms_os_device_result.mData.data());
@@ -355,11 +363,14 @@ bool profile_batched_gemm_bias_softmax_gemm_permute_impl(bool do_verification,
                     atol = 1e-2;
                 }
 
-                pass = pass & ck::utils::check_err(c_gs_ms_os_device_result,
-                                                   c_gs_ms_os_host_result,
-                                                   "Error: Incorrect results!",
-                                                   rtol,
-                                                   atol);
+                const bool instance_pass = ck::utils::check_err(c_gs_ms_os_device_result,
+                                                                c_gs_ms_os_host_result,
+                                                                "Error: Incorrect results!",
+                                                                rtol,
+                                                                atol);
+
+                pass         = pass & instance_pass;
+                verification = instance_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
 
                 if(do_log)
                 {
@@ -378,10 +389,16 @@ bool profile_batched_gemm_bias_softmax_gemm_permute_impl(bool do_verification,
                         << std::endl;
                 }
             }
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_name, true, ave_time, tflops, gb_per_sec, verification, problem});
         }
         else
         {
             std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
         }
     }
 
@@ -21,6 +21,10 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
 
+#include "profiler/profiler_reference_cache.hpp"
+#include "profiler/profiler_result_sink.hpp"
+#include "profiler/profiler_tuning_db.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -115,7 +119,19 @@ bool profile_batched_gemm_impl(int do_verification,
         auto ref_argument = ref_batched_gemm.MakeArgument(
             a_g_m_k, b_g_k_n, c_g_m_n_host_result, a_element_op, b_element_op, c_element_op);
 
-        ref_invoker.Run(ref_argument);
+        run_reference_cached(
+            c_g_m_n_host_result,
+            [&] {
+                return ck::utils::ReferenceCacheKey{"ReferenceBatchedGemm",
+                                                    ReferenceBatchedGemmInstance::CacheVersion}
+                    .Add("batched_gemm")
+                    .Add(ck::utils::get_tuning_data_type_names<ADataType, BDataType, CDataType>())
+                    .Add(init_method)
+                    .Add(a_g_m_k)
+                    .Add(b_g_k_n)
+                    .Add(c_g_m_n_host_result.mDesc);
+            },
+            [&] { ref_invoker.Run(ref_argument); });
     }
 
     DeviceMem a_device_buf(sizeof(ADataType) * a_g_m_k.mDesc.GetElementSpaceSize());
@@ -132,7 +148,16 @@ bool profile_batched_gemm_impl(int do_verification,
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
+    const std::string problem =
+        "BatchCount=" + std::to_string(BatchCount) + " M=" + std::to_string(M) +
+        " N=" + std::to_string(N) + " K=" + std::to_string(K) +
+        " StrideA=" + std::to_string(StrideA) + " StrideB=" + std::to_string(StrideB) +
+        " StrideC=" + std::to_string(StrideC) + " BatchStrideA=" + std::to_string(BatchStrideA) +
+        " BatchStrideB=" + std::to_string(BatchStrideB) +
+        " BatchStrideC=" + std::to_string(BatchStrideC);
+
     std::string best_op_name;
+    std::string best_op_id;
     float best_ave_time   = 0;
     float best_tflops     = 0;
     float best_gb_per_sec = 0;
@@ -225,16 +250,23 @@ bool profile_batched_gemm_impl(int do_verification,
             if(tflops > best_tflops)
             {
                 best_op_name    = op_name;
+                best_op_id      = op_ptr->GetInstanceId();
                 best_tflops     = tflops;
                 best_ave_time   = ave_time;
                 best_gb_per_sec = gb_per_sec;
             }
 
+            auto verification = VerificationStatus::Skipped;
+
             if(do_verification)
             {
                 c_device_buf.FromDevice(c_g_m_n_device_result.mData.data());
 
-                pass = pass & ck::utils::check_err(c_g_m_n_device_result, c_g_m_n_host_result);
+                const bool instance_pass =
+                    ck::utils::check_err(c_g_m_n_device_result, c_g_m_n_host_result);
+
+                pass         = pass & instance_pass;
+                verification = instance_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
 
                 if(do_log)
                 {
@@ -247,16 +279,34 @@ bool profile_batched_gemm_impl(int do_verification,
                         << std::endl;
                 }
             }
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_name, true, ave_time, tflops, gb_per_sec, verification, problem});
         }
         else
         {
             std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
         }
     }
 
     std::cout << "Best Perf: " << best_ave_time << " ms, " << best_tflops << " TFlops, "
               << best_gb_per_sec << " GB/s, " << best_op_name << std::endl;
 
+    add_tuning_record("batched_gemm",
+                      ck::utils::get_tuning_layout_names<ALayout, BLayout, CLayout>(),
+                      ck::utils::get_tuning_data_type_names<ADataType, BDataType, CDataType>(),
+                      problem,
+                      best_op_id,
+                      best_op_name,
+                      0,
+                      best_ave_time,
+                      best_tflops,
+                      time_kernel,
+                      pass);
+
     return pass;
 }
 
@@ -17,6 +17,8 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace tensor_operation {
 namespace device {
@@ -250,6 +252,12 @@ bool profile_batched_gemm_reduce_impl(int do_verification,
         throw std::runtime_error("wrong! no device GEMM instance found");
     }
 
+    const std::string problem =
+        "BatchCount=" + std::to_string(BatchCount) + " M=" + std::to_string(M) +
+        " N=" + std::to_string(N) + " K=" + std::to_string(K) +
+        " StrideA=" + std::to_string(StrideA) + " StrideB=" + std::to_string(StrideB) +
+        " StrideC=" + std::to_string(StrideC);
+
     std::string best_gemm_name;
     float best_ave_time   = 0;
     float best_tflops     = 0;
@@ -310,6 +318,8 @@ bool profile_batched_gemm_reduce_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            auto verification = VerificationStatus::Skipped;
+
             if(do_verification)
             {
                 c_device_buf.FromDevice(c_g_m_n_device_result.mData.data());
@@ -324,6 +334,9 @@ bool profile_batched_gemm_reduce_impl(int do_verification,
                 pass = pass && (d0_error == true);
                 pass = pass && (d1_error == true);
 
+                verification = c_error && d0_error && d1_error ? VerificationStatus::Pass
+                                                               : VerificationStatus::Fail;
+
                 if(do_log)
                 {
                     LogRangeAsType<float>(std::cout << "a : ", a_g_m_k.mData, ",") << std::endl;
@@ -345,10 +358,16 @@ bool profile_batched_gemm_reduce_impl(int do_verification,
                         << std::endl;
                 }
             }
+
+            ProfilerResultSink::GetInstance().Add(
+                {gemm_name, true, ave_time, tflops, gb_per_sec, verification, problem});
         }
         else
         {
             std::cout << "does not support this GEMM problem" << std::endl;
+
+            ProfilerResultSink::GetInstance().Add(
+                {gemm_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
         }
     }
 
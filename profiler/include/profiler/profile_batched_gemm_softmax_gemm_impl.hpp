@@ -20,6 +20,8 @@
 #include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_softmax.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -218,6 +220,10 @@ bool profile_batched_gemm_softmax_gemm_impl(bool do_verification,
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
+    const std::string problem =
+        "BatchCount=" + std::to_string(BatchCount) + " M=" + std::to_string(M) +
+        " N=" + std::to_string(N) + " K=" + std::to_string(K) + " O=" + std::to_string(O);
+
     if(do_verification)
     {
         auto ref_gemm0          = ReferenceGemm0Instance{};
@@ -308,11 +314,17 @@ bool profile_batched_gemm_softmax_gemm_impl(bool do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            auto verification = VerificationStatus::Skipped;
+
             if(do_verification)
             {
                 c_g_m_o_device_buf.FromDevice(c_g_m_o_device_result.mData.data());
 
-                pass = pass & ck::utils::check_err(c_g_m_o_device_result, c_g_m_o_host_result);
+                const bool instance_pass =
+                    ck::utils::check_err(c_g_m_o_device_result, c_g_m_o_host_result);
+
+                pass         = pass & instance_pass;
+                verification = instance_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
 
                 if(do_log)
                 {
@@ -330,10 +342,16 @@ bool profile_batched_gemm_softmax_gemm_impl(bool do_verification,
                         << std::endl;
                 }
             }
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_name, true, ave_time, tflops, gb_per_sec, verification, problem});
         }
         else
         {
             std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
         }
     }
 
@@ -15,6 +15,8 @@
 #include "ck/library/tensor_operation_instance/gpu/batchnorm_backward.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_batchnorm_backward.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -211,6 +213,9 @@ bool profile_batchnorm_backward_impl(bool do_verification,
 
     std::cout << "found " << instance_ptrs.size() << " instances" << std::endl;
 
+    const std::string problem = "lengths=" + get_lengths_string(inOutLengths) +
+                                " reduce_dims=" + get_lengths_string(reduceDims);
+
     std::string best_instance_name;
     float best_avg_time   = std::numeric_limits<float>::max();
     float best_gb_per_sec = 0;
@@ -302,6 +307,9 @@ bool profile_batchnorm_backward_impl(bool do_verification,
                           << " skipped due to unsupported argument: " << std::endl;
             }
 
+            ProfilerResultSink::GetInstance().Add(
+                {inst_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
+
             continue;
         };
 
@@ -338,6 +346,8 @@ bool profile_batchnorm_backward_impl(bool do_verification,
             best_gb_per_sec    = gb_per_sec;
         }
 
+        auto verification = VerificationStatus::Skipped;
+
         if(do_verification)
         {
             using ck::utils::check_err;
@@ -353,7 +363,8 @@ bool profile_batchnorm_backward_impl(bool do_verification,
             single_pass = single_pass && ck::utils::check_err(dbias.mData, dbias_ref.mData, "dBias result:", 3e-3, 3e-3);
             // clang-format on
 
-            pass = pass && single_pass;
+            pass         = pass && single_pass;
+            verification = single_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
         };
 
         if(do_dumpout)
@@ -369,6 +380,9 @@ bool profile_batchnorm_backward_impl(bool do_verification,
             dumpBufferToFile("dump_dscale_ref.bin", dscale_ref.mData.data(), dscale_ref.mDesc.GetElementSize());
             // clang-format off
         };
+
+        ProfilerResultSink::GetInstance().Add(
+            {inst_ptr->GetTypeString(), true, avg_time, 0, gb_per_sec, verification, problem});
     }
 
     if(time_kernel)
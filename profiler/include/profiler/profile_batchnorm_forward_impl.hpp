@@ -15,6 +15,8 @@
 #include "ck/library/tensor_operation_instance/gpu/batchnorm_forward.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_batchnorm_forward.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -206,6 +208,9 @@ bool profile_batchnorm_forward_impl(int do_verification,
 
     std::cout << "found " << instance_ptrs.size() << " instances" << std::endl;
 
+    const std::string problem = "lengths=" + get_lengths_string(inOutLengths) +
+                                " reduce_dims=" + get_lengths_string(reduceDims);
+
     std::string best_instance_name;
     float best_avg_time   = std::numeric_limits<float>::max();
     float best_gb_per_sec = 0;
@@ -296,6 +301,9 @@ bool profile_batchnorm_forward_impl(int do_verification,
                           << " skipped due to unsupported argument: " << std::endl;
             }
 
+            ProfilerResultSink::GetInstance().Add(
+                {inst_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
+
             continue;
         };
 
@@ -334,6 +342,8 @@ bool profile_batchnorm_forward_impl(int do_verification,
             best_gb_per_sec    = gb_per_sec;
         }
 
+        auto verification = VerificationStatus::Skipped;
+
         if(do_verification)
         {
             using ck::utils::check_err;
@@ -368,7 +378,8 @@ bool profile_batchnorm_forward_impl(int do_verification,
                 // clang-format on
             };
 
-            pass = pass && single_pass;
+            pass         = pass && single_pass;
+            verification = single_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
         };
 
         if(do_dumpout)
@@ -391,6 +402,9 @@ bool profile_batchnorm_forward_impl(int do_verification,
                 // clang-format on
             };
         };
+
+        ProfilerResultSink::GetInstance().Add(
+            {inst_ptr->GetTypeString(), true, avg_time, 0, gb_per_sec, verification, problem});
     }
 
     if(time_kernel)
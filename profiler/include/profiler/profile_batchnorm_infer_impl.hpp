@@ -15,6 +15,8 @@
 #include "ck/library/tensor_operation_instance/gpu/batchnorm_infer.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_batchnorm_infer.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -180,6 +182,9 @@ bool profile_batchnorm_infer_impl(int do_verification,
 
     std::cout << "found " << instance_ptrs.size() << " instances" << std::endl;
 
+    const std::string problem = "lengths=" + get_lengths_string(inOutLengths) +
+                                " reduce_dims=" + get_lengths_string(reduceDims);
+
     std::string best_instance_name;
     float best_avg_time   = std::numeric_limits<float>::max();
     float best_gb_per_sec = 0;
@@ -262,6 +267,9 @@ bool profile_batchnorm_infer_impl(int do_verification,
                           << " skipped due to unsupported argument: " << std::endl;
             }
 
+            ProfilerResultSink::GetInstance().Add(
+                {inst_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
+
             continue;
         };
 
@@ -289,6 +297,8 @@ bool profile_batchnorm_infer_impl(int do_verification,
             best_gb_per_sec    = gb_per_sec;
         }
 
+        auto verification = VerificationStatus::Skipped;
+
         if(do_verification)
         {
             using ck::utils::check_err;
@@ -301,7 +311,8 @@ bool profile_batchnorm_infer_impl(int do_verification,
             else
                 single_pass = check_err(y.mData, y_ref.mData, "y results", 4e-3, 4e-3);
 
-            pass = pass && single_pass;
+            pass         = pass && single_pass;
+            verification = single_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
         };
 
         if(do_dumpout)
@@ -314,6 +325,9 @@ bool profile_batchnorm_infer_impl(int do_verification,
             dumpBufferToFile("dump_y_ref.bin", y_ref.mData.data(), y_ref.mDesc.GetElementSize());
             // clang-format off
         };
+
+        ProfilerResultSink::GetInstance().Add(
+            {inst_ptr->GetTypeString(), true, avg_time, 0, gb_per_sec, verification, problem});
     }
 
     if(time_kernel)
@@ -26,6 +26,8 @@
 
 #include "ck/host_utility/io.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -139,6 +141,9 @@ int profile_contraction_impl(ck::index_t do_verification,
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
+    const std::string problem = "M=" + get_lengths_string(M) + " N=" + get_lengths_string(N) +
+                                " K=" + get_lengths_string(K);
+
     using AccDataType =
         typename std::conditional<std::is_same<ComputeDataType, F64>::value, F64, F32>::type;
 
@@ -275,6 +280,8 @@ int profile_contraction_impl(ck::index_t do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            auto verification = VerificationStatus::Skipped;
+
             if(do_verification)
             {
                 e_device_buf.FromDevice(e_m_n_device_result.mData.data());
@@ -302,11 +309,14 @@ int profile_contraction_impl(ck::index_t do_verification,
                     threshold += epsilon * 2;
                 }
 
-                pass = pass & ck::utils::check_err(e_m_n_device_result,
-                                                   e_m_n_host_result,
-                                                   "Error: incorrect results!",
-                                                   threshold,
-                                                   threshold);
+                const bool instance_pass = ck::utils::check_err(e_m_n_device_result,
+                                                                e_m_n_host_result,
+                                                                "Error: incorrect results!",
+                                                                threshold,
+                                                                threshold);
+
+                pass         = pass & instance_pass;
+                verification = instance_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
 
                 if(do_log)
                 {
@@ -318,10 +328,16 @@ int profile_contraction_impl(ck::index_t do_verification,
                         << std::endl;
                 }
             }
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_name, true, avg_time, tflops, gb_per_sec, verification, problem});
         }
         else
         {
             std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
         }
     }
 
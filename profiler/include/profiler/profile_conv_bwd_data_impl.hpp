@@ -18,6 +18,8 @@
 #include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_data.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -170,6 +172,8 @@ bool profile_conv_bwd_data_impl(int do_verification,
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
+    const std::string problem = get_conv_problem_string(conv_param);
+
     std::string best_op_name;
     float best_avg_time   = 0;
     float best_tflops     = 0;
@@ -228,11 +232,17 @@ bool profile_conv_bwd_data_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            auto verification = VerificationStatus::Skipped;
+
             if(do_verification)
             {
                 in_device_buf.FromDevice(input_device_result.mData.data());
 
-                pass = pass & ck::utils::check_err(input_device_result, input_host_result);
+                const bool instance_pass =
+                    ck::utils::check_err(input_device_result, input_host_result);
+
+                pass         = pass & instance_pass;
+                verification = instance_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
 
                 if(do_log)
                 {
@@ -253,10 +263,16 @@ bool profile_conv_bwd_data_impl(int do_verification,
                     std::cout << std::endl;
                 }
             }
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_name, true, avg_time, tflops, gb_per_sec, verification, problem});
         }
         else
         {
             std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
         }
     }
 
@@ -15,6 +15,8 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_conv_fwd_bias_activation.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace tensor_operation {
 namespace device {
@@ -178,6 +180,15 @@ void profile_conv_fwd_bias_relu_impl(int do_verification,
         throw std::runtime_error("wrong! no device Conv instance found");
     }
 
+    const std::string problem = "N=" + std::to_string(N) + " K=" + std::to_string(K) +
+                                " C=" + std::to_string(C) +
+                                " filter=" + get_lengths_string(filter_spatial_lengths) +
+                                " input=" + get_lengths_string(input_spatial_lengths) +
+                                " strides=" + get_lengths_string(conv_filter_strides) +
+                                " dilations=" + get_lengths_string(conv_filter_dilations) +
+                                " pads=" + get_lengths_string(input_left_pads) + "," +
+                                get_lengths_string(input_right_pads);
+
     std::string best_conv_name;
     float best_ave_time   = 0;
     float best_tflops     = 0;
@@ -235,11 +246,16 @@ void profile_conv_fwd_bias_relu_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            auto verification = VerificationStatus::Skipped;
+
             if(do_verification)
             {
                 out_device_buf.FromDevice(out_n_k_ho_wo_device_result.mData.data());
 
-                ck::utils::check_err(out_n_k_ho_wo_device_result, out_n_k_ho_wo_host_result);
+                verification =
+                    ck::utils::check_err(out_n_k_ho_wo_device_result, out_n_k_ho_wo_host_result)
+                        ? VerificationStatus::Pass
+                        : VerificationStatus::Fail;
 
                 if(do_log)
                 {
@@ -255,6 +271,14 @@ void profile_conv_fwd_bias_relu_impl(int do_verification,
                         << std::endl;
                 }
             }
+
+            ProfilerResultSink::GetInstance().Add(
+                {conv_name, true, ave_time, tflops, gb_per_sec, verification, problem});
+        }
+        else
+        {
+            ProfilerResultSink::GetInstance().Add(
+                {op_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
         }
     }
 
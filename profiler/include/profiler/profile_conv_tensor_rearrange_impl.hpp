@@ -23,6 +23,8 @@
 #include "ck/library/reference_tensor_operation/cpu/reference_image_to_column.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_column_to_image.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -219,6 +221,8 @@ bool profile_conv_tensor_rearrange_impl(int do_verification,
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
+    const std::string problem = get_conv_problem_string(conv_param);
+
     std::string best_op_name;
     float best_avg_time   = std::numeric_limits<float>::max();
     float best_gb_per_sec = 0;
@@ -267,10 +271,15 @@ bool profile_conv_tensor_rearrange_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            auto verification = VerificationStatus::Skipped;
+
             if(do_verification)
             {
                 out_device_buf.FromDevice(device_output.mData.data());
-                pass = pass & ck::utils::check_err(device_output, host_output);
+                const bool instance_pass = ck::utils::check_err(device_output, host_output);
+
+                pass         = pass & instance_pass;
+                verification = instance_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
 
                 if(do_log)
                 {
@@ -281,10 +290,16 @@ bool profile_conv_tensor_rearrange_impl(int do_verification,
                         << std::endl;
                 }
             }
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_name, true, avg_time, 0, gb_per_sec, verification, problem});
         }
         else
         {
             std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
         }
     }
 
@@ -16,6 +16,8 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_layernorm.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -136,6 +138,8 @@ bool profile_elementwise_layernorm_impl(int do_verification,
 
     std::cout << "found " << instance_ptrs.size() << " instances" << std::endl;
 
+    const std::string problem = "lengths=" + get_lengths_string(length);
+
     std::string best_instance_name;
     float best_avg_time   = std::numeric_limits<float>::max();
     float best_gb_per_sec = 0;
@@ -202,6 +206,9 @@ bool profile_elementwise_layernorm_impl(int do_verification,
         }
         else
         {
+            ProfilerResultSink::GetInstance().Add(
+                {inst_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
+
             continue;
         }
 
@@ -247,6 +254,15 @@ bool profile_elementwise_layernorm_impl(int do_verification,
             {
                 std::cout << inst_ptr->GetTypeString() << " failed verification: ";
                 LogRange(std::cout << "lengths = [", length, ", ") << "]." << std::endl;
+
+                ProfilerResultSink::GetInstance().Add({inst_ptr->GetTypeString(),
+                                                       true,
+                                                       avg_time,
+                                                       0,
+                                                       gb_per_sec,
+                                                       VerificationStatus::Fail,
+                                                       problem});
+
                 return false;
             }
             else
@@ -255,6 +271,15 @@ bool profile_elementwise_layernorm_impl(int do_verification,
                     std::cout << "pass" << std::endl;
             }
         }
+
+        ProfilerResultSink::GetInstance().Add(
+            {inst_ptr->GetTypeString(),
+             true,
+             avg_time,
+             0,
+             gb_per_sec,
+             do_verification ? VerificationStatus::Pass : VerificationStatus::Skipped,
+             problem});
     }
 
     if(time_kernel)
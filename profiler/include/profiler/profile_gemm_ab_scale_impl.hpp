@@ -21,6 +21,8 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -162,6 +164,9 @@ bool profile_gemm_ab_scale_impl(int do_verification,
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
+    const std::string problem =
+        "M=" + std::to_string(M) + " N=" + std::to_string(N) + " K=" + std::to_string(K);
+
     // Run reference GEMM
     if(do_verification)
     {
@@ -249,10 +254,13 @@ bool profile_gemm_ab_scale_impl(int do_verification,
 
             invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, false, 0, n_warmup, n_iter});
 
+            auto verification = VerificationStatus::Skipped;
+
             if(do_verification)
             {
                 c_device_buf.FromDevice(e_m_n_device_result.mData.data());
 
+                bool instance_pass;
 #if defined CK_ENABLE_FP8
                 // set softer tolerances for fp8
                 if constexpr(is_same_v<A0DataType, f8_t> || is_same_v<B0DataType, f8_t> ||
@@ -261,17 +269,20 @@ bool profile_gemm_ab_scale_impl(int do_verification,
                     std::string msg = "Error: Incorrect results!";
                     double rtol     = 5e-2;
                     double atol     = 5e-2;
-                    pass            = pass & ck::utils::check_err(
-                                      e_m_n_device_result, e_m_n_host_result, msg, rtol, atol);
+                    instance_pass   = ck::utils::check_err(
+                        e_m_n_device_result, e_m_n_host_result, msg, rtol, atol);
                 }
                 else
                 {
 #endif
-                    pass = pass & ck::utils::check_err(e_m_n_device_result, e_m_n_host_result);
+                    instance_pass = ck::utils::check_err(e_m_n_device_result, e_m_n_host_result);
 #if defined CK_ENABLE_FP8
                 }
 #endif
 
+                pass         = pass & instance_pass;
+                verification = instance_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
+
                 if(do_log)
                 {
                     LogRangeAsType<float>(std::cout << "a : ", a0_m_k.mData, ",") << std::endl;
@@ -309,10 +320,16 @@ bool profile_gemm_ab_scale_impl(int do_verification,
                 best_ave_time   = ave_time;
                 best_gb_per_sec = gb_per_sec;
             }
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_name, true, ave_time, tflops, gb_per_sec, verification, problem});
         }
         else
         {
             std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
         }
     }
 
@@ -19,6 +19,8 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -119,6 +121,9 @@ bool profile_gemm_add_multiply_impl(int do_verification,
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
+    const std::string problem =
+        "M=" + std::to_string(M) + " N=" + std::to_string(N) + " K=" + std::to_string(K);
+
     // run reference
     if(do_verification)
     {
@@ -219,16 +224,28 @@ bool profile_gemm_add_multiply_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            auto verification = VerificationStatus::Skipped;
+
             if(do_verification)
             {
                 e_device_buf.FromDevice(e_m_n_device_result.mData.data());
 
-                pass = pass && ck::utils::check_err(e_m_n_device_result, e_m_n_host_result);
+                const bool instance_pass =
+                    ck::utils::check_err(e_m_n_device_result, e_m_n_host_result);
+
+                pass         = pass && instance_pass;
+                verification = instance_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
             }
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_name, true, ave_time, tflops, gb_per_sec, verification, problem});
         }
         else
         {
             std::cout << op_name << " does not support this problem" << std::endl;
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_name, false, 0, 0, 0, VerificationStatus::Skipped, problem});
         }
     }
 
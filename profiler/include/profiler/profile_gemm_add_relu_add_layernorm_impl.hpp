@@ -20,6 +20,8 @@
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_layernorm.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -207,6 +209,9 @@ bool profile_gemm_add_relu_add_layernorm_impl(int do_verification,
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
+    const std::string problem =
+        "M=" + std::to_string(M) + " N=" + std::to_string(N) + " K=" + std::to_string(K);
+
     // run reference
     if(do_verification)
     {
@@ -315,18 +320,29 @@ bool profile_gemm_add_relu_add_layernorm_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            auto verification = VerificationStatus::Skipped;
+
             if(do_verification)
             {
                 h_device_buf.FromDevice(h_m_n.mData.data());
 
-                pass = pass && ck::utils::check_err(
-                                   h_m_n, h_m_n_host, "Error: Incorrect results h_m_n", 1e-2, 1e-2);
+                const bool instance_pass = ck::utils::check_err(
+                    h_m_n, h_m_n_host, "Error: Incorrect results h_m_n", 1e-2, 1e-2);
+
+                pass         = pass && instance_pass;
+                verification = instance_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
             }
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_name, true, ave_time, 0, gb_per_sec, verification, problem});
         }
         else
         {
             if(time_kernel)
                 std::cout << op_name << " does not support this problem" << std::endl;
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_name, false, 0, 0, 0, VerificationStatus::Skipped, problem});
         }
     }
 
@@ -19,10 +19,16 @@
 #include "ck/library/utility/device_memory.hpp"
 #include "ck/library/utility/host_tensor.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/utility/host_tensor_view.hpp"
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 #include "ck/library/utility/fill.hpp"
 
+#include "profiler/profiler_reference_cache.hpp"
+#include "profiler/profiler_result_sink.hpp"
+#include "profiler/profiler_streamed_verification.hpp"
+#include "profiler/profiler_tuning_db.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -62,14 +68,22 @@ int profile_gemm_impl(int do_verification,
             }
         };
 
+    // verification 2 streams the device result and computes the reference slab by slab, so
+    // that neither is held in host memory in full
+    const bool stream_verification = do_verification == 2;
+
+    const auto c_m_n_desc = f_host_tensor_descriptor(M, N, StrideC, CLayout{});
+
     Tensor<ADataType> a_m_k(f_host_tensor_descriptor(M, K, StrideA, ALayout{}));
     Tensor<BDataType> b_k_n(f_host_tensor_descriptor(K, N, StrideB, BLayout{}));
-    Tensor<CDataType> c_m_n_host_result(f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
-    Tensor<CDataType> c_m_n_device_result(f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
+    Tensor<CDataType> c_m_n_host_result(stream_verification ? HostTensorDescriptor{}
+                                                            : c_m_n_desc);
+    Tensor<CDataType> c_m_n_device_result(stream_verification ? HostTensorDescriptor{}
+                                                              : c_m_n_desc);
 
     std::cout << "a_m_k: " << a_m_k.mDesc << std::endl;
     std::cout << "b_k_n: " << b_k_n.mDesc << std::endl;
-    std::cout << "c_m_n: " << c_m_n_device_result.mDesc << std::endl;
+    std::cout << "c_m_n: " << c_m_n_desc << std::endl;
 
     switch(init_method)
     {
@@ -96,7 +110,7 @@ int profile_gemm_impl(int do_verification,
 
     DeviceMem a_device_buf(sizeof(ADataType) * a_m_k.mDesc.GetElementSpaceSize());
     DeviceMem b_device_buf(sizeof(BDataType) * b_k_n.mDesc.GetElementSpaceSize());
-    DeviceMem c_device_buf(sizeof(CDataType) * c_m_n_device_result.mDesc.GetElementSpaceSize());
+    DeviceMem c_device_buf(sizeof(CDataType) * c_m_n_desc.GetElementSpaceSize());
 
     a_device_buf.ToDevice(a_m_k.mData.data());
     b_device_buf.ToDevice(b_k_n.mData.data());
@@ -117,29 +131,51 @@ int profile_gemm_impl(int do_verification,
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
-    // Run reference op
-    if(do_verification)
-    {
-        using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
-                                                                                BDataType,
-                                                                                CDataType,
-                                                                                AccDataType,
-                                                                                AElementOp,
-                                                                                BElementOp,
-                                                                                CElementOp>;
+    using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
+                                                                            BDataType,
+                                                                            CDataType,
+                                                                            AccDataType,
+                                                                            AElementOp,
+                                                                            BElementOp,
+                                                                            CElementOp>;
 
-        auto ref_op      = ReferenceGemmInstance{};
-        auto ref_invoker = ref_op.MakeInvoker();
+    auto ref_op      = ReferenceGemmInstance{};
+    auto ref_invoker = ref_op.MakeInvoker();
 
+    // Run reference op
+    if(do_verification && !stream_verification)
+    {
         auto ref_argument = ref_op.MakeArgument(
             a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, c_element_op);
 
-        ref_invoker.Run(ref_argument);
+        run_reference_cached(
+            c_m_n_host_result,
+            [&] {
+                return ck::utils::ReferenceCacheKey{"ReferenceGemm",
+                                                    ReferenceGemmInstance::CacheVersion}
+                    .Add("gemm")
+                    .Add(ck::utils::get_tuning_data_type_names<ADataType,
+                                                               BDataType,
+                                                               AccDataType,
+                                                               CDataType>())
+                    .Add(init_method)
+                    .Add(a_m_k)
+                    .Add(b_k_n)
+                    .Add(c_m_n_host_result.mDesc);
+            },
+            [&] { ref_invoker.Run(ref_argument); });
     }
 
+    const std::string problem = "M=" + std::to_string(M) + " N=" + std::to_string(N) +
+                                " K=" + std::to_string(K) + " StrideA=" + std::to_string(StrideA) +
+                                " StrideB=" + std::to_string(StrideB) +
+                                " StrideC=" + std::to_string(StrideC);
+
     float best_tflops    = 0;
     int best_instance_id = 0;
 
+    StreamedVerification<CDataType> streamed_verification(c_m_n_desc, c_device_buf);
+
     int instance_id = 0;
     // profile device op instances
     for(auto& op_ptr : op_ptrs)
@@ -188,11 +224,17 @@ int profile_gemm_impl(int do_verification,
                 best_tflops      = tflops;
             }
 
-            if(do_verification)
+            auto verification = VerificationStatus::Skipped;
+
+            if(do_verification && !stream_verification)
             {
                 c_device_buf.FromDevice(c_m_n_device_result.mData.data());
 
-                pass = pass & ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
+                const bool instance_pass =
+                    ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
+
+                pass         = pass & instance_pass;
+                verification = instance_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
 
                 if(do_log)
                 {
@@ -204,15 +246,44 @@ int profile_gemm_impl(int do_verification,
                         << std::endl;
                 }
             }
+
+            const ProfilerResult result{
+                op_name, true, avg_time, tflops, gb_per_sec, verification, problem};
+
+            if(stream_verification)
+                streamed_verification.Add(result, std::move(argument_ptr), std::move(invoker_ptr));
+            else
+                ProfilerResultSink::GetInstance().Add(result);
         }
         else
         {
             std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
+
+            const ProfilerResult result{
+                op_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem};
+
+            if(stream_verification)
+                streamed_verification.Add(result);
+            else
+                ProfilerResultSink::GetInstance().Add(result);
         }
 
         instance_id++;
     }
 
+    if(stream_verification)
+    {
+        // every slab of the reference is computed once for all instances, B or A is packed once
+        auto ref_slab_invoker = ReferenceGemmInstance::MakeSlabInvoker(
+            a_m_k, b_k_n, a_element_op, b_element_op, c_element_op);
+
+        pass = pass & streamed_verification.Verify(
+                          [&](TensorView<CDataType> c_slab,
+                              std::size_t dim,
+                              std::size_t begin,
+                              std::size_t end) { ref_slab_invoker.Run(c_slab, dim, begin, end); });
+    }
+
     sleep(2);
 
     // Run the best instance again
@@ -295,6 +366,19 @@ int profile_gemm_impl(int do_verification,
                       << " StrideB = " << StrideB << " StrideC = " << StrideC << " : " << avg_time
                       << " ms, " << tflops << " TFlops, " << gb_per_sec << " GB/s, " << op_name
                       << std::endl;
+
+            add_tuning_record(
+                "gemm",
+                ck::utils::get_tuning_layout_names<ALayout, BLayout, CLayout>(),
+                ck::utils::get_tuning_data_type_names<ADataType, BDataType, CDataType>(),
+                problem,
+                op_ptr->GetInstanceId(),
+                op_name,
+                0,
+                avg_time,
+                tflops,
+                time_kernel,
+                pass);
         }
     }
 
@@ -21,6 +21,8 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -148,6 +150,9 @@ bool profile_gemm_multiply_multiply_impl(int do_verification,
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
+    const std::string problem_sizes =
+        "M=" + std::to_string(M) + " N=" + std::to_string(N) + " K=" + std::to_string(K);
+
     // Run reference GEMM
     if(do_verification)
     {
@@ -219,6 +224,8 @@ bool profile_gemm_multiply_multiply_impl(int do_verification,
 
             auto invoker_ptr = op_ptr->MakeInvokerPointer();
 
+            const std::string problem = problem_sizes + " KBatch=" + std::to_string(kbatch_curr);
+
             if(op_ptr->IsSupportedArgument(argument_ptr.get()))
             {
 
@@ -228,11 +235,18 @@ bool profile_gemm_multiply_multiply_impl(int do_verification,
                 invoker_ptr->Run(argument_ptr.get(),
                                  StreamConfig{nullptr, false, 0, n_warmup, n_iter});
 
+                auto verification = VerificationStatus::Skipped;
+
                 if(do_verification)
                 {
                     c_device_buf.FromDevice(e_m_n_device_result.mData.data());
 
-                    pass = pass & ck::utils::check_err(e_m_n_device_result, e_m_n_host_result);
+                    const bool instance_pass =
+                        ck::utils::check_err(e_m_n_device_result, e_m_n_host_result);
+
+                    pass = pass & instance_pass;
+                    verification =
+                        instance_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
 
                     if(do_log)
                     {
@@ -298,11 +312,22 @@ bool profile_gemm_multiply_multiply_impl(int do_verification,
                     best_gb_per_sec = gb_per_sec;
                     best_kbatch     = kbatch_curr;
                 }
+
+                ProfilerResultSink::GetInstance().Add(
+                    {op_name, true, ave_time, tflops, gb_per_sec, verification, problem});
             }
             else
             {
                 std::cout << op_ptr->GetTypeString() << " does not support this problem"
                           << std::endl;
+
+                ProfilerResultSink::GetInstance().Add({op_ptr->GetTypeString(),
+                                                       false,
+                                                       0,
+                                                       0,
+                                                       0,
+                                                       VerificationStatus::Skipped,
+                                                       problem});
             }
         }
     }
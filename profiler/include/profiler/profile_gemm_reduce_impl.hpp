@@ -17,6 +17,8 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace tensor_operation {
 namespace device {
@@ -245,6 +247,11 @@ bool profile_gemm_reduce_impl(int do_verification,
         throw std::runtime_error("wrong! no device GEMM instance found");
     }
 
+    const std::string problem = "M=" + std::to_string(M) + " N=" + std::to_string(N) +
+                                " K=" + std::to_string(K) + " StrideA=" + std::to_string(StrideA) +
+                                " StrideB=" + std::to_string(StrideB) +
+                                " StrideC=" + std::to_string(StrideC);
+
     std::string best_gemm_name;
     float best_ave_time   = 0;
     float best_tflops     = 0;
@@ -304,15 +311,22 @@ bool profile_gemm_reduce_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            auto verification = VerificationStatus::Skipped;
+
             if(do_verification)
             {
                 c_device_buf.FromDevice(c_m_n_device_result.mData.data());
                 reduce0_device_buf.FromDevice(reduce0_m_device_result.mData.data());
                 reduce1_device_buf.FromDevice(reduce1_m_device_result.mData.data());
 
-                ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
-                ck::utils::check_err(reduce0_m_device_result, reduce0_m_host_result);
-                ck::utils::check_err(reduce1_m_device_result, reduce1_m_host_result);
+                const bool c_pass  = ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
+                const bool d0_pass =
+                    ck::utils::check_err(reduce0_m_device_result, reduce0_m_host_result);
+                const bool d1_pass =
+                    ck::utils::check_err(reduce1_m_device_result, reduce1_m_host_result);
+
+                verification = c_pass && d0_pass && d1_pass ? VerificationStatus::Pass
+                                                            : VerificationStatus::Fail;
 
                 if(do_log)
                 {
@@ -336,10 +350,16 @@ bool profile_gemm_reduce_impl(int do_verification,
                         << std::endl;
                 }
             }
+
+            ProfilerResultSink::GetInstance().Add(
+                {gemm_name, true, ave_time, tflops, gb_per_sec, verification, problem});
         }
         else
         {
             std::cout << "does not support this GEMM problem" << std::endl;
+
+            ProfilerResultSink::GetInstance().Add(
+                {gemm_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
         }
     }
 
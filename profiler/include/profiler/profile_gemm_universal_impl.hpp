@@ -21,6 +21,12 @@
 #include "ck/library/utility/literals.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
+#include "profiler/profiler_instance_ranking.hpp"
+#include "profiler/profiler_reference_cache.hpp"
+#include "profiler/profiler_result_sink.hpp"
+#include "profiler/profiler_streamed_verification.hpp"
+#include "profiler/profiler_tuning_db.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -63,10 +69,18 @@ bool profile_gemm_universal_impl(int do_verification,
             }
         };
 
+    // verification 2 streams the device results and computes the reference slab by slab, so
+    // that neither is held in host memory in full
+    const bool stream_verification = do_verification == 2;
+
+    const auto c_m_n_desc = f_host_tensor_descriptor(M, N, StrideC, CLayout{});
+
     Tensor<ADataType> a_m_k(f_host_tensor_descriptor(M, K, StrideA, ALayout{}));
     Tensor<BDataType> b_k_n(f_host_tensor_descriptor(K, N, StrideB, BLayout{}));
-    Tensor<CDataType> c_m_n_host_result(f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
-    Tensor<CDataType> c_m_n_device_result(f_host_tensor_descriptor(M, N, StrideC, CLayout{}));
+    Tensor<CDataType> c_m_n_host_result(stream_verification ? HostTensorDescriptor{}
+                                                            : c_m_n_desc);
+    Tensor<CDataType> c_m_n_device_result(stream_verification ? HostTensorDescriptor{}
+                                                              : c_m_n_desc);
 
     int total_gemm_needed = a_m_k.GetElementSpaceSizeInBytes() + b_k_n.GetElementSpaceSizeInBytes();
     int rotating_count    = std::max(
@@ -76,7 +90,7 @@ bool profile_gemm_universal_impl(int do_verification,
 
     std::cout << "a_m_k: " << a_m_k.mDesc << std::endl;
     std::cout << "b_k_n: " << b_k_n.mDesc << std::endl;
-    std::cout << "c_m_n: " << c_m_n_device_result.mDesc << std::endl;
+    std::cout << "c_m_n: " << c_m_n_desc << std::endl;
     std::cout << "rotating count: " << rotating_count << std::endl;
 
     switch(init_method)
@@ -101,7 +115,7 @@ bool profile_gemm_universal_impl(int do_verification,
 
     DeviceMem a_device_buf(sizeof(ADataType) * a_m_k.mDesc.GetElementSpaceSize());
     DeviceMem b_device_buf(sizeof(BDataType) * b_k_n.mDesc.GetElementSpaceSize());
-    DeviceMem c_device_buf(sizeof(CDataType) * c_m_n_device_result.mDesc.GetElementSpaceSize());
+    DeviceMem c_device_buf(sizeof(CDataType) * c_m_n_desc.GetElementSpaceSize());
 
     a_device_buf.ToDevice(a_m_k.mData.data());
     b_device_buf.ToDevice(b_k_n.mData.data());
@@ -117,38 +131,82 @@ bool profile_gemm_universal_impl(int do_verification,
                                                                 CElementOp>;
 
     // get device op instances
-    const auto op_ptrs = ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<
-        DeviceOp>::GetInstances();
+    const std::string problem_sizes = "M=" + std::to_string(M) + " N=" + std::to_string(N) +
+                                      " K=" + std::to_string(K) +
+                                      " StrideA=" + std::to_string(StrideA) +
+                                      " StrideB=" + std::to_string(StrideB) +
+                                      " StrideC=" + std::to_string(StrideC);
+
+    const std::string layout_names =
+        ck::utils::get_tuning_layout_names<ALayout, BLayout, CLayout>();
+    const std::string data_type_names =
+        ck::utils::get_tuning_data_type_names<ADataType, BDataType, CDataType, ComputeDataType>();
+
+    // the instance a previous sweep found fastest is profiled even if the ranking leaves it out
+    const auto tuned =
+        find_tuning_record("gemm_universal", layout_names, data_type_names, problem_sizes);
+
+    if(tuned)
+    {
+        std::cout << "tuning database: " << tuned->instance_ << ", KBatch " << tuned->split_k_
+                  << ", " << tuned->ave_time_ << " ms" << std::endl;
+    }
+
+    const auto op_ptrs = get_gemm_instances_to_profile<
+        ck::tensor_operation::device::instance::DeviceOperationInstanceFactory<DeviceOp>,
+        ADataType,
+        BDataType,
+        CDataType,
+        ComputeDataType>(M, N, K, tuned ? tuned->instance_id_ : "");
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
+    using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
+                                                                            BDataType,
+                                                                            CDataType,
+                                                                            AccDataType,
+                                                                            AElementOp,
+                                                                            BElementOp,
+                                                                            CElementOp,
+                                                                            ComputeDataType>;
+
     // Run reference GEMM
-    if(do_verification)
+    if(do_verification && !stream_verification)
     {
-        using ReferenceGemmInstance = ck::tensor_operation::host::ReferenceGemm<ADataType,
-                                                                                BDataType,
-                                                                                CDataType,
-                                                                                AccDataType,
-                                                                                AElementOp,
-                                                                                BElementOp,
-                                                                                CElementOp,
-                                                                                ComputeDataType>;
-
         auto ref_gemm    = ReferenceGemmInstance{};
         auto ref_invoker = ref_gemm.MakeInvoker();
 
         auto ref_argument = ref_gemm.MakeArgument(
             a_m_k, b_k_n, c_m_n_host_result, a_element_op, b_element_op, c_element_op);
 
-        ref_invoker.Run(ref_argument);
+        run_reference_cached(
+            c_m_n_host_result,
+            [&] {
+                return ck::utils::ReferenceCacheKey{"ReferenceGemm",
+                                                    ReferenceGemmInstance::CacheVersion}
+                    .Add("gemm_universal")
+                    .Add(ck::utils::get_tuning_data_type_names<ADataType,
+                                                               BDataType,
+                                                               AccDataType,
+                                                               CDataType,
+                                                               ComputeDataType>())
+                    .Add(init_method)
+                    .Add(a_m_k)
+                    .Add(b_k_n)
+                    .Add(c_m_n_host_result.mDesc);
+            },
+            [&] { ref_invoker.Run(ref_argument); });
     }
 
     std::string best_op_name;
+    std::string best_op_id;
     float best_ave_time   = 0;
     float best_tflops     = 0;
     float best_gb_per_sec = 0;
     float best_kbatch     = 0;
 
+    StreamedVerification<CDataType> streamed_verification(c_m_n_desc, c_device_buf);
+
     // profile device GEMM instances
     for(auto& op_ptr : op_ptrs)
     {
@@ -180,6 +238,8 @@ bool profile_gemm_universal_impl(int do_verification,
 
             auto invoker_ptr = op_ptr->MakeInvokerPointer();
 
+            const std::string problem = problem_sizes + " KBatch=" + std::to_string(kbatch_curr);
+
             if(op_ptr->IsSupportedArgument(argument_ptr.get()))
             {
 
@@ -189,10 +249,14 @@ bool profile_gemm_universal_impl(int do_verification,
                 invoker_ptr->Run(argument_ptr.get(),
                                  StreamConfig{nullptr, false, 0, n_warmup, n_iter});
 
-                if(do_verification)
+                auto verification = VerificationStatus::Skipped;
+
+                if(do_verification && !stream_verification)
                 {
                     c_device_buf.FromDevice(c_m_n_device_result.mData.data());
 
+                    bool instance_pass = true;
+
 #if defined CK_ENABLE_FP8
                     // set softer tolerances for fp8
                     if constexpr(is_same_v<ADataType, f8_t> || is_same_v<BDataType, f8_t> ||
@@ -201,17 +265,22 @@ bool profile_gemm_universal_impl(int do_verification,
                         std::string msg = "Error: Incorrect results!";
                         double rtol     = 1e-1;
                         double atol     = 1e-1;
-                        pass            = pass & ck::utils::check_err(
-                                          c_m_n_device_result, c_m_n_host_result, msg, rtol, atol);
+                        instance_pass   = ck::utils::check_err(
+                            c_m_n_device_result, c_m_n_host_result, msg, rtol, atol);
                     }
                     else
                     {
 #endif
-                        pass = pass & ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
+                        instance_pass =
+                            ck::utils::check_err(c_m_n_device_result, c_m_n_host_result);
 #if defined CK_ENABLE_FP8
                     }
 #endif
 
+                    pass = pass & instance_pass;
+                    verification =
+                        instance_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
+
                     if(do_log)
                     {
                         LogRangeAsType<float>(std::cout << "a : ", a_m_k.mData, ",") << std::endl;
@@ -252,20 +321,79 @@ bool profile_gemm_universal_impl(int do_verification,
                 if(tflops > best_tflops && ave_time > 1e-10)
                 {
                     best_op_name    = op_name;
+                    best_op_id      = op_ptr->GetInstanceId();
                     best_tflops     = tflops;
                     best_ave_time   = ave_time;
                     best_gb_per_sec = gb_per_sec;
                     best_kbatch     = kbatch_curr;
                 }
+
+                const ProfilerResult result{op_name,
+                                            true,
+                                            ave_time,
+                                            tflops,
+                                            gb_per_sec,
+                                            verification,
+                                            problem,
+                                            op_ptr->GetInstanceId()};
+
+                if(stream_verification)
+                    streamed_verification.Add(
+                        result, std::move(argument_ptr), std::move(invoker_ptr));
+                else
+                    ProfilerResultSink::GetInstance().Add(result);
             }
             else
             {
                 std::cout << op_ptr->GetTypeString() << " does not support this problem"
                           << std::endl;
+
+                const ProfilerResult result{op_ptr->GetTypeString(),
+                                            false,
+                                            0,
+                                            0,
+                                            0,
+                                            VerificationStatus::Skipped,
+                                            problem,
+                                            op_ptr->GetInstanceId()};
+
+                if(stream_verification)
+                    streamed_verification.Add(result);
+                else
+                    ProfilerResultSink::GetInstance().Add(result);
             }
         }
     }
 
+    if(stream_verification)
+    {
+        // every slab of the reference is computed once for all instances, B or A is packed once
+        auto ref_slab_invoker = ReferenceGemmInstance::MakeSlabInvoker(
+            a_m_k, b_k_n, a_element_op, b_element_op, c_element_op);
+
+        auto compute_reference = [&](TensorView<CDataType> c_slab,
+                                     std::size_t dim,
+                                     std::size_t begin,
+                                     std::size_t end) {
+            ref_slab_invoker.Run(c_slab, dim, begin, end);
+        };
+
+#if defined CK_ENABLE_FP8
+        // set softer tolerances for fp8
+        if constexpr(is_same_v<ADataType, f8_t> || is_same_v<BDataType, f8_t> ||
+                     is_same_v<CDataType, f8_t>)
+        {
+            pass = pass & streamed_verification.Verify(compute_reference, 1e-1, 1e-1);
+        }
+        else
+        {
+#endif
+            pass = pass & streamed_verification.Verify(compute_reference);
+#if defined CK_ENABLE_FP8
+        }
+#endif
+    }
+
     if constexpr(is_same<CDataType, float>::value)
     {
         std::cout << "Best Perf for datatype = f32";
@@ -306,6 +434,18 @@ bool profile_gemm_universal_impl(int do_verification,
               << " : " << best_ave_time << " ms, " << best_tflops << " TFlops, " << best_gb_per_sec
               << " GB/s, " << best_op_name << std::endl;
 
+    add_tuning_record("gemm_universal",
+                      layout_names,
+                      data_type_names,
+                      problem_sizes,
+                      best_op_id,
+                      best_op_name,
+                      static_cast<int>(best_kbatch),
+                      best_ave_time,
+                      best_tflops,
+                      time_kernel,
+                      pass);
+
     return pass;
 }
 
@@ -20,6 +20,10 @@
 #include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_data.hpp"
 #include "ck/library/tensor_operation_instance/gpu/grouped_convolution_backward_data.hpp"
 
+#include "profiler/profiler_reference_cache.hpp"
+#include "profiler/profiler_result_sink.hpp"
+#include "profiler/profiler_tuning_db.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -113,10 +117,28 @@ bool profile_grouped_conv_bwd_data_impl(int do_verification,
                                                   wei_element_op,
                                                   in_element_op);
 
-        ref_invoker.Run(ref_argument);
+        run_reference_cached(
+            in_host,
+            [&] {
+                return ck::utils::ReferenceCacheKey{"ReferenceConvBwdData",
+                                                    decltype(ref_conv)::CacheVersion}
+                    .Add("grouped_conv_bwd_data")
+                    .Add(ck::utils::get_tuning_data_type_names<InDataType,
+                                                               WeiDataType,
+                                                               OutDataType>())
+                    .Add(get_conv_problem_string(conv_param))
+                    .Add(init_method)
+                    .Add(out)
+                    .Add(wei)
+                    .Add(in_host.mDesc);
+            },
+            [&] { ref_invoker.Run(ref_argument); });
     }
 
+    const std::string problem = get_conv_problem_string(conv_param);
+
     std::string best_op_name;
+    std::string best_op_id;
     float best_avg_time   = 0;
     float best_tflops     = 0;
     float best_gb_per_sec = 0;
@@ -150,16 +172,22 @@ bool profile_grouped_conv_bwd_data_impl(int do_verification,
             if(tflops > best_tflops)
             {
                 best_op_name    = op_name;
+                best_op_id      = op_ptr->GetInstanceId();
                 best_tflops     = tflops;
                 best_avg_time   = avg_time;
                 best_gb_per_sec = gb_per_sec;
             }
 
+            auto verification = VerificationStatus::Skipped;
+
             if(do_verification)
             {
                 in_device_buf.FromDevice(in_device.mData.data());
 
-                pass = pass & ck::utils::check_err(in_device, in_host);
+                const bool instance_pass = ck::utils::check_err(in_device, in_host);
+
+                pass         = pass & instance_pass;
+                verification = instance_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
 
                 if(do_log)
                 {
@@ -171,10 +199,16 @@ bool profile_grouped_conv_bwd_data_impl(int do_verification,
                         << std::endl;
                 }
             }
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_name, true, avg_time, tflops, gb_per_sec, verification, problem});
         }
         else
         {
             std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
         }
     };
 
@@ -250,6 +284,19 @@ bool profile_grouped_conv_bwd_data_impl(int do_verification,
               << "\nname: " << best_op_name << "\navg_time: " << best_avg_time
               << "\ntflops: " << best_tflops << "\nGB/s: " << best_gb_per_sec << std::endl;
 
+    add_tuning_record(
+        "grouped_conv_bwd_data",
+        ck::utils::get_tuning_layout_names<InLayout, WeiLayout, OutLayout>(),
+        ck::utils::get_tuning_data_type_names<InDataType, WeiDataType, OutDataType>(),
+        problem,
+        best_op_id,
+        best_op_name,
+        0,
+        best_avg_time,
+        best_tflops,
+        time_kernel,
+        pass);
+
     return pass;
 }
 
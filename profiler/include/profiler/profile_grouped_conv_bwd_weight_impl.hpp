@@ -24,6 +24,10 @@
 #include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_weight.hpp"
 
+#include "profiler/profiler_reference_cache.hpp"
+#include "profiler/profiler_result_sink.hpp"
+#include "profiler/profiler_tuning_db.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -113,7 +117,22 @@ bool profile_grouped_conv_bwd_weight_impl(int do_verification,
                                                   {},
                                                   {});
 
-        ref_invoker.Run(ref_argument);
+        run_reference_cached(
+            weight_host_result,
+            [&] {
+                return ck::utils::ReferenceCacheKey{"ReferenceConvBwdWeight",
+                                                    decltype(ref_conv)::CacheVersion}
+                    .Add("grouped_conv_bwd_weight")
+                    .Add(ck::utils::get_tuning_data_type_names<InDataType,
+                                                               WeiDataType,
+                                                               OutDataType>())
+                    .Add(get_conv_problem_string(conv_param))
+                    .Add(init_method)
+                    .Add(input)
+                    .Add(output)
+                    .Add(weight_host_result.mDesc);
+            },
+            [&] { ref_invoker.Run(ref_argument); });
     }
 
     using DeviceOp = ck::tensor_operation::device::DeviceGroupedConvBwdWeight<NDimSpatial,
@@ -136,6 +155,7 @@ bool profile_grouped_conv_bwd_weight_impl(int do_verification,
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
     std::string best_op_name;
+    std::string best_op_id;
     float best_avg_time      = 0;
     float best_tflops        = 0;
     float best_gb_per_sec    = 0;
@@ -202,6 +222,9 @@ bool profile_grouped_conv_bwd_weight_impl(int do_verification,
             DeviceMem workspace_dev(workspace_sz);
             op_ptr->SetWorkSpacePointer(argument_ptr.get(), workspace_dev.GetDeviceBuffer());
 
+            const std::string problem = get_conv_problem_string(conv_param) +
+                                        " SplitK=" + std::to_string(split_k_list[split_k_id]);
+
             if(op_ptr->IsSupportedArgument(argument_ptr.get()))
             {
                 // using atomic add, so need to reset input
@@ -227,12 +250,15 @@ bool profile_grouped_conv_bwd_weight_impl(int do_verification,
                 if(tflops > best_tflops)
                 {
                     best_op_name    = op_name;
+                    best_op_id      = op_ptr->GetInstanceId();
                     best_tflops     = tflops;
                     best_avg_time   = avg_time;
                     best_gb_per_sec = gb_per_sec;
                     best_split_k    = split_k_list[split_k_id];
                 }
 
+                auto verification = VerificationStatus::Skipped;
+
                 if(do_verification)
                 {
                     wei_device_buf.FromDevice(weight_device_result.mData.data());
@@ -245,6 +271,7 @@ bool profile_grouped_conv_bwd_weight_impl(int do_verification,
                     }
 
                     all_pass &= pass;
+                    verification = pass ? VerificationStatus::Pass : VerificationStatus::Fail;
 
                     if(do_log)
                     {
@@ -260,11 +287,22 @@ bool profile_grouped_conv_bwd_weight_impl(int do_verification,
                             << std::endl;
                     }
                 }
+
+                ProfilerResultSink::GetInstance().Add(
+                    {op_name, true, avg_time, tflops, gb_per_sec, verification, problem});
             }
             else
             {
                 std::cout << op_ptr->GetTypeString() << " does not support this problem"
                           << std::endl;
+
+                ProfilerResultSink::GetInstance().Add({op_ptr->GetTypeString(),
+                                                       false,
+                                                       0,
+                                                       0,
+                                                       0,
+                                                       VerificationStatus::Skipped,
+                                                       problem});
             }
         }
     }
@@ -274,6 +312,22 @@ bool profile_grouped_conv_bwd_weight_impl(int do_verification,
               << "\ntflops: " << best_tflops << "\nGB/s: " << best_gb_per_sec << ", SplitK "
               << best_split_k << std::endl;
 
+    add_tuning_record("grouped_conv_bwd_weight",
+                      ck::utils::get_tuning_layout_names<InLayout, WeiLayout, OutLayout>(),
+                      ck::utils::get_tuning_data_type_names<InDataType,
+                                                            WeiDataType,
+                                                            OutDataType,
+                                                            ComputeTypeA,
+                                                            ComputeTypeB>(),
+                      get_conv_problem_string(conv_param),
+                      best_op_id,
+                      best_op_name,
+                      best_split_k,
+                      best_avg_time,
+                      best_tflops,
+                      time_kernel,
+                      all_pass);
+
     return all_pass;
 }
 
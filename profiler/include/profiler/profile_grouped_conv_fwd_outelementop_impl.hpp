@@ -6,6 +6,8 @@
 #include "ck/library/utility/device_memory.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -229,6 +231,8 @@ bool profile_grouped_conv_fwd_outelementop_impl(int do_verification,
         host_output.ForEach([&](auto&, auto idx) { out_element_op(host_output(idx), c(idx)); });
     }
 
+    const std::string problem = get_conv_problem_string(conv_param);
+
     std::string best_op_name;
     float best_avg_time   = 0;
     float best_tflops     = 0;
@@ -265,15 +269,21 @@ bool profile_grouped_conv_fwd_outelementop_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            auto verification = VerificationStatus::Skipped;
+
             if(do_verification)
             {
                 out_device_buf.FromDevice(device_output.mData.data());
 
-                pass = pass & ck::utils::check_err(device_output,
-                                                   host_output,
-                                                   "Error: Device and Host results do not match!",
-                                                   get_rtol<OutDataType>(),
-                                                   get_atol<OutDataType>());
+                const bool instance_pass =
+                    ck::utils::check_err(device_output,
+                                         host_output,
+                                         "Error: Device and Host results do not match!",
+                                         get_rtol<OutDataType>(),
+                                         get_atol<OutDataType>());
+
+                pass         = pass & instance_pass;
+                verification = instance_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
 
                 if(do_log)
                 {
@@ -289,10 +299,16 @@ bool profile_grouped_conv_fwd_outelementop_impl(int do_verification,
                         << std::endl;
                 }
             }
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_name, true, avg_time, tflops, gb_per_sec, verification, problem});
         }
         else
         {
             std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
         }
     };
 
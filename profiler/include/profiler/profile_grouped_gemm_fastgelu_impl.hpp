@@ -17,6 +17,8 @@
 #include "ck/tensor_operation/gpu/device/device_grouped_gemm.hpp"
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -162,6 +164,9 @@ bool profile_grouped_gemm_fastgelu_impl(int do_verification,
         throw std::runtime_error("wrong! no device GEMM instance found");
     }
 
+    const std::string problem = "Ms=" + get_lengths_string(Ms) + " Ns=" + get_lengths_string(Ns) +
+                                " Ks=" + get_lengths_string(Ks);
+
     std::string best_gemm_name;
     float best_ave_time   = 0;
     float best_tflops     = 0;
@@ -208,8 +213,12 @@ bool profile_grouped_gemm_fastgelu_impl(int do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            auto verification = VerificationStatus::Skipped;
+
             if(do_verification)
             {
+                verification = VerificationStatus::Pass;
+
                 for(std::size_t i = 0; i < gemm_descs.size(); i++)
                 {
 
@@ -241,6 +250,9 @@ bool profile_grouped_gemm_fastgelu_impl(int do_verification,
                         ck::utils::check_err(c_m_n_device_results[i], c_m_n_host_result);
                     pass = pass && group_pass;
 
+                    if(!group_pass)
+                        verification = VerificationStatus::Fail;
+
                     std::cout << "group: " << i << " verification result: " << std::boolalpha
                               << group_pass << std::endl;
 
@@ -258,10 +270,16 @@ bool profile_grouped_gemm_fastgelu_impl(int do_verification,
                     }
                 }
             }
+
+            ProfilerResultSink::GetInstance().Add(
+                {gemm_name, true, ave_time, tflops, gb_per_sec, verification, problem});
         }
         else
         {
             std::cout << "does not support this GEMM problem" << std::endl;
+
+            ProfilerResultSink::GetInstance().Add(
+                {gemm_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
         }
     }
 
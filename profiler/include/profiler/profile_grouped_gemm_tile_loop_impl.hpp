@@ -20,6 +20,8 @@
 #include "ck/library/utility/fill.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -186,6 +188,9 @@ bool profile_grouped_gemm_tile_loop_impl(int do_verification,
         throw std::runtime_error("wrong! no device GEMM instance found");
     }
 
+    const std::string problem = "Ms=" + get_lengths_string(Ms) + " Ns=" + get_lengths_string(Ns) +
+                                " Ks=" + get_lengths_string(Ks);
+
     std::string best_gemm_name;
     float best_ave_time   = 0;
     float best_tflops     = 0;
@@ -242,6 +247,9 @@ bool profile_grouped_gemm_tile_loop_impl(int do_verification,
         if(gemm_ptr->IsSupportedArgument(argument_ptr.get()))
         {
             invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, false, 0, n_warmup, n_iter});
+
+            auto verification = VerificationStatus::Skipped;
+
             if(do_verification)
             {
                 bool instance_pass = true;
@@ -268,12 +276,17 @@ bool profile_grouped_gemm_tile_loop_impl(int do_verification,
                 std::cout << "Instance: " << gemm_name << " verification "
                           << (instance_pass ? "SUCCEED" : "FAILED") << std::endl;
 
-                pass = pass && instance_pass;
+                pass         = pass && instance_pass;
+                verification = instance_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
             }
 
+            float ave_time   = 0;
+            float tflops     = 0;
+            float gb_per_sec = 0;
+
             if(time_kernel)
             {
-                float ave_time = invoker_ptr->Run(
+                ave_time = invoker_ptr->Run(
                     argument_ptr.get(), StreamConfig{nullptr, time_kernel, 0, n_warmup, n_iter});
 
                 std::size_t flop = 0, num_btype = 0;
@@ -286,8 +299,8 @@ bool profile_grouped_gemm_tile_loop_impl(int do_verification,
                                  sizeof(CDataType) * Ms[i] * Ns[i];
                 }
 
-                float tflops     = static_cast<float>(flop) / 1.E9 / ave_time;
-                float gb_per_sec = num_btype / 1.E6 / ave_time;
+                tflops     = static_cast<float>(flop) / 1.E9 / ave_time;
+                gb_per_sec = num_btype / 1.E6 / ave_time;
                 std::cout << "Perf: " << std::setw(10) << ave_time << " ms, " << tflops
                           << " TFlops, " << gb_per_sec << " GB/s, " << gemm_name << std::endl;
 
@@ -299,11 +312,17 @@ bool profile_grouped_gemm_tile_loop_impl(int do_verification,
                     best_gb_per_sec = gb_per_sec;
                 }
             }
+
+            ProfilerResultSink::GetInstance().Add(
+                {gemm_name, true, ave_time, tflops, gb_per_sec, verification, problem});
         }
         else
         {
             std::cout << "Instance: " << gemm_name << ", does not support this GEMM problem"
                       << std::endl;
+
+            ProfilerResultSink::GetInstance().Add(
+                {gemm_name, false, 0, 0, 0, VerificationStatus::Skipped, problem});
         }
     }
 
@@ -23,6 +23,8 @@
 #include "ck/library/utility/fill.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -173,6 +175,9 @@ bool profile_grouped_gemm_two_stage_impl(int do_verification,
         throw std::runtime_error("wrong! no device GEMM instance found");
     }
 
+    const std::string problem_sizes = "Ms=" + get_lengths_string(Ms) + " Ns=" +
+                                      get_lengths_string(Ns) + " Ks=" + get_lengths_string(Ks);
+
     std::string best_gemm_name;
     float best_ave_time   = 0;
     float best_tflops     = 0;
@@ -257,6 +262,9 @@ bool profile_grouped_gemm_two_stage_impl(int do_verification,
         {
 
             auto kbatch_curr = kbatch_list[j];
+
+            const std::string problem = problem_sizes + " KBatch=" + std::to_string(kbatch_curr);
+
             dynamic_cast<DeviceOpSplitK*>(gemm_ptr.get())
                 ->SetKBatchSize(argument_ptr.get(), kbatch_curr);
 
@@ -273,6 +281,8 @@ bool profile_grouped_gemm_two_stage_impl(int do_verification,
 
                 invoker_ptr->Run(argument_ptr.get(),
                                  StreamConfig{nullptr, false, 0, n_warmup, n_iter});
+                auto verification = VerificationStatus::Skipped;
+
                 if(do_verification)
                 {
                     bool instance_pass = true;
@@ -313,9 +323,14 @@ bool profile_grouped_gemm_two_stage_impl(int do_verification,
                               << (instance_pass ? "SUCCEED" : "FAILED") << std::endl;
 
                     pass = pass && instance_pass;
+                    verification =
+                        instance_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
                 }
                 float ave_time = invoker_ptr->Run(
                     argument_ptr.get(), StreamConfig{nullptr, time_kernel, 0, n_warmup, n_iter});
+                float tflops     = 0;
+                float gb_per_sec = 0;
+
                 if(time_kernel)
                 {
                     std::size_t flop = 0, num_btype = 0;
@@ -328,9 +343,9 @@ bool profile_grouped_gemm_two_stage_impl(int do_verification,
                                      sizeof(CDataType) * Ms[i] * Ns[i];
                     }
 
-                    float tflops = static_cast<float>(flop) / 1.E9 / ave_time;
+                    tflops = static_cast<float>(flop) / 1.E9 / ave_time;
 
-                    float gb_per_sec = num_btype / 1.E6 / ave_time;
+                    gb_per_sec = num_btype / 1.E6 / ave_time;
                     std::cout << "Perf: " << std::setw(10) << ave_time << " ms, " << tflops
                               << " TFlops, " << gb_per_sec << " GB/s, " << gemm_name << ", KBatch "
                               << kbatch_curr << std::endl;
@@ -344,11 +359,17 @@ bool profile_grouped_gemm_two_stage_impl(int do_verification,
                         best_kbatch     = kbatch_curr;
                     }
                 }
+
+                ProfilerResultSink::GetInstance().Add(
+                    {gemm_name, true, ave_time, tflops, gb_per_sec, verification, problem});
             }
             else
             {
                 std::cout << "Instance: " << gemm_name << ", does not support this GEMM problem"
                           << std::endl;
+
+                ProfilerResultSink::GetInstance().Add(
+                    {gemm_name, false, 0, 0, 0, VerificationStatus::Skipped, problem});
             }
         }
     }
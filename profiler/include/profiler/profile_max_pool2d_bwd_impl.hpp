@@ -16,6 +16,8 @@
 #include "ck/library/reference_tensor_operation/cpu/reference_pool_fwd.hpp"
 #include "ck/library/reference_tensor_operation/cpu/reference_maxpool_bwd.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -156,6 +158,13 @@ bool profile_max_pool2d_bwd_impl(int do_verification,
 
     std::cout << "found " << instance_ptrs.size() << " instances" << std::endl;
 
+    const std::string problem = "input=" + get_lengths_string(in_length) +
+                                " window=" + get_lengths_string(window_spatial_lengths) +
+                                " strides=" + get_lengths_string(window_strides) +
+                                " dilations=" + get_lengths_string(window_dilations) +
+                                " pads=" + get_lengths_string(input_left_pads) + "," +
+                                get_lengths_string(input_right_pads);
+
     std::string best_instance_name;
     float best_avg_time   = std::numeric_limits<float>::max();
     float best_gb_per_sec = 0;
@@ -206,6 +215,9 @@ bool profile_max_pool2d_bwd_impl(int do_verification,
                 LogRange(std::cout << "doutput lengths = ", out_length, ", ") << std::endl;
             }
 
+            ProfilerResultSink::GetInstance().Add(
+                {inst_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
+
             continue;
         }
 
@@ -234,6 +246,8 @@ bool profile_max_pool2d_bwd_impl(int do_verification,
             best_gb_per_sec    = gb_per_sec;
         }
 
+        auto verification = VerificationStatus::Skipped;
+
         if(do_verification)
         {
             din_device_buf.FromDevice(din_n_c_hi_wi_device.mData.data());
@@ -259,6 +273,8 @@ bool profile_max_pool2d_bwd_impl(int do_verification,
                     << std::endl;
             }
 
+            verification = local_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
+
             if(!local_pass)
             {
                 std::cout << inst_ptr->GetTypeString() << " failed verification: ";
@@ -273,6 +289,9 @@ bool profile_max_pool2d_bwd_impl(int do_verification,
                 }
             }
         }
+
+        ProfilerResultSink::GetInstance().Add(
+            {inst_ptr->GetTypeString(), true, avg_time, 0, gb_per_sec, verification, problem});
     }
 
     if(time_kernel)
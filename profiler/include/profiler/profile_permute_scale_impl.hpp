@@ -22,6 +22,8 @@
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -71,6 +73,10 @@ bool profile_permute_scale_impl(int do_verification,
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
+    const std::string problem = "lengths=" + get_lengths_string(lengths_vector) +
+                                " input_strides=" + get_lengths_string(input_strides_vector) +
+                                " output_strides=" + get_lengths_string(output_strides_vector);
+
     std::string best_instance_name;
     float best_ave_time   = std::numeric_limits<float>::max();
     float best_gb_per_sec = 0;
@@ -110,13 +116,18 @@ bool profile_permute_scale_impl(int do_verification,
             b_device_buf.SetZero();
             invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, false});
 
+            auto verification = VerificationStatus::Skipped;
+
             if(do_verification)
             {
                 b_device_buf.FromDevice(b.mData.data());
 
-                pass &= ck::utils::check_err(
+                const bool instance_pass = ck::utils::check_err(
                     b.mData, host_b.mData, "Error: Incorrect results b", 1e-3, 1e-3);
 
+                pass         = pass & instance_pass;
+                verification = instance_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
+
                 if(do_log)
                 {
                     LogRangeAsType<float>(std::cout << "a : ", a.mData, ",") << std::endl;
@@ -149,10 +160,16 @@ bool profile_permute_scale_impl(int do_verification,
                 best_ave_time      = ave_time;
                 best_gb_per_sec    = gb_per_sec;
             }
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_name, true, ave_time, tflops, gb_per_sec, verification, problem});
         }
         else
         {
             std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
         }
     }
     if(time_kernel)
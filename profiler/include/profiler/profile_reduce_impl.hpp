@@ -14,6 +14,8 @@
 #include "ck/library/utility/host_common_util.hpp"
 #include "ck/library/utility/host_tensor_generator.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace tensor_operation {
 namespace device {
@@ -311,6 +313,10 @@ bool profile_reduce_impl_impl(bool do_verification,
         ck::ranges::copy(outLengths, arrOutLengths.begin());
         ck::ranges::copy(outStrides, arrOutStrides.begin());
 
+        const std::string problem =
+            "lengths=" + get_lengths_string(inLengths) + " reduce_dims=" +
+            get_lengths_string(reduceDims);
+
         if(do_verification)
         {
             using ReferenceReduceInstance =
@@ -371,7 +377,16 @@ bool profile_reduce_impl_impl(bool do_verification,
                                                                 acc_elementwise_op);
 
             if(!reduce_ptr->IsSupportedArgument(argument_ptr.get()))
+            {
+                ProfilerResultSink::GetInstance().Add({reduce_ptr->GetTypeString(),
+                                                       false,
+                                                       0,
+                                                       0,
+                                                       0,
+                                                       VerificationStatus::Skipped,
+                                                       problem});
                 continue;
+            }
             else
                 num_kernel++;
 
@@ -398,6 +413,8 @@ bool profile_reduce_impl_impl(bool do_verification,
                 best_gb_per_sec = gb_per_sec;
             }
 
+            auto verification = VerificationStatus::Skipped;
+
             if(do_verification)
             {
                 bool single_pass;
@@ -416,7 +433,8 @@ bool profile_reduce_impl_impl(bool do_verification,
                     std::cout << "Fail Info: " << reduce_ptr->GetTypeString() << std::endl;
                 }
 
-                pass = pass && single_pass;
+                pass         = pass && single_pass;
+                verification = single_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
             };
 
             if(do_dumpout)
@@ -435,6 +453,9 @@ bool profile_reduce_impl_impl(bool do_verification,
                                      out_indices_ref.mDesc.GetElementSize());
                 };
             };
+
+            ProfilerResultSink::GetInstance().Add(
+                {reduce_name, true, avg_time, 0, gb_per_sec, verification, problem});
         };
 
         if(time_kernel && num_kernel > 0)
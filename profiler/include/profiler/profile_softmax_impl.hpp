@@ -20,6 +20,8 @@
 #include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
 #include "ck/utility/data_type.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -120,6 +122,11 @@ bool profile_softmax_impl(int do_verification,
         throw std::runtime_error("wrong! no device normalization instance found");
     }
 
+    const std::string problem = "lengths=" + get_lengths_string(in_length) +
+                                " strides=" + get_lengths_string(in_strides) +
+                                " reduce_dims=" + get_lengths_string(reduce_dims) +
+                                " alpha=" + std::to_string(alpha) + " beta=" + std::to_string(beta);
+
     std::string best_instance_name;
     float best_avg_time   = std::numeric_limits<float>::max();
     float best_gb_per_sec = 0;
@@ -145,19 +152,24 @@ bool profile_softmax_impl(int do_verification,
                 << "scaler = [" << alpha << ", " << beta << "]";
             LogRange(std::cout << ", reduce dims = [", reduce_dims, ", ") << "]." << std::endl;
             instance_pass.push_back(true);
+
+            ProfilerResultSink::GetInstance().Add(
+                {inst_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
+
             continue;
         }
 
         out_dev.ToDevice(prior_out.data());
         auto invoker_ptr = inst_ptr->MakeInvokerPointer();
         float avg_time   = invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, time_kernel});
+        float gb_per_sec = 0;
 
         if(time_kernel)
         {
             std::size_t num_bytes =
                 in.GetElementSize() * sizeof(InDataType) +
                 (beta == 0.0f ? 1 : 2) * out.GetElementSize() * sizeof(OutDataType);
-            float gb_per_sec = num_bytes / 1.E6 / avg_time;
+            gb_per_sec = num_bytes / 1.E6 / avg_time;
 
             std::cout << "Perf: " << std::setw(10) << avg_time << " ms, " << gb_per_sec << " GB/s, "
                       << inst_ptr->GetTypeString() << std::endl;
@@ -170,6 +182,8 @@ bool profile_softmax_impl(int do_verification,
             }
         }
 
+        auto verification = VerificationStatus::Skipped;
+
         if(do_verification)
         {
             out_dev.FromDevice(out.data());
@@ -206,7 +220,12 @@ bool profile_softmax_impl(int do_verification,
                     << "scaler = [" << alpha << ", " << beta << "]." << std::endl;
             }
             instance_pass.push_back(pass);
+
+            verification = pass ? VerificationStatus::Pass : VerificationStatus::Fail;
         }
+
+        ProfilerResultSink::GetInstance().Add(
+            {inst_ptr->GetTypeString(), true, avg_time, 0, gb_per_sec, verification, problem});
     }
     if(time_kernel)
     {
@@ -21,6 +21,8 @@
 #include "ck/library/utility/host_tensor_generator.hpp"
 #include "ck/library/utility/literals.hpp"
 
+#include "profiler/profiler_result_sink.hpp"
+
 namespace ck {
 namespace profiler {
 
@@ -93,6 +95,8 @@ bool profile_transpose_impl(int do_verification,
 
     std::cout << "found " << op_ptrs.size() << " instances" << std::endl;
 
+    const std::string problem = "NCDHW=" + get_lengths_string(ncdhw);
+
     if(do_verification)
     {
         host_elementwise4D(host_b, a, ElementOp{});
@@ -119,13 +123,18 @@ bool profile_transpose_impl(int do_verification,
             // run for verification
             invoker_ptr->Run(argument_ptr.get(), StreamConfig{nullptr, false});
 
+            auto verification = VerificationStatus::Skipped;
+
             if(do_verification)
             {
                 b_device_buf.FromDevice(b.mData.data());
 
-                pass &= ck::utils::check_err(
+                const bool instance_pass = ck::utils::check_err(
                     b.mData, host_b.mData, "Error: Incorrect results b", 1e-3, 1e-3);
 
+                pass         = pass & instance_pass;
+                verification = instance_pass ? VerificationStatus::Pass : VerificationStatus::Fail;
+
                 if(do_log)
                 {
                     LogRangeAsType<float>(std::cout << "a : ", a.mData, ",") << std::endl;
@@ -160,10 +169,16 @@ bool profile_transpose_impl(int do_verification,
                 best_ave_time   = ave_time;
                 best_gb_per_sec = gb_per_sec;
             }
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_name, true, ave_time, tflops, gb_per_sec, verification, problem});
         }
         else
         {
             std::cout << op_ptr->GetTypeString() << " does not support this problem" << std::endl;
+
+            ProfilerResultSink::GetInstance().Add(
+                {op_ptr->GetTypeString(), false, 0, 0, 0, VerificationStatus::Skipped, problem});
         }
     }
 
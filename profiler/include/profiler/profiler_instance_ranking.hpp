@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/host_utility/device_prop.hpp"
+#include "ck/library/tensor_operation_instance/gemm_instance_prefilter.hpp"
+#include "ck/library/tensor_operation_instance/gemm_instance_ranking.hpp"
+
+// profile only the instances the analytic ranking puts first, e.g.
+// export CK_PROFILER_TOP_K=8
+// unset or 0 profiles every instance
+CK_DECLARE_ENV_VAR_UINT64(CK_PROFILER_TOP_K)
+
+namespace ck {
+namespace profiler {
+
+// the ranking device with the architecture, CU count, clock, LDS, waves and memory bandwidth of
+// the current device
+inline ck::tensor_operation::device::instance::GemmRankingDevice get_gemm_ranking_device()
+{
+    ck::tensor_operation::device::instance::GemmRankingDevice device;
+
+    int device_id = 0;
+    hipDeviceProp_t props;
+    if(hipGetDevice(&device_id) == hipSuccess &&
+       hipGetDeviceProperties(&props, device_id) == hipSuccess)
+    {
+        device.arch_             = ck::get_device_name();
+        device.num_cu_           = props.multiProcessorCount;
+        device.clock_mhz_        = props.clockRate / 1000;
+        device.lds_bytes_per_cu_ = static_cast<int>(props.maxSharedMemoryPerMultiProcessor);
+        device.max_waves_per_cu_ = props.maxThreadsPerMultiProcessor / props.warpSize;
+        device.wave_size_        = props.warpSize;
+
+        // the memory clock the runtime reports is a lower bound for HBM3 and GDDR, the
+        // bandwidth of the parts with known memory is taken from the table
+        device.bandwidth_gbs_ =
+            ck::tensor_operation::device::instance::get_gemm_ranking_bandwidth_gbs(device.arch_);
+        if(device.bandwidth_gbs_ <= 0)
+            device.bandwidth_gbs_ = 2. * props.memoryClockRate * props.memoryBusWidth / 8 / 1e6;
+    }
+
+    return device;
+}
+
+// the type the matrix instructions of a GEMM computing in T run in
+template <typename T>
+constexpr ck::tensor_operation::device::instance::GemmRankingComputeType
+get_gemm_ranking_compute_type()
+{
+    using ck::tensor_operation::device::instance::GemmRankingComputeType;
+
+    if constexpr(is_same_v<T, double>)
+        return GemmRankingComputeType::F64;
+    else if constexpr(is_same_v<T, float>)
+        return GemmRankingComputeType::F32;
+    else if constexpr(is_same_v<T, bhalf_t>)
+        return GemmRankingComputeType::BF16;
+    else if constexpr(is_same_v<T, f8_t> || is_same_v<T, bf8_t>)
+        return GemmRankingComputeType::F8;
+    else if constexpr(is_same_v<T, int8_t>)
+        return GemmRankingComputeType::I8;
+    else
+        return GemmRankingComputeType::F16;
+}
+
+// The instances of a GEMM factory to profile: all of them, or with $CK_PROFILER_TOP_K set only
+// the top k of the analytic ranking for the problem, fastest estimate first. Only instances
+// that pass the prefilter are ranked. tuned_instance_id is the GetInstanceId() of the instance
+// the tuning database recorded for the problem, if any; it is profiled first even if the ranking
+// leaves it out. It is resolved through the registry of the factory, which constructs no
+// instance.
+template <typename DeviceOpFactory,
+          typename ADataType,
+          typename BDataType,
+          typename CDataType,
+          typename ComputeDataType = ADataType>
+auto get_gemm_instances_to_profile(int M, int N, int K, const std::string& tuned_instance_id = "")
+{
+    const auto& catalog = DeviceOpFactory::GetCatalog();
+
+    const auto top_k = ck::EnvValue(CK_ENV(CK_PROFILER_TOP_K));
+    if(top_k == 0)
+        return catalog.MakeInstances();
+
+    // KBatch 1 passes every instance that any KBatch does
+    ck::tensor_operation::device::instance::GemmPrefilterProblem prefilter_problem;
+    prefilter_problem.M_             = M;
+    prefilter_problem.N_             = N;
+    prefilter_problem.K_             = K;
+    prefilter_problem.xdl_supported_ = ck::is_xdl_supported();
+
+    const auto& candidates = DeviceOpFactory::GetPrefilter().GetCandidates(prefilter_problem);
+
+    ck::tensor_operation::device::instance::GemmRankingProblem problem;
+    problem.M_               = M;
+    problem.N_               = N;
+    problem.K_               = K;
+    problem.a_element_bytes_ = sizeof(ADataType);
+    problem.b_element_bytes_ = sizeof(BDataType);
+    problem.c_element_bytes_ = sizeof(CDataType);
+    problem.compute_type_    = get_gemm_ranking_compute_type<ComputeDataType>();
+
+    std::vector<ck::tensor_operation::device::DeviceGemmInstanceDescriptor> descs;
+    for(const std::size_t i : candidates)
+        descs.push_back(catalog.GetDescriptor(i));
+
+    const auto ranked = ck::tensor_operation::device::instance::rank_gemm_instances(
+        descs, problem, get_gemm_ranking_device(), top_k);
+
+    std::vector<std::size_t> indices;
+    for(const auto& e : ranked)
+        indices.push_back(candidates[e.index_]);
+
+    if(const auto tuned = DeviceOpFactory::GetRegistry().FindInstance(tuned_instance_id))
+    {
+        indices.erase(std::remove(indices.begin(), indices.end(), *tuned), indices.end());
+        indices.insert(indices.begin(), *tuned);
+    }
+
+    std::cout << "profiling the top " << indices.size() << " of " << catalog.GetNumInstance()
+              << " instances by estimated time" << std::endl;
+
+    return catalog.MakeInstances(indices);
+}
+
+} // namespace profiler
+} // namespace ck
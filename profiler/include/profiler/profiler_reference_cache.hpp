@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <string>
+
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/reference_cache.hpp"
+#include "ck/library/utility/tuning_db.hpp"
+
+namespace ck {
+namespace profiler {
+
+// Fill host_result with f_reference() unless the reference cache in $CK_REFERENCE_CACHE holds
+// the result of the key returned by f_key(), and cache what was computed. The key, which hashes
+// the input tensors, is only built when the cache is enabled.
+template <typename T, typename KeyFunction, typename ReferenceFunction>
+void run_reference_cached(Tensor<T>& host_result,
+                          KeyFunction&& f_key,
+                          ReferenceFunction&& f_reference)
+{
+    const auto cache = ck::utils::ReferenceCache::FromEnvironment();
+
+    if(!cache)
+    {
+        f_reference();
+        return;
+    }
+
+    const ck::utils::ReferenceCacheKey key = f_key();
+    const std::string digest               = key.GetDigest();
+
+    if(cache->Load(digest, host_result))
+    {
+        std::cout << "reference result loaded from cache: " << digest << std::endl;
+        return;
+    }
+
+    f_reference();
+
+    if(!cache->Store(digest, host_result))
+    {
+        std::cerr << "cannot write the reference cache " << cache->GetDirectory() << std::endl;
+    }
+}
+
+} // namespace profiler
+} // namespace ck
@@ -0,0 +1,368 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace ck {
+namespace profiler {
+
+enum struct VerificationStatus
+{
+    Skipped, // verification was not requested
+    Pass,
+    Fail,
+};
+
+inline const char* to_string(VerificationStatus status)
+{
+    switch(status)
+    {
+    case VerificationStatus::Pass: return "pass";
+    case VerificationStatus::Fail: return "fail";
+    default: return "skipped";
+    }
+}
+
+// one profiled instance
+struct ProfilerResult
+{
+    std::string instance_; // GetTypeString() of the device op
+    bool supported_                  = false;
+    float ave_time_                  = 0; // ms
+    float tflops_                    = 0;
+    float gb_per_sec_                = 0;
+    VerificationStatus verification_ = VerificationStatus::Skipped;
+    std::string problem_; // e.g. "M=256 N=256 K=64 StrideA=64 StrideB=256 StrideC=256"
+    std::string instance_id_; // GetInstanceId() of the device op, empty if it has none
+};
+
+// lengths joined by x for the problem of a record, e.g. "28x28"
+template <typename Lengths>
+std::string get_lengths_string(const Lengths& lengths)
+{
+    std::string s;
+    for(std::size_t i = 0; i < lengths.size(); ++i)
+        s += (i == 0 ? "" : "x") + std::to_string(lengths[i]);
+    return s;
+}
+
+// one line description of a ck::utils::conv::ConvParam, e.g.
+//   "G=32 N=128 K=192 C=192 filter=3x3 input=28x28 strides=1x1 dilations=1x1 pads=1x1,1x1"
+template <typename ConvParam>
+std::string get_conv_problem_string(const ConvParam& p)
+{
+    return "G=" + std::to_string(p.G_) + " N=" + std::to_string(p.N_) +
+           " K=" + std::to_string(p.K_) + " C=" + std::to_string(p.C_) +
+           " filter=" + get_lengths_string(p.filter_spatial_lengths_) +
+           " input=" + get_lengths_string(p.input_spatial_lengths_) +
+           " strides=" + get_lengths_string(p.conv_filter_strides_) +
+           " dilations=" + get_lengths_string(p.conv_filter_dilations_) +
+           " pads=" + get_lengths_string(p.input_left_pads_) + "," +
+           get_lengths_string(p.input_right_pads_);
+}
+
+// Machine readable output of ckProfiler, selected with
+//   --output-format json|csv    (default: inferred from the file extension, else json)
+//   --output-file <path>        (default: stderr, so it does not mix with the normal output)
+//
+// Results are appended, so repeated ckProfiler invocations can share one file: json writes one
+// object per invocation and line (JSON Lines), csv writes one row per instance and a header only
+// into a new or empty file. Every invocation is recorded with its operation, arguments and exit
+// code.
+//
+// Every profiler impl Add()s one record per instance it tries, with its timing, verification
+// result and problem.
+class ProfilerResultSink final
+{
+    ProfilerResultSink()  = default;
+    ~ProfilerResultSink() = default;
+
+    public:
+    enum struct Format
+    {
+        None,
+        Json,
+        Csv,
+    };
+
+    static ProfilerResultSink& GetInstance()
+    {
+        static ProfilerResultSink sink;
+        return sink;
+    }
+
+    // consume the sink options from argv[1...] and compact the rest, so that the operations keep
+    // parsing their positional arguments unchanged; false on malformed options
+    bool ParseArguments(int& argc, char* argv[])
+    {
+        int num_kept = 1;
+
+        for(int i = 1; i < argc; ++i)
+        {
+            const std::string_view arg = argv[i];
+
+            std::string_view key = arg;
+            std::string_view value;
+            bool has_value = false;
+
+            if(const auto eq = arg.find('='); arg.substr(0, 2) == "--" && eq != arg.npos)
+            {
+                key       = arg.substr(0, eq);
+                value     = arg.substr(eq + 1);
+                has_value = true;
+            }
+
+            if(key != "--output-format" && key != "--output-file")
+            {
+                argv[num_kept++] = argv[i];
+                continue;
+            }
+
+            if(!has_value)
+            {
+                if(i + 1 == argc)
+                {
+                    std::cerr << "missing value for " << key << std::endl;
+                    return false;
+                }
+
+                value = argv[++i];
+            }
+
+            if(key == "--output-file")
+            {
+                file_ = value;
+            }
+            else if(value == "json")
+            {
+                format_ = Format::Json;
+            }
+            else if(value == "csv")
+            {
+                format_ = Format::Csv;
+            }
+            else
+            {
+                std::cerr << "unknown output format: " << value << " (expected json or csv)"
+                          << std::endl;
+                return false;
+            }
+        }
+
+        argc       = num_kept;
+        argv[argc] = nullptr;
+
+        if(format_ == Format::None && !file_.empty())
+        {
+            const bool is_csv =
+                file_.size() >= 4 && file_.compare(file_.size() - 4, 4, ".csv") == 0;
+
+            format_ = is_csv ? Format::Csv : Format::Json;
+        }
+
+        return true;
+    }
+
+    bool IsEnabled() const { return format_ != Format::None; }
+
+    void SetOperation(std::string operation, std::string arguments)
+    {
+        operation_ = std::move(operation);
+        arguments_ = std::move(arguments);
+    }
+
+    void Add(ProfilerResult result)
+    {
+        if(IsEnabled())
+            results_.push_back(std::move(result));
+    }
+
+    // write the results of this invocation; false if the output file cannot be written
+    bool Flush(int exit_code)
+    {
+        if(!IsEnabled())
+            return true;
+
+        std::ostringstream os;
+        os << std::setprecision(9);
+
+        if(format_ == Format::Json)
+            WriteJson(os, exit_code);
+        else
+            WriteCsv(os, exit_code, file_.empty() || IsEmptyFile(file_));
+
+        results_.clear();
+
+        // the whole invocation goes out in a single append, so concurrent profiler runs writing
+        // to the same file do not interleave their records
+        const std::string text = os.str();
+
+        if(file_.empty())
+        {
+            std::cerr << text << std::flush;
+            return true;
+        }
+
+        std::ofstream file(file_, std::ios::out | std::ios::app | std::ios::binary);
+        file.write(text.data(), static_cast<std::streamsize>(text.size()));
+        file.flush();
+
+        if(!file)
+        {
+            std::cerr << "cannot write profiler results to " << file_ << std::endl;
+            return false;
+        }
+
+        return true;
+    }
+
+    private:
+    static bool IsEmptyFile(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+        return !file || file.tellg() <= 0;
+    }
+
+    static void WriteJsonString(std::ostream& os, std::string_view s)
+    {
+        os << '"';
+        for(const char c : s)
+        {
+            switch(c)
+            {
+            case '"': os << "\\\""; break;
+            case '\\': os << "\\\\"; break;
+            case '\n': os << "\\n"; break;
+            case '\t': os << "\\t"; break;
+            default:
+                if(static_cast<unsigned char>(c) < 0x20)
+                {
+                    char buf[8];
+                    std::snprintf(buf, sizeof(buf), "\\u%04x", static_cast<unsigned>(c));
+                    os << buf;
+                }
+                else
+                {
+                    os << c;
+                }
+            }
+        }
+        os << '"';
+    }
+
+    // JSON has no inf/nan, e.g. the TFlops of an untimed run
+    static void WriteJsonNumber(std::ostream& os, float x)
+    {
+        if(std::isfinite(x))
+            os << x;
+        else
+            os << "null";
+    }
+
+    void WriteJson(std::ostream& os, int exit_code) const
+    {
+        os << "{\"operation\": ";
+        WriteJsonString(os, operation_);
+        os << ", \"arguments\": ";
+        WriteJsonString(os, arguments_);
+        os << ", \"exit_code\": " << exit_code << ", \"results\": [";
+
+        for(std::size_t i = 0; i < results_.size(); ++i)
+        {
+            const auto& r = results_[i];
+
+            os << (i == 0 ? "" : ", ") << "{\"instance\": ";
+            WriteJsonString(os, r.instance_);
+            os << ", \"instance_id\": ";
+            WriteJsonString(os, r.instance_id_);
+            os << ", \"supported\": " << (r.supported_ ? "true" : "false") << ", \"time_ms\": ";
+            WriteJsonNumber(os, r.ave_time_);
+            os << ", \"tflops\": ";
+            WriteJsonNumber(os, r.tflops_);
+            os << ", \"gb_per_sec\": ";
+            WriteJsonNumber(os, r.gb_per_sec_);
+            os << ", \"verification\": \"" << to_string(r.verification_) << "\", \"problem\": ";
+            WriteJsonString(os, r.problem_);
+            os << "}";
+        }
+
+        os << "]}\n";
+    }
+
+    // instance type strings contain commas, so every text field is quoted
+    static void WriteCsvString(std::ostream& os, std::string_view s)
+    {
+        os << '"';
+        for(const char c : s)
+        {
+            if(c == '"')
+                os << '"';
+            os << c;
+        }
+        os << '"';
+    }
+
+    static void WriteCsvNumber(std::ostream& os, float x)
+    {
+        if(std::isfinite(x))
+            os << x;
+    }
+
+    void WriteCsv(std::ostream& os, int exit_code, bool write_header) const
+    {
+        if(write_header)
+            os << "operation,arguments,exit_code,instance,instance_id,supported,time_ms,tflops,"
+                  "gb_per_sec,verification,problem\n";
+
+        auto write_prefix = [&] {
+            WriteCsvString(os, operation_);
+            os << ',';
+            WriteCsvString(os, arguments_);
+            os << ',' << exit_code << ',';
+        };
+
+        // an operation without instance records still leaves a row with its exit code
+        if(results_.empty())
+        {
+            write_prefix();
+            os << ",,,,,,,\n";
+        }
+
+        for(const auto& r : results_)
+        {
+            write_prefix();
+            WriteCsvString(os, r.instance_);
+            os << ',';
+            WriteCsvString(os, r.instance_id_);
+            os << ',' << (r.supported_ ? 1 : 0) << ',';
+            WriteCsvNumber(os, r.ave_time_);
+            os << ',';
+            WriteCsvNumber(os, r.tflops_);
+            os << ',';
+            WriteCsvNumber(os, r.gb_per_sec_);
+            os << ',' << to_string(r.verification_) << ',';
+            WriteCsvString(os, r.problem_);
+            os << '\n';
+        }
+    }
+
+    Format format_ = Format::None;
+    std::string file_;
+    std::string operation_;
+    std::string arguments_;
+    std::vector<ProfilerResult> results_;
+};
+
+} // namespace profiler
+} // namespace ck
@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/stream_config.hpp"
+#include "ck/tensor_operation/gpu/device/device_base.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/check_err_streamed.hpp"
+#include "ck/library/utility/device_memory.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+#include "profiler/profiler_result_sink.hpp"
+
+namespace ck {
+namespace profiler {
+
+// Verification of the profiled instances against a host reference computed slab by slab, for
+// do_verification 2: neither the device results nor the reference are held in host memory in
+// full, see ck::utils::check_err_streamed_reports().
+//
+// The instances all write to one device buffer and are timed first. Every profiled instance is
+// added with its record and, if it is verified, its argument and invoker. Verify() then computes
+// every slab of the reference once and compares it against the slab of each instance, which is
+// run again into the zeroed buffer when its result is not the one there, and adds the records in
+// the order they were added with their verification status to the ProfilerResultSink.
+//
+// With S slabs and N verified instances that is N * S runs of the instances, one per slab read,
+// against S slabs of the reference. A run is one kernel, far cheaper than a slab of the host
+// reference, and C fits into one slab for most problems, i.e. S is 1. The reads are serialized,
+// see check_err_streamed_reports(), so a run never overwrites a result still being read.
+template <typename CDataType>
+class StreamedVerification
+{
+    public:
+    StreamedVerification(const HostTensorDescriptor& c_desc, DeviceMem& c_device_buf)
+        : c_desc_(c_desc), c_device_buf_(c_device_buf)
+    {
+    }
+
+    // an instance that is not verified, e.g. one that does not support the problem
+    void Add(ProfilerResult result) { records_.push_back(std::move(result)); }
+
+    // an instance whose result is verified
+    void Add(ProfilerResult result,
+             std::unique_ptr<tensor_operation::device::BaseArgument> argument,
+             std::unique_ptr<tensor_operation::device::BaseInvoker> invoker)
+    {
+        instances_.push_back({records_.size(), std::move(argument), std::move(invoker)});
+        records_.push_back(std::move(result));
+    }
+
+    // compute_reference(ref, dim, begin, end) as for check_err_streamed_reports(); true if every
+    // verified instance passes
+    template <typename ComputeReference>
+    bool Verify(ComputeReference&& compute_reference,
+                double rtol = ck::utils::detail::default_check_err_rtol_v<CDataType>,
+                double atol = ck::utils::detail::default_check_err_atol_v<CDataType>)
+    {
+        auto read_device = [&](std::size_t i, CDataType* p, std::size_t offset, std::size_t count) {
+            if(i != resident_)
+            {
+                // re-init C to zero, split-K instances accumulate into it
+                c_device_buf_.SetZero();
+
+                instances_[i].invoker_->Run(instances_[i].argument_.get(),
+                                            StreamConfig{nullptr, false});
+
+                resident_ = i;
+            }
+
+            c_device_buf_.FromDevice(p, count * sizeof(CDataType), offset * sizeof(CDataType));
+        };
+
+        const auto reports = ck::utils::check_err_streamed_reports<CDataType>(
+            c_desc_, instances_.size(), read_device, compute_reference, rtol, atol);
+
+        bool pass = true;
+
+        for(std::size_t i = 0; i < instances_.size(); ++i)
+        {
+            auto& record = records_[instances_[i].record_];
+
+            reports[i].Print(std::cerr, "Error: Incorrect results of " + record.instance_ + "!");
+
+            record.verification_ =
+                reports[i].IsPass() ? VerificationStatus::Pass : VerificationStatus::Fail;
+
+            pass = pass && reports[i].IsPass();
+        }
+
+        for(auto& record : records_)
+            ProfilerResultSink::GetInstance().Add(std::move(record));
+
+        records_.clear();
+        instances_.clear();
+        resident_ = kNoInstance;
+
+        return pass;
+    }
+
+    private:
+    struct Instance
+    {
+        std::size_t record_;
+        std::unique_ptr<tensor_operation::device::BaseArgument> argument_;
+        std::unique_ptr<tensor_operation::device::BaseInvoker> invoker_;
+    };
+
+    HostTensorDescriptor c_desc_;
+    DeviceMem& c_device_buf_;
+
+    std::vector<ProfilerResult> records_;
+    std::vector<Instance> instances_;
+
+    // instance whose result is in the device buffer; none after the timed runs, which leave the
+    // sum of all iterations in it for split-K instances
+    static constexpr std::size_t kNoInstance = std::numeric_limits<std::size_t>::max();
+
+    std::size_t resident_ = kNoInstance;
+};
+
+} // namespace profiler
+} // namespace ck
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <iostream>
+#include <optional>
+#include <string>
+
+#include "ck/host_utility/device_prop.hpp"
+#include "ck/library/utility/tuning_db.hpp"
+
+namespace ck {
+namespace profiler {
+
+// the tuning database at $CK_TUNING_DB, if set; its index is loaded once per process
+inline const std::optional<ck::utils::TuningDb>& get_tuning_db()
+{
+    static const auto db = ck::utils::TuningDb::FromEnvironment();
+    return db;
+}
+
+// the fastest instance the tuning database recorded for the problem on the current device
+inline std::optional<ck::utils::TuningRecord> find_tuning_record(const std::string& op,
+                                                                 const std::string& layouts,
+                                                                 const std::string& data_types,
+                                                                 const std::string& problem)
+{
+    const auto& db = get_tuning_db();
+
+    if(!db)
+        return std::nullopt;
+
+    return db->Lookup({op, layouts, data_types, problem, ck::get_device_name()});
+}
+
+// Remember the best instance of a sweep in the tuning database at $CK_TUNING_DB, keyed by the
+// ckProfiler operation name, layouts, data types, problem and device. The instance is stored
+// by its GetInstanceId(), which resolves it in later builds, and its GetTypeString(). Sweeps
+// that were not timed, found no supported instance or failed verification are not recorded.
+inline void add_tuning_record(const std::string& op,
+                              const std::string& layouts,
+                              const std::string& data_types,
+                              const std::string& problem,
+                              const std::string& instance_id,
+                              const std::string& instance,
+                              int split_k,
+                              float ave_time,
+                              float tflops,
+                              bool time_kernel,
+                              bool pass)
+{
+    const auto& db = get_tuning_db();
+
+    if(!db || !time_kernel || !pass || instance.empty() || !(ave_time > 0))
+        return;
+
+    const ck::utils::TuningKey key{op, layouts, data_types, problem, ck::get_device_name()};
+
+    if(!db->Add({key, instance_id, instance, split_k, ave_time, tflops}))
+    {
+        std::cerr << "cannot write the tuning database " << db->GetPath() << std::endl;
+    }
+}
+
+} // namespace profiler
+} // namespace ck
@@ -9,22 +9,19 @@
 static void print_helper_message()
 {
     std::cout << "arg1: tensor operation " << ProfilerOperationRegistry::GetInstance() << std::endl;
+    std::cout << "options (anywhere after arg1):\n"
+              << "\t--output-format json|csv: write the results in a machine readable format\n"
+              << "\t--output-file <path>: append the results to <path> instead of stderr"
+              << std::endl;
 }
 
 int main(int argc, char* argv[])
 {
-    if(argc == 1)
+    if(const auto result = ProfilerOperationRegistry::GetInstance().Run(argc, argv);
+       result.has_value())
     {
-        print_helper_message();
-    }
-    else if(const auto operation = ProfilerOperationRegistry::GetInstance().Get(argv[1]);
-            operation.has_value())
-    {
-        return (*operation)(argc, argv);
-    }
-    else
-    {
-        std::cerr << "cannot find operation: " << argv[1] << std::endl;
-        return EXIT_FAILURE;
+        return *result;
     }
+
+    print_helper_message();
 }
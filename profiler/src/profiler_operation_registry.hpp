@@ -1,14 +1,18 @@
 // SPDX-License-Identifier: MIT
 // Copyright (c) 2018-2023, Advanced Micro Devices, Inc. All rights reserved.
 
+#include <cstdlib>
 #include <functional>
 #include <iostream>
 #include <iterator>
 #include <map>
 #include <optional>
+#include <string>
 #include <string_view>
 #include <utility>
 
+#include "profiler/profiler_result_sink.hpp"
+
 class ProfilerOperationRegistry final
 {
     ProfilerOperationRegistry()  = default;
@@ -61,6 +65,42 @@ class ProfilerOperationRegistry final
         return (found->second).operation_;
     }
 
+    // Run the operation named by argv[1]. The result sink options are removed from argv first,
+    // and the instances the operation profiles are recorded in the sink. The exit code of the
+    // operation; nullopt if argv names no operation.
+    std::optional<int> Run(int argc, char* argv[]) const
+    {
+        auto& sink = ck::profiler::ProfilerResultSink::GetInstance();
+
+        if(!sink.ParseArguments(argc, argv))
+        {
+            return EXIT_FAILURE;
+        }
+
+        if(argc == 1)
+        {
+            return std::nullopt;
+        }
+
+        const auto operation = Get(argv[1]);
+        if(!operation.has_value())
+        {
+            std::cerr << "cannot find operation: " << argv[1] << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        std::string arguments;
+        for(int i = 2; i < argc; ++i)
+        {
+            arguments += (i == 2 ? "" : " ") + std::string(argv[i]);
+        }
+        sink.SetOperation(argv[1], arguments);
+
+        const int result = (*operation)(argc, argv);
+
+        return sink.Flush(result) ? result : EXIT_FAILURE;
+    }
+
     bool Add(std::string_view name, std::string_view description, Operation operation)
     {
         return entries_
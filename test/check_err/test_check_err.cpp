@@ -0,0 +1,194 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <list>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+using ck::utils::check_err;
+using ck::utils::check_err_report;
+using ck::utils::CheckErrReport;
+
+TEST(CheckErr, EqualRangesPass)
+{
+    std::vector<float> out(100000);
+    for(std::size_t i = 0; i < out.size(); ++i)
+        out[i] = static_cast<float>(i) * 0.25f;
+
+    const auto report = check_err_report(out, out);
+
+    EXPECT_TRUE(report.IsPass());
+    EXPECT_EQ(report.num_error_, 0);
+    EXPECT_EQ(report.max_ulp_, 0);
+    EXPECT_EQ(report.ulp_histogram_[0], out.size());
+    EXPECT_TRUE(check_err(out, out));
+}
+
+TEST(CheckErr, SizeMismatchFails)
+{
+    EXPECT_FALSE(check_err(std::vector<float>(3), std::vector<float>(4)));
+}
+
+TEST(CheckErr, UlpDistance)
+{
+    std::vector<float> ref{1.f, -1.f, 0.f, 2.f};
+    std::vector<float> out(ref);
+
+    out[0] = std::nextafter(out[0], 2.f);
+    out[1] = std::nextafter(std::nextafter(out[1], 0.f), 0.f);
+    out[2] = -0.f;
+
+    const auto report = check_err_report(out, ref);
+
+    EXPECT_TRUE(report.IsPass());
+    EXPECT_EQ(report.max_ulp_, 2);
+    EXPECT_EQ(report.ulp_histogram_[0], 2);
+    EXPECT_EQ(report.ulp_histogram_[1], 1);
+    EXPECT_EQ(report.ulp_histogram_[2], 1);
+}
+
+TEST(CheckErr, MismatchesAndWorstOffender)
+{
+    std::vector<float> ref(1000, 1.f);
+    std::vector<float> out(ref);
+
+    out[10]  = 1.5f;
+    out[500] = 3.f;
+    out[900] = std::numeric_limits<float>::quiet_NaN();
+
+    const auto report = check_err_report(out, ref, 1e-5, 3e-6, 64);
+
+    EXPECT_FALSE(report.IsPass());
+    EXPECT_EQ(report.num_error_, 3);
+    EXPECT_EQ(report.num_nonfinite_, 1);
+    EXPECT_EQ(report.max_err_, 2.);
+    ASSERT_EQ(report.mismatches_.size(), 3);
+    EXPECT_EQ(report.mismatches_[0].index_, 10);
+    EXPECT_EQ(report.mismatches_[1].index_, 500);
+    EXPECT_EQ(report.mismatches_[2].index_, 900);
+
+    // non-finite values rank above any finite error
+    ASSERT_TRUE(report.has_worst_);
+    EXPECT_EQ(report.worst_.index_, 900);
+
+    ASSERT_EQ(report.tile_errors_.size(), 3);
+    EXPECT_EQ(report.tile_errors_[0].tile_, 0);
+    EXPECT_EQ(report.tile_errors_[1].tile_, 7);
+    EXPECT_EQ(report.tile_errors_[2].tile_, 14);
+    EXPECT_EQ(report.ulp_histogram_[CheckErrReport::kNumUlpBucket - 1], 1);
+
+    ASSERT_EQ(report.tile_ulp_histograms_.size(), 16);
+    EXPECT_EQ(report.tile_ulp_histograms_[7][0], 63);
+    EXPECT_EQ(report.tile_ulp_histograms_[14][CheckErrReport::kNumUlpBucket - 1], 1);
+    EXPECT_EQ(report.tile_ulp_histograms_[15][0], 1000 - 15 * 64);
+
+    EXPECT_FALSE(check_err(out, ref));
+}
+
+TEST(CheckErr, NonRandomAccessRanges)
+{
+    std::vector<float> ref(1000);
+    for(std::size_t i = 0; i < ref.size(); ++i)
+        ref[i] = static_cast<float>(i);
+
+    std::vector<float> out(ref);
+    out[10]  = 1.5f;
+    out[900] = std::numeric_limits<float>::quiet_NaN();
+
+    const std::list<float> out_list(out.begin(), out.end());
+    const std::list<float> ref_list(ref.begin(), ref.end());
+
+    const auto expected = check_err_report(out, ref, 1e-5, 3e-6, 64);
+    const auto report   = check_err_report(out_list, ref_list, 1e-5, 3e-6, 64);
+
+    EXPECT_EQ(report.num_error_, expected.num_error_);
+    EXPECT_EQ(report.max_err_, expected.max_err_);
+    EXPECT_EQ(report.ulp_histogram_, expected.ulp_histogram_);
+    EXPECT_EQ(report.tile_ulp_histograms_, expected.tile_ulp_histograms_);
+    ASSERT_EQ(report.mismatches_.size(), 2);
+    EXPECT_EQ(report.mismatches_[0].index_, 10);
+    EXPECT_EQ(report.mismatches_[1].index_, 900);
+    EXPECT_EQ(report.worst_.index_, 900);
+
+    EXPECT_TRUE(check_err(ref_list, ref_list));
+}
+
+TEST(CheckErr, ReportIndependentOfTileSize)
+{
+    std::vector<double> ref(10007);
+    for(std::size_t i = 0; i < ref.size(); ++i)
+        ref[i] = std::sin(static_cast<double>(i));
+
+    std::vector<double> out(ref);
+    for(std::size_t i = 0; i < out.size(); i += 13)
+        out[i] = std::nextafter(out[i], 2.);
+    for(std::size_t i = 5; i < out.size(); i += 997)
+        out[i] += 1e-3 * static_cast<double>(i % 7);
+
+    const auto expected = check_err_report(out, ref, 1e-5, 3e-6, 1);
+
+    for(std::size_t tile_size : {7, 64, 1000, 1 << 16})
+    {
+        const auto report = check_err_report(out, ref, 1e-5, 3e-6, tile_size);
+
+        EXPECT_EQ(report.num_error_, expected.num_error_);
+        EXPECT_EQ(report.max_err_, expected.max_err_);
+        EXPECT_EQ(report.max_abs_err_, expected.max_abs_err_);
+        EXPECT_EQ(report.max_rel_err_, expected.max_rel_err_);
+        EXPECT_EQ(report.max_ulp_, expected.max_ulp_);
+        EXPECT_EQ(report.ulp_histogram_, expected.ulp_histogram_);
+        EXPECT_EQ(report.worst_.index_, expected.worst_.index_);
+    }
+}
+
+TEST(CheckErr, TensorWorstCoordinate)
+{
+    // column-major strides, the element offset differs from the row-major linear index
+    Tensor<float> out(std::vector<std::size_t>{4, 5, 6}, std::vector<std::size_t>{1, 4, 20});
+    Tensor<float> ref(out.mDesc);
+
+    out(2, 3, 4) = -5.f;
+
+    const auto report = check_err_report(out, ref);
+
+    EXPECT_EQ(report.worst_.index_, out.mDesc.GetOffsetFromMultiIndex(2, 3, 4));
+    EXPECT_EQ(report.worst_coordinate_, (std::vector<std::size_t>{2, 3, 4}));
+}
+
+TEST(CheckErr, Integral)
+{
+    std::vector<int32_t> ref(100, 3);
+    std::vector<int32_t> out(ref);
+
+    out[10] = 7;
+
+    EXPECT_TRUE(check_err(out, ref, "", 0, 4));
+    EXPECT_FALSE(check_err(out, ref));
+
+    const auto report = check_err_report(out, ref, 0, 0);
+
+    EXPECT_EQ(report.max_ulp_, 4);
+    EXPECT_EQ(report.worst_.index_, 10);
+}
+
+TEST(CheckErr, Half)
+{
+    std::vector<ck::half_t> ref(64, ck::type_convert<ck::half_t>(1.f));
+    std::vector<ck::half_t> out(ref);
+
+    out[3] = ck::type_convert<ck::half_t>(-1.f);
+
+    const auto report = check_err_report(out, ref, 1e-3, 1e-3);
+
+    EXPECT_EQ(report.num_error_, 1);
+    // 0x3c00 and 0xbc00 lie 2 * 0x3c00 ulp apart across zero
+    EXPECT_EQ(report.max_ulp_, 2 * 0x3c00);
+}
@@ -0,0 +1,223 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/check_err_streamed.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_view.hpp"
+
+using ck::utils::check_err_report;
+using ck::utils::check_err_streamed;
+using ck::utils::check_err_streamed_report;
+using ck::utils::check_err_streamed_reports;
+
+namespace {
+
+float value_at(std::size_t m, std::size_t n) { return static_cast<float>(m * 1000 + n) * 0.5f; }
+
+// column-major M x N result with padded columns, standing in for a device buffer
+struct StreamedProblem
+{
+    static constexpr std::size_t M = 37, N = 29, LD = 40;
+
+    StreamedProblem() : desc({M, N}, {std::size_t{1}, LD}), device(desc)
+    {
+        for(std::size_t m = 0; m < M; ++m)
+            for(std::size_t n = 0; n < N; ++n)
+                device(m, n) = value_at(m, n);
+    }
+
+    // records the largest read, which bounds the host memory of a slab
+    auto get_read_device()
+    {
+        return [this](float* p, std::size_t offset, std::size_t count) {
+            ASSERT_LE(offset + count, device.mData.size());
+            std::memcpy(p, device.mData.data() + offset, count * sizeof(float));
+            max_read = std::max(max_read, count);
+            ++num_read;
+        };
+    }
+
+    auto get_compute_reference()
+    {
+        return [this](TensorView<float> ref, std::size_t dim, std::size_t begin, std::size_t end) {
+            EXPECT_EQ(dim, 1);
+            ++num_reference;
+            EXPECT_EQ(ref.GetLengths()[1], end - begin);
+            for(std::size_t m = 0; m < M; ++m)
+                for(std::size_t n = begin; n < end; ++n)
+                    ref(m, n - begin) = value_at(m, n);
+        };
+    }
+
+    HostTensorDescriptor desc;
+    Tensor<float> device;
+
+    std::size_t max_read = 0;
+    std::size_t num_read      = 0;
+    std::size_t num_reference = 0;
+};
+
+} // namespace
+
+TEST(CheckErrStreamed, PassesInBoundedSlabs)
+{
+    StreamedProblem problem;
+
+    // room for four padded columns per slab
+    const std::size_t slab_bytes = 4 * StreamedProblem::LD * sizeof(float);
+
+    EXPECT_TRUE(check_err_streamed<float>(problem.desc,
+                                          problem.get_read_device(),
+                                          problem.get_compute_reference(),
+                                          "Error: Incorrect results!",
+                                          slab_bytes));
+
+    EXPECT_EQ(problem.num_read, (StreamedProblem::N + 3) / 4);
+    EXPECT_LE(problem.max_read * sizeof(float), slab_bytes);
+}
+
+TEST(CheckErrStreamed, MatchesFullReport)
+{
+    StreamedProblem problem;
+
+    Tensor<float> ref(problem.desc);
+    for(std::size_t m = 0; m < StreamedProblem::M; ++m)
+        for(std::size_t n = 0; n < StreamedProblem::N; ++n)
+            ref(m, n) = value_at(m, n);
+
+    problem.device(3, 20) += 1.f;
+    problem.device(30, 2) = std::numeric_limits<float>::quiet_NaN();
+    problem.device(5, 11) += 0.25f;
+
+    const auto report =
+        check_err_streamed_report<float>(problem.desc,
+                                         problem.get_read_device(),
+                                         problem.get_compute_reference(),
+                                         1e-5,
+                                         3e-6,
+                                         3 * StreamedProblem::LD * sizeof(float));
+
+    // the full comparison in the order of the slabs: columns outermost
+    const std::vector<std::size_t> new2old{1, 0};
+    const auto full = check_err_report(make_tensor_view(problem.device).Permute(new2old),
+                                       make_tensor_view(ref).Permute(new2old));
+
+    EXPECT_FALSE(report.IsPass());
+    EXPECT_EQ(report.size_, full.size_);
+    EXPECT_EQ(report.num_error_, 3);
+    EXPECT_EQ(report.num_nonfinite_, 1);
+    EXPECT_EQ(report.max_err_, full.max_err_);
+    EXPECT_EQ(report.max_ulp_, full.max_ulp_);
+    EXPECT_EQ(report.ulp_histogram_, full.ulp_histogram_);
+
+    ASSERT_EQ(report.mismatches_.size(), full.mismatches_.size());
+    for(std::size_t i = 0; i < report.mismatches_.size(); ++i)
+        EXPECT_EQ(report.mismatches_[i].index_, full.mismatches_[i].index_);
+
+    // the NaN ranks worst, at its coordinate in the original dimension order
+    EXPECT_EQ(report.worst_.index_, 2 * StreamedProblem::M + 30);
+    EXPECT_EQ(report.worst_coordinate_, (std::vector<std::size_t>{30, 2}));
+    EXPECT_EQ(report.tile_errors_.size(), 3);
+}
+
+TEST(CheckErrStreamed, SingleSlab)
+{
+    StreamedProblem problem;
+
+    EXPECT_TRUE(check_err_streamed<float>(
+        problem.desc, problem.get_read_device(), problem.get_compute_reference()));
+    EXPECT_EQ(problem.num_read, 1);
+}
+
+TEST(CheckErrStreamed, ReferenceOncePerSlab)
+{
+    StreamedProblem problem;
+
+    // the second result differs in one element
+    Tensor<float> other = problem.device;
+    other(7, 25) += 1.f;
+
+    std::vector<std::size_t> read_results;
+
+    const auto reports = check_err_streamed_reports<float>(
+        problem.desc,
+        2,
+        [&](std::size_t i, float* p, std::size_t offset, std::size_t count) {
+            const auto& result = i == 0 ? problem.device : other;
+            std::memcpy(p, result.mData.data() + offset, count * sizeof(float));
+            read_results.push_back(i);
+        },
+        problem.get_compute_reference(),
+        1e-5,
+        3e-6,
+        4 * StreamedProblem::LD * sizeof(float));
+
+    const std::size_t num_slab = (StreamedProblem::N + 3) / 4;
+
+    EXPECT_EQ(problem.num_reference, num_slab);
+    ASSERT_EQ(read_results.size(), 2 * num_slab);
+    for(std::size_t read = 0; read < read_results.size(); ++read)
+        EXPECT_EQ(read_results[read], read % 2);
+
+    ASSERT_EQ(reports.size(), 2);
+    EXPECT_TRUE(reports[0].IsPass());
+    EXPECT_FALSE(reports[1].IsPass());
+    EXPECT_EQ(reports[1].num_error_, 1);
+    EXPECT_EQ(reports[1].worst_coordinate_, (std::vector<std::size_t>{7, 25}));
+}
+
+TEST(CheckErrStreamed, SharedDeviceBuffer)
+{
+    StreamedProblem problem;
+
+    Tensor<float> other = problem.device;
+    other(7, 25) += 1.f;
+
+    // like the profiler, the results are run one after the other into one buffer
+    Tensor<float>::Data buffer;
+    std::size_t resident = 2;
+    std::atomic<int> num_in_flight{0};
+    std::atomic<bool> overlapped{false};
+
+    const auto reports = check_err_streamed_reports<float>(
+        problem.desc,
+        2,
+        [&](std::size_t i, float* p, std::size_t offset, std::size_t count) {
+            if(++num_in_flight > 1)
+                overlapped = true;
+
+            if(i != resident)
+            {
+                buffer   = (i == 0 ? problem.device : other).mData;
+                resident = i;
+            }
+
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            std::memcpy(p, buffer.data() + offset, count * sizeof(float));
+
+            --num_in_flight;
+        },
+        problem.get_compute_reference(),
+        1e-5,
+        3e-6,
+        4 * StreamedProblem::LD * sizeof(float));
+
+    EXPECT_FALSE(overlapped);
+
+    ASSERT_EQ(reports.size(), 2);
+    EXPECT_TRUE(reports[0].IsPass());
+    EXPECT_EQ(reports[1].num_error_, 1);
+    EXPECT_EQ(reports[1].worst_coordinate_, (std::vector<std::size_t>{7, 25}));
+}
@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck_tile/host/host_philox.hpp"
+
+namespace {
+
+float to_uniform(std::uint32_t bits)
+{
+    return -5.f + 10.f * ck_tile::HostPhilox::to_uniform_float(bits);
+}
+
+} // namespace
+
+TEST(HostPhilox, KnownAnswer)
+{
+    // Philox4x32-10 known answer vectors of the Random123 library
+    const auto zero = ck_tile::HostPhilox(0)(0);
+    EXPECT_EQ(zero[0], 0x6627e8d5u);
+    EXPECT_EQ(zero[1], 0xe169c58du);
+    EXPECT_EQ(zero[2], 0xbc57ac4cu);
+    EXPECT_EQ(zero[3], 0x9b00dbd8u);
+}
+
+TEST(HostPhilox, BatchMatchesSingleCounter)
+{
+    const ck_tile::HostPhilox philox(11939);
+
+    // crosses the internal batch size
+    std::vector<std::uint32_t> batch(4 * 131);
+    philox.generate(1000, 131, batch.data());
+
+    for(std::uint64_t i = 0; i < 131; ++i)
+    {
+        const auto single = philox(1000 + i);
+        for(std::size_t lane = 0; lane < 4; ++lane)
+            EXPECT_EQ(batch[4 * i + lane], single[lane]);
+    }
+}
+
+TEST(HostPhilox, FillIndependentOfThreadCount)
+{
+    // not a multiple of the lanes or of the per-task chunk
+    const std::size_t n = 3 * 4096 + 7;
+
+    std::vector<float> expected(n);
+    ck_tile::host_philox_fill(expected.begin(), expected.end(), 11939, to_uniform, 1);
+
+    for(std::size_t max_thread : {0, 2, 3})
+    {
+        std::vector<float> out(n);
+        ck_tile::host_philox_fill(out.begin(), out.end(), 11939, to_uniform, max_thread);
+        EXPECT_EQ(out, expected);
+    }
+
+    // a prefix of a longer stream is the shorter stream
+    std::vector<float> prefix(4099);
+    ck_tile::host_philox_fill(prefix.begin(), prefix.end(), 11939, to_uniform);
+    EXPECT_TRUE(std::equal(prefix.begin(), prefix.end(), expected.begin()));
+
+    // forward iterators take the serial path and produce the same stream
+    std::list<float> list(1001);
+    ck_tile::host_philox_fill(list.begin(), list.end(), 11939, to_uniform);
+    EXPECT_TRUE(std::equal(list.begin(), list.end(), expected.begin()));
+}
+
+TEST(HostPhilox, UniformRange)
+{
+    std::vector<float> out(1 << 16);
+    ck_tile::host_philox_fill(out.begin(), out.end(), 7, to_uniform);
+
+    double sum = 0;
+    for(const float x : out)
+    {
+        EXPECT_GE(x, -5.f);
+        EXPECT_LE(x, 5.f);
+        sum += x;
+    }
+
+    EXPECT_NEAR(sum / static_cast<double>(out.size()), 0., 0.05);
+
+    std::vector<float> other_seed(out.size());
+    ck_tile::host_philox_fill(other_seed.begin(), other_seed.end(), 8, to_uniform);
+    EXPECT_NE(out, other_seed);
+}
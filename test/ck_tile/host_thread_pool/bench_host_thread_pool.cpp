@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "ck_tile/host/host_thread_pool.hpp"
+
+// Per-call overhead of the persistent HostThreadPool compared with spawning fresh threads for
+// every call, as ParallelTensorFunctor used to do.
+//   bench_host_thread_pool [num_call] [work_size]
+
+template <typename F>
+double time_per_call_us(int num_call, F&& f)
+{
+    const auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < num_call; ++i)
+        f();
+    const auto stop = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::micro>(stop - start).count() / num_call;
+}
+
+int main(int argc, char* argv[])
+{
+    const int num_call         = argc > 1 ? std::atoi(argv[1]) : 2000;
+    const std::size_t n        = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1024;
+    const std::size_t num_thread = std::max(std::thread::hardware_concurrency(), 1u);
+
+    std::vector<float> data(n, 1.f);
+
+    auto work = [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; ++i)
+            data[i] = data[i] * 0.5f + 1.f;
+    };
+
+    const double spawn_us = time_per_call_us(num_call, [&] {
+        const std::size_t work_per_thread = (n + num_thread - 1) / num_thread;
+
+        std::vector<std::thread> threads;
+        for(std::size_t it = 0; it < num_thread; ++it)
+        {
+            const std::size_t begin = std::min(it * work_per_thread, n);
+            const std::size_t end   = std::min(begin + work_per_thread, n);
+            threads.emplace_back(work, begin, end);
+        }
+        for(auto& thread : threads)
+            thread.join();
+    });
+
+    auto& pool = ck_tile::HostThreadPool::instance();
+
+    const double pool_us =
+        time_per_call_us(num_call, [&] { pool.parallel_for(n, work, num_thread); });
+
+    std::cout << "threads: " << num_thread << ", calls: " << num_call << ", work size: " << n
+              << std::endl;
+    std::cout << "spawn per call: " << spawn_us << " us" << std::endl;
+    std::cout << "pool per call: " << pool_us << " us" << std::endl;
+
+    return 0;
+}
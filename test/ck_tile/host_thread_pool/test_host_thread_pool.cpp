@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck_tile/host/host_thread_pool.hpp"
+
+namespace {
+
+// exercise the stealing paths even on machines with few cores
+constexpr std::size_t kNumWorker = 7;
+
+void expect_each_index_once(ck_tile::HostThreadPool& pool, std::size_t n, std::size_t max_thread)
+{
+    std::vector<int> hits(n, 0);
+
+    pool.parallel_for(
+        n,
+        [&](std::size_t begin, std::size_t end) {
+            for(std::size_t i = begin; i < end; ++i)
+                ++hits[i];
+        },
+        max_thread);
+
+    EXPECT_EQ(std::count(hits.begin(), hits.end(), 1), static_cast<std::ptrdiff_t>(n));
+}
+
+} // anonymous namespace
+
+TEST(HostThreadPool, CoversRangeOnce)
+{
+    ck_tile::HostThreadPool pool(kNumWorker);
+
+    for(std::size_t n : {0, 1, 2, 7, 63, 1000, 123457})
+        for(std::size_t max_thread : {0, 1, 3, 8, 64})
+            expect_each_index_once(pool, n, max_thread);
+}
+
+TEST(HostThreadPool, UnevenWork)
+{
+    ck_tile::HostThreadPool pool(kNumWorker);
+
+    std::atomic<std::size_t> sum{0};
+
+    pool.parallel_for(4096, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; ++i)
+        {
+            // the first chunks are much more expensive than the rest
+            std::size_t acc = 0;
+            for(std::size_t j = 0; j < (i < 256 ? 10000 : 10); ++j)
+                acc += j ^ i;
+            sum += acc > 0 ? 1 : 0;
+        }
+    });
+
+    EXPECT_EQ(sum.load(), 4096);
+}
+
+TEST(HostThreadPool, NestedCallsRunInline)
+{
+    ck_tile::HostThreadPool pool(kNumWorker);
+
+    std::atomic<std::size_t> count{0};
+
+    pool.parallel_for(64, [&](std::size_t begin, std::size_t end) {
+        for(std::size_t i = begin; i < end; ++i)
+            pool.parallel_for(16, [&](std::size_t b, std::size_t e) { count += e - b; });
+    });
+
+    EXPECT_EQ(count.load(), 64 * 16);
+}
+
+TEST(HostThreadPool, ConcurrentCallers)
+{
+    ck_tile::HostThreadPool pool(kNumWorker);
+
+    std::atomic<std::size_t> count{0};
+
+    auto submit = [&] {
+        for(int i = 0; i < 100; ++i)
+            pool.parallel_for(1000, [&](std::size_t b, std::size_t e) { count += e - b; });
+    };
+
+    std::thread other(submit);
+    submit();
+    other.join();
+
+    EXPECT_EQ(count.load(), 2 * 100 * 1000);
+}
+
+TEST(HostThreadPool, PropagatesException)
+{
+    ck_tile::HostThreadPool pool(kNumWorker);
+
+    EXPECT_THROW(pool.parallel_for(1000,
+                                   [&](std::size_t begin, std::size_t) {
+                                       if(begin >= 500)
+                                           throw std::runtime_error("task failed");
+                                   }),
+                 std::runtime_error);
+
+    // the pool stays usable afterwards
+    expect_each_index_once(pool, 1000, 0);
+}
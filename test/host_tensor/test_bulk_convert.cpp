@@ -0,0 +1,221 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/bulk_convert.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+#include "ck_tile/host/host_philox.hpp"
+
+using ck::bf8_t;
+using ck::bhalf_t;
+using ck::f8_t;
+using ck::half_t;
+using ck::utils::RoundingMode;
+
+namespace {
+
+template <typename T>
+std::uint32_t bits_of(const T& x)
+{
+    std::uint32_t bits = 0;
+    std::memcpy(&bits, &x, sizeof(x));
+    return bits;
+}
+
+template <typename T>
+T from_bits(std::uint32_t bits)
+{
+    T x;
+    std::memcpy(&x, &bits, sizeof(x));
+    return x;
+}
+
+template <typename T>
+bool is_nan(const T& x)
+{
+    return std::isnan(ck::type_convert<float>(x));
+}
+
+// every half_t, and floats that cover all exponents, the rounding boundaries and the specials
+std::vector<half_t> all_halfs()
+{
+    std::vector<half_t> v;
+    for(std::uint32_t i = 0; i < 0x10000; ++i)
+        v.push_back(from_bits<half_t>(i));
+    return v;
+}
+
+std::vector<float> sample_floats()
+{
+    std::vector<float> v;
+    ck_tile::HostPhilox philox(7);
+    std::vector<std::uint32_t> bits(1 << 18);
+    philox.generate(0, bits.size() / ck_tile::HostPhilox::kNumLane, bits.data());
+    for(const auto b : bits)
+        v.push_back(from_bits<float>(b));
+    for(std::uint32_t e = 0; e < 0x100; ++e)
+        for(std::uint32_t m : {0u, 1u, 0x100000u, 0x200000u, 0x400000u, 0x7FFFFFu})
+        {
+            v.push_back(from_bits<float>((e << 23) | m));
+            v.push_back(from_bits<float>(0x80000000u | (e << 23) | m));
+        }
+    return v;
+}
+
+// bulk_convert() in the default rounding mode against ck::type_convert, NaN payloads aside
+template <typename Y, typename X>
+void expect_same_as_type_convert(const std::vector<X>& src)
+{
+    std::vector<Y> dst(src.size());
+    ck::utils::bulk_convert(src.data(), dst.data(), src.size());
+
+    std::size_t num_mismatch = 0;
+    for(std::size_t i = 0; i < src.size(); ++i)
+    {
+        Y ref = ck::type_convert<Y>(src[i]);
+
+        // far below the smallest subnormal, the 8-bit conversions of ck::type_convert shift
+        // by more than the width of an int, so the correctly rounded zero is expected there
+        if constexpr(sizeof(Y) == 1)
+        {
+            if(std::abs(static_cast<float>(src[i])) < 0x1p-24f)
+                ref = from_bits<Y>(0);
+        }
+
+        if(is_nan(ref) ? !is_nan(dst[i]) : bits_of(ref) != bits_of(dst[i]))
+        {
+            if(num_mismatch++ < 8)
+                ADD_FAILURE() << "element " << i << ": input bits " << std::hex << bits_of(src[i])
+                              << ", got " << bits_of(dst[i]) << ", expected " << bits_of(ref);
+        }
+        EXPECT_EQ(bits_of(ck::utils::convert_value<Y>(src[i])), bits_of(dst[i]));
+    }
+    EXPECT_EQ(num_mismatch, 0);
+}
+
+template <typename X>
+std::vector<X> all_bytes()
+{
+    std::vector<X> v;
+    for(std::uint32_t i = 0; i < 0x100; ++i)
+        v.push_back(from_bits<X>(i));
+    return v;
+}
+
+} // namespace
+
+TEST(BulkConvert, MatchesTypeConvertFromHalf)
+{
+    const auto src = all_halfs();
+    expect_same_as_type_convert<float>(src);
+    expect_same_as_type_convert<bhalf_t>(src);
+#if !CK_USE_SR_F8_CONVERSION
+    expect_same_as_type_convert<f8_t>(src);
+    expect_same_as_type_convert<bf8_t>(src);
+#endif
+}
+
+TEST(BulkConvert, MatchesTypeConvertFromFloat)
+{
+    const auto src = sample_floats();
+    expect_same_as_type_convert<half_t>(src);
+    expect_same_as_type_convert<bhalf_t>(src);
+#if !CK_USE_SR_F8_CONVERSION
+    expect_same_as_type_convert<f8_t>(src);
+    expect_same_as_type_convert<bf8_t>(src);
+#endif
+}
+
+TEST(BulkConvert, MatchesTypeConvertToFloat)
+{
+    expect_same_as_type_convert<float>(all_bytes<f8_t>());
+    expect_same_as_type_convert<float>(all_bytes<bf8_t>());
+    expect_same_as_type_convert<half_t>(all_bytes<f8_t>());
+    expect_same_as_type_convert<half_t>(all_bytes<bf8_t>());
+}
+
+TEST(BulkConvert, RoundingModes)
+{
+    // halfway between the bhalf_t values 1 and 1 + 2^-7, and just above it
+    const std::vector<float> src = {1.f + 0x1p-8f, 1.f + 0x1p-8f + 0x1p-20f, -1.f - 0x1p-8f};
+    std::vector<bhalf_t> dst(src.size());
+
+    ck::utils::bulk_convert(src.data(), dst.data(), src.size(), RoundingMode::NearestEven);
+    EXPECT_EQ(ck::type_convert<float>(dst[0]), 1.f);
+    EXPECT_EQ(ck::type_convert<float>(dst[1]), 1.f + 0x1p-7f);
+    EXPECT_EQ(ck::type_convert<float>(dst[2]), -1.f);
+
+    ck::utils::bulk_convert(src.data(), dst.data(), src.size(), RoundingMode::TowardZero);
+    EXPECT_EQ(ck::type_convert<float>(dst[1]), 1.f);
+
+    // truncation saturates instead of overflowing to infinity
+    const float big = 65520.f;
+    EXPECT_EQ(float(ck::utils::convert_value<half_t>(big, RoundingMode::NearestEven)), INFINITY);
+    EXPECT_EQ(float(ck::utils::convert_value<half_t>(big, RoundingMode::TowardZero)), 65504.f);
+
+    // the fnuz formats saturate in every mode
+    const auto saturated = ck::utils::convert_value<f8_t>(1e6f, RoundingMode::NearestEven);
+    EXPECT_EQ(ck::type_convert<float>(saturated), 240.f);
+}
+
+TEST(BulkConvert, StochasticRounding)
+{
+    // a quarter of the way from 1 to the next bhalf_t
+    const std::size_t n = 100000;
+    const std::vector<float> src(n, 1.f + 0x1p-9f);
+    std::vector<bhalf_t> dst(n), again(n);
+
+    ck::utils::bulk_convert(src.data(), dst.data(), n, RoundingMode::Stochastic, 42);
+    ck::utils::bulk_convert(src.data(), again.data(), n, RoundingMode::Stochastic, 42);
+
+    double sum = 0;
+    for(std::size_t i = 0; i < n; ++i)
+    {
+        const float y = ck::type_convert<float>(dst[i]);
+        ASSERT_TRUE(y == 1.f || y == 1.f + 0x1p-7f);
+        sum += y;
+        EXPECT_EQ(bits_of(dst[i]), bits_of(again[i]));
+    }
+
+    // unbiased: the mean is within a few standard deviations of the input
+    EXPECT_NEAR(sum / n, 1. + 0x1p-9, 4 * 0x1p-7 * std::sqrt(0.25 * 0.75 / n));
+}
+
+TEST(BulkConvert, IndependentOfThreadCount)
+{
+    const auto src = sample_floats();
+    std::vector<f8_t> serial(src.size()), parallel(src.size());
+
+    // nested in a task of the thread pool, the conversion runs on a single thread
+    ck_tile::HostThreadPool::instance().parallel_for(1, [&](std::size_t, std::size_t) {
+        ck::utils::bulk_convert(
+            src.data(), serial.data(), src.size(), RoundingMode::Stochastic, 3);
+    });
+    ck::utils::bulk_convert(src.data(), parallel.data(), src.size(), RoundingMode::Stochastic, 3);
+
+    for(std::size_t i = 0; i < src.size(); ++i)
+        ASSERT_EQ(bits_of(serial[i]), bits_of(parallel[i])) << "element " << i;
+}
+
+TEST(BulkConvert, CopyAsType)
+{
+    Tensor<float> a(std::vector<std::size_t>{3, 1000});
+    for(std::size_t i = 0; i < a.mData.size(); ++i)
+        a.mData[i] = static_cast<float>(i) * 0.37f - 500.f;
+
+    const auto b = a.CopyAsType<half_t>();
+    for(std::size_t i = 0; i < a.mData.size(); ++i)
+        EXPECT_EQ(bits_of(b.mData[i]), bits_of(ck::type_convert<half_t>(a.mData[i])));
+
+    // conversions without a bit-level routine only have the default rounding
+    EXPECT_NO_THROW(a.CopyAsType<int32_t>());
+    EXPECT_THROW(a.CopyAsType<int32_t>(RoundingMode::TowardZero), std::runtime_error);
+}
@@ -0,0 +1,201 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+
+namespace {
+
+// lengths {3, 4, 5} laid out as (d2, d0, d1), with padding in the outermost stride
+Tensor<int> make_permuted_tensor()
+{
+    Tensor<int> t(std::vector<std::size_t>{3, 4, 5}, std::vector<std::size_t>{4, 1, 13});
+    for(std::size_t i = 0; i < t.mData.size(); ++i)
+        t.mData[i] = static_cast<int>(i);
+    return t;
+}
+
+// every multi-index in row-major order, enumerated the straightforward way
+std::vector<std::vector<std::size_t>> get_indices(const std::vector<std::size_t>& lengths)
+{
+    std::vector<std::vector<std::size_t>> indices;
+    for(std::size_t i0 = 0; i0 < lengths[0]; ++i0)
+        for(std::size_t i1 = 0; i1 < lengths[1]; ++i1)
+            for(std::size_t i2 = 0; i2 < lengths[2]; ++i2)
+                indices.push_back({i0, i1, i2});
+    return indices;
+}
+
+} // namespace
+
+TEST(HostTensor, ForEachVisitsIndicesInOrder)
+{
+    auto t = make_permuted_tensor();
+
+    std::vector<std::vector<std::size_t>> visited;
+    t.ForEach([&](auto& self, auto idx) {
+        visited.push_back(idx);
+        self(idx) = -1;
+    });
+
+    EXPECT_EQ(visited, get_indices(t.GetLengths()));
+    EXPECT_EQ(t(2, 3, 4), -1);
+}
+
+TEST(HostTensor, ForEachIndexOffsets)
+{
+    const auto t = make_permuted_tensor();
+
+    std::vector<std::vector<std::size_t>> visited;
+    t.ForEachIndex([&](auto idx, std::size_t offset) {
+        EXPECT_EQ(offset, t.mDesc.GetOffsetFromMultiIndex(idx));
+        EXPECT_EQ(t(idx), t.mData[offset]);
+        visited.emplace_back(idx.begin(), idx.end());
+    });
+
+    EXPECT_EQ(visited, get_indices(t.GetLengths()));
+}
+
+TEST(HostTensor, ForEachIndexParallel)
+{
+    Tensor<int> t(std::vector<std::size_t>{7, 33, 9, 17});
+    std::vector<std::atomic<int>> count(t.mData.size());
+
+    t.ForEachIndex(
+        [&](auto idx, std::size_t offset) {
+            EXPECT_EQ(offset, t.mDesc.GetOffsetFromMultiIndex(idx));
+            ++count[offset];
+        },
+        4);
+
+    for(const auto& c : count)
+        EXPECT_EQ(c, 1);
+}
+
+TEST(HostTensor, ForEachIndexEdgeCases)
+{
+    std::size_t num_call = 0;
+
+    Tensor<int>(std::vector<std::size_t>{4, 0, 3}).ForEachIndex([&](auto, auto) { ++num_call; });
+    EXPECT_EQ(num_call, 0);
+
+    Tensor<int>(std::vector<std::size_t>{1, 1, 1}).ForEachIndex([&](auto idx, std::size_t offset) {
+        EXPECT_EQ(idx.size(), 3);
+        EXPECT_EQ(offset, 0);
+        ++num_call;
+    });
+    EXPECT_EQ(num_call, 1);
+}
+
+TEST(HostTensor, StridedIndexRange)
+{
+    const std::vector<std::size_t> lengths{3, 4, 5};
+    const std::vector<std::size_t> strides{4, 1, 13};
+    const auto indices = get_indices(lengths);
+
+    // a range starting and ending in the middle of rows
+    std::vector<std::size_t> idx(lengths.size());
+    std::size_t i = 7;
+    for_each_strided_index(lengths, strides, 7, 43, idx, [&](auto& cur, std::size_t offset) {
+        EXPECT_EQ(cur, indices[i]);
+        EXPECT_EQ(offset, indices[i][0] * 4 + indices[i][1] + indices[i][2] * 13);
+        ++i;
+    });
+    EXPECT_EQ(i, 43);
+}
+
+TEST(HostTensor, GenerateTensorValueHighRank)
+{
+    // 8 dimensions, permuted so that the walk is not along the element space
+    const std::vector<std::size_t> lengths{2, 3, 2, 2, 3, 2, 2, 5};
+    std::vector<std::size_t> strides(lengths.size());
+    std::size_t stride = 1;
+    for(std::size_t d : {3, 0, 7, 5, 1, 6, 2, 4})
+    {
+        strides[d] = stride;
+        stride *= lengths[d];
+    }
+
+    Tensor<int> t(lengths, strides);
+    t.GenerateTensorValue(
+        [](auto... is) {
+            int value = 0;
+            ((value = value * 10 + static_cast<int>(is)), ...);
+            return value;
+        },
+        3);
+
+    t.ForEach([](auto& self, auto idx) {
+        int value = 0;
+        for(auto i : idx)
+            value = value * 10 + static_cast<int>(i);
+        EXPECT_EQ(self(idx), value);
+    });
+}
+
+TEST(HostTensor, GenerateTensorValueIndexIndependent)
+{
+    // packed tensors take the contiguous path; the padding of strided ones stays untouched
+    Tensor<int> packed(std::vector<std::size_t>{5, 7, 9});
+    packed.GenerateTensorValue(GeneratorTensor_2<int>{3, 4}, 2);
+    for(auto v : packed.mData)
+        EXPECT_EQ(v, 3);
+
+    Tensor<int> padded(std::vector<std::size_t>{5, 7}, std::vector<std::size_t>{8, 1});
+    padded.GenerateTensorValue(GeneratorTensor_2<int>{3, 4}, 2);
+    for(std::size_t i = 0; i < padded.mData.size(); ++i)
+        EXPECT_EQ(padded.mData[i], i % 8 == 7 ? 0 : 3);
+
+    static_assert(is_index_independent_generator<GeneratorTensor_3<float>>::value);
+    static_assert(!is_index_independent_generator<GeneratorTensor_Sequential<0>>::value);
+}
+
+TEST(HostTensor, GenerateTensorValueRankLimit)
+{
+    Tensor<int> t(std::vector<std::size_t>(Tensor<int>::kMaxGenerateRank + 1, 1));
+    EXPECT_THROW(t.GenerateTensorValue(GeneratorTensor_Sequential<0>{}), std::runtime_error);
+}
+
+TEST(HostTensor, AllocatorValueInitializesReusedStorage)
+{
+    // small and large (mmap'ed) storage
+    for(std::size_t n : {std::size_t{100}, std::size_t{1} << 20})
+    {
+        Tensor<int>::Data data(n);
+        for(auto v : data)
+            ASSERT_EQ(v, 0);
+
+        std::fill(data.begin(), data.end(), 7);
+
+        // shrink and regrow within the capacity
+        data.resize(n / 2);
+        data.resize(n);
+        for(std::size_t i = 0; i < n; ++i)
+            ASSERT_EQ(data[i], i < n / 2 ? 7 : 0);
+
+        data.assign(n / 4, 5);
+        data.push_back(9);
+        data.pop_back();
+        data.resize(n);
+        for(std::size_t i = 0; i < n; ++i)
+            ASSERT_EQ(data[i], i < n / 4 ? 5 : 0);
+
+        // the swapped storage keeps its own record
+        Tensor<int>::Data other(n);
+        std::fill(data.begin(), data.end(), 3);
+        data.swap(other);
+        other.resize(1);
+        other.resize(n);
+        for(std::size_t i = 1; i < n; ++i)
+            ASSERT_EQ(other[i], 0);
+    }
+}
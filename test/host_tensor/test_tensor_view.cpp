@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_view.hpp"
+
+namespace {
+
+// value 100 * g + 10 * m + n at (g, m, n)
+Tensor<float> make_gmn_tensor(std::size_t G, std::size_t M, std::size_t N)
+{
+    Tensor<float> t(std::vector<std::size_t>{G, M, N});
+    t.ForEach([](auto& self, auto idx) {
+        self(idx) = static_cast<float>(100 * idx[0] + 10 * idx[1] + idx[2]);
+    });
+    return t;
+}
+
+} // namespace
+
+TEST(TensorView, SelectAndSlice)
+{
+    auto t = make_gmn_tensor(3, 4, 5);
+
+    const auto group = make_tensor_view(t).Select(0, 2);
+    EXPECT_EQ(group.GetLengths(), (std::vector<std::size_t>{4, 5}));
+    EXPECT_EQ(group(1, 3), 213.f);
+
+    const auto cols = group.Slice(1, 1, 3);
+    EXPECT_EQ(cols.GetLengths(), (std::vector<std::size_t>{4, 2}));
+    EXPECT_EQ(cols(3, 0), 231.f);
+    EXPECT_EQ(cols.size(), 8);
+
+    // writes go to the underlying tensor
+    cols(0, 1) = -1.f;
+    EXPECT_EQ(t(2, 0, 2), -1.f);
+
+    EXPECT_THROW(group.Slice(1, 2, 6), std::runtime_error);
+    EXPECT_THROW(group.Select(2, 0), std::runtime_error);
+}
+
+TEST(TensorView, IteratesInIndexOrder)
+{
+    const auto t = make_gmn_tensor(2, 3, 4);
+
+    // (n, g) of m = 1
+    const auto view = make_tensor_view(t).Select(1, 1).Permute(std::vector<std::size_t>{1, 0});
+
+    std::vector<float> values(view.begin(), view.end());
+    std::vector<float> expected;
+    for(std::size_t n = 0; n < 4; ++n)
+        for(std::size_t g = 0; g < 2; ++g)
+            expected.push_back(static_cast<float>(100 * g + 10 + n));
+
+    EXPECT_EQ(values, expected);
+    EXPECT_THROW(view.Permute(std::vector<std::size_t>{0, 0}), std::runtime_error);
+}
+
+TEST(TensorView, ReshapeAndBroadcast)
+{
+    auto t = make_gmn_tensor(2, 3, 4);
+
+    const auto flat = make_tensor_view(t).Reshape(std::vector<std::size_t>{6, 4});
+    EXPECT_EQ(flat(4, 1), 111.f);
+
+    // only packed views can be reshaped
+    EXPECT_THROW(flat.Slice(1, 0, 2).Reshape(std::vector<std::size_t>{12}), std::runtime_error);
+
+    const auto row  = make_tensor_view(t).Select(0, 1).Select(0, 2).Reshape(std::vector<int>{1, 4});
+    const auto rows = row.Broadcast(std::vector<std::size_t>{5, 3, 4});
+    EXPECT_EQ(rows.GetStrides(), (std::vector<std::size_t>{0, 0, 1}));
+    EXPECT_EQ(rows(4, 2, 3), 123.f);
+
+    EXPECT_THROW(row.Broadcast(std::vector<std::size_t>{3, 5}), std::runtime_error);
+}
+
+TEST(TensorView, CheckErr)
+{
+    const auto ref = make_gmn_tensor(4, 8, 16);
+    auto out       = make_gmn_tensor(4, 8, 16);
+
+    // an error outside of the compared group and columns is not seen
+    out(1, 3, 0) = 0.f;
+    const auto out_group = make_tensor_view(out).Select(0, 1).Slice(1, 1, 9);
+    const auto ref_group = make_tensor_view(ref).Select(0, 1).Slice(1, 1, 9);
+    EXPECT_TRUE(ck::utils::check_err(out_group, ref_group));
+
+    out(1, 3, 5) = 0.f;
+    const auto report = ck::utils::check_err_report(out_group, ref_group);
+    EXPECT_FALSE(report.IsPass());
+    EXPECT_EQ(report.num_error_, 1);
+    EXPECT_EQ(report.worst_coordinate_, (std::vector<std::size_t>{3, 4}));
+}
+
+TEST(TensorView, CheckErrTensorAgainstView)
+{
+    constexpr std::size_t M = 6;
+    constexpr std::size_t N = 5;
+
+    // column-major tensor, its element space order differs from its index order
+    Tensor<float> out(HostTensorDescriptor({M, N}, {1, M}));
+    out.ForEach([](auto& self, auto idx) { self(idx) = static_cast<float>(10 * idx[0] + idx[1]); });
+
+    const auto ref = make_gmn_tensor(2, M, N);
+
+    const auto ref_group = make_tensor_view(ref).Select(0, 0);
+    EXPECT_TRUE(ck::utils::check_err(out, ref_group));
+    EXPECT_TRUE(ck::utils::check_err(ref_group, out));
+
+    out(4, 1) = 0.f;
+    const auto report = ck::utils::check_err_report(out, ref_group);
+    EXPECT_EQ(report.num_error_, 1);
+    EXPECT_EQ(report.worst_coordinate_, (std::vector<std::size_t>{4, 1}));
+}
@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/tensor_operation_instance/device_operation_instance_catalog.hpp"
+
+using ck::tensor_operation::device::DeviceGemmInstanceDescriptor;
+using ck::tensor_operation::device::GemmSpecialization;
+using ck::tensor_operation::device::get_instance_id;
+using ck::tensor_operation::device::InstanceKeyBuilder;
+using ck::tensor_operation::device::instance::add_device_operation_instance_entries;
+using ck::tensor_operation::device::instance::DeviceOperationInstanceCatalog;
+using ck::tensor_operation::device::instance::DeviceOperationInstanceEntry;
+using ck::tensor_operation::device::instance::DeviceOperationInstanceRegistry;
+
+namespace {
+
+struct BaseOp
+{
+    virtual ~BaseOp() = default;
+
+    virtual int GetMPerBlock() const = 0;
+};
+
+int num_constructed = 0;
+
+template <int MPerBlock, GemmSpecialization GemmSpec>
+struct MockOp : BaseOp
+{
+    MockOp() { ++num_constructed; }
+
+    MockOp(const MockOp&) : BaseOp() { ++num_constructed; }
+
+    int GetMPerBlock() const override { return MPerBlock; }
+
+    static constexpr DeviceGemmInstanceDescriptor GetInstanceDescriptor()
+    {
+        DeviceGemmInstanceDescriptor desc;
+
+        desc.family_      = "MockOp";
+        desc.gemm_spec_   = GemmSpec;
+        desc.m_per_block_ = MPerBlock;
+
+        return desc;
+    }
+
+    static std::string GetInstanceKey()
+    {
+        return InstanceKeyBuilder("MockOp").Add(MPerBlock).Add(GemmSpec).Get();
+    }
+};
+
+// an instance without a key
+struct OpWithoutKey : MockOp<256, GemmSpecialization::Default>
+{
+    static std::string GetInstanceKey() = delete;
+};
+
+template <GemmSpecialization GemmSpec>
+using mock_instances =
+    std::tuple<MockOp<32, GemmSpec>, MockOp<64, GemmSpec>, MockOp<128, GemmSpec>>;
+
+DeviceOperationInstanceCatalog<BaseOp> make_catalog()
+{
+    std::vector<DeviceOperationInstanceEntry<BaseOp>> entries;
+
+    add_device_operation_instance_entries(entries,
+                                          mock_instances<GemmSpecialization::Default>{});
+    add_device_operation_instance_entries(entries,
+                                          mock_instances<GemmSpecialization::MNKPadding>{});
+
+    return DeviceOperationInstanceCatalog<BaseOp>(std::move(entries));
+}
+
+} // namespace
+
+TEST(InstanceCatalog, DescriptorsWithoutInstances)
+{
+    const auto catalog = make_catalog();
+
+    num_constructed = 0;
+
+    ASSERT_EQ(catalog.GetNumInstance(), 6);
+    EXPECT_EQ(catalog.GetDescriptor(1).m_per_block_, 64);
+    EXPECT_EQ(catalog.GetDescriptor(4).gemm_spec_, GemmSpecialization::MNKPadding);
+    EXPECT_STREQ(catalog.GetDescriptor(5).family_, "MockOp");
+
+    const auto padded = catalog.Select([](const DeviceGemmInstanceDescriptor& desc) {
+        return desc.gemm_spec_ == GemmSpecialization::MNKPadding;
+    });
+    EXPECT_EQ(padded, (std::vector<std::size_t>{3, 4, 5}));
+
+    EXPECT_EQ(num_constructed, 0);
+}
+
+TEST(InstanceCatalog, ConstructsOnlySelectedInstances)
+{
+    const auto catalog = make_catalog();
+
+    num_constructed = 0;
+
+    const auto large = catalog.Select(
+        [](const DeviceGemmInstanceDescriptor& desc) { return desc.m_per_block_ >= 64; });
+    const auto op_ptrs = catalog.MakeInstances(large);
+
+    EXPECT_EQ(num_constructed, 4);
+    ASSERT_EQ(op_ptrs.size(), 4);
+    EXPECT_EQ(op_ptrs[0]->GetMPerBlock(), 64);
+    EXPECT_EQ(op_ptrs[1]->GetMPerBlock(), 128);
+    EXPECT_EQ(op_ptrs[2]->GetMPerBlock(), 64);
+    EXPECT_EQ(op_ptrs[3]->GetMPerBlock(), 128);
+
+    EXPECT_THROW(catalog.MakeInstance(6), std::runtime_error);
+}
+
+TEST(InstanceCatalog, AllInstancesInOrder)
+{
+    const auto op_ptrs = make_catalog().MakeInstances();
+
+    ASSERT_EQ(op_ptrs.size(), 6);
+    for(std::size_t i = 0; i < op_ptrs.size(); ++i)
+        EXPECT_EQ(op_ptrs[i]->GetMPerBlock(), 32 << (i % 3));
+}
+
+TEST(InstanceId, CanonicalKey)
+{
+    const auto key = InstanceKeyBuilder("DeviceFoo")
+                         .AddName("RowMajor")
+                         .AddDataType<float>()
+                         .AddDataType<ck::half_t>()
+                         .Add(GemmSpecialization::MNKPadding)
+                         .Add(256)
+                         .Add(true)
+                         .Get();
+    EXPECT_EQ(key, "DeviceFoo<RowMajor,fp32,fp16,MNKPadding,256,1>");
+    EXPECT_EQ(InstanceKeyBuilder("DeviceBar").Get(), "DeviceBar<>");
+
+    // FNV-1a is fixed, so ids stored by earlier builds keep resolving
+    EXPECT_EQ(get_instance_id(""), "-cbf29ce484222325");
+    EXPECT_EQ(get_instance_id("a"), "a-af63dc4c8601ec8c");
+    EXPECT_EQ(get_instance_id(key).substr(0, 10), "DeviceFoo-");
+    EXPECT_NE(get_instance_id(key),
+              get_instance_id("DeviceFoo<RowMajor,fp32,fp16,MNKPadding,128,1>"));
+}
+
+TEST(InstanceId, RegistryFindsInstancesById)
+{
+    std::vector<DeviceOperationInstanceEntry<BaseOp>> entries;
+    add_device_operation_instance_entries(entries,
+                                          mock_instances<GemmSpecialization::Default>{});
+    add_device_operation_instance_entries(entries, std::tuple<OpWithoutKey>{});
+    add_device_operation_instance_entries(entries,
+                                          mock_instances<GemmSpecialization::MNKPadding>{});
+
+    const DeviceOperationInstanceCatalog<BaseOp> catalog(std::move(entries));
+    const DeviceOperationInstanceRegistry<BaseOp> registry(catalog);
+
+    EXPECT_EQ(registry.GetNumId(), 6);
+    EXPECT_EQ(catalog.GetInstanceId(3), "");
+
+    const std::string id = get_instance_id("MockOp<128,MNKPadding>");
+    EXPECT_EQ(catalog.GetInstanceId(6), id);
+
+    num_constructed = 0;
+
+    ASSERT_EQ(registry.FindInstance(id), 6);
+    const auto op_ptr = registry.MakeInstance(id);
+    ASSERT_NE(op_ptr, nullptr);
+    EXPECT_EQ(op_ptr->GetMPerBlock(), 128);
+    EXPECT_EQ(num_constructed, 1);
+
+    // e.g. an instance that was removed from the library
+    EXPECT_FALSE(registry.FindInstance(get_instance_id("MockOp<512,Default>")));
+    EXPECT_EQ(registry.MakeInstance("MockOp-0123456789abcdef"), nullptr);
+}
@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <vector>
+
+#include "mock_instance_module.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+void add_mock_module_entries(
+    std::vector<DeviceOperationInstanceEntry<MockModuleBaseOp>>& entries)
+{
+    add_device_operation_instance_entries(entries, mock_module_instances{});
+}
+
+CK_EXPORT_INSTANCE_ENTRIES(add_mock_module_entries);
+
+// built into the module, but not exported
+void add_unexported_mock_module_entries(
+    std::vector<DeviceOperationInstanceEntry<MockModuleBaseOp>>& entries)
+{
+    add_device_operation_instance_entries(entries, mock_module_instances{});
+}
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
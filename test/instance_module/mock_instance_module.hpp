@@ -0,0 +1,35 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <tuple>
+
+#include "ck/library/tensor_operation_instance/device_operation_instance_catalog.hpp"
+
+// the op of the instances of the mock module, shared by the module and the test
+struct MockModuleBaseOp
+{
+    virtual ~MockModuleBaseOp() = default;
+
+    virtual int GetMPerBlock() const = 0;
+};
+
+template <int MPerBlock>
+struct MockModuleOp : MockModuleBaseOp
+{
+    int GetMPerBlock() const override { return MPerBlock; }
+
+    static constexpr ck::tensor_operation::device::DeviceGemmInstanceDescriptor
+    GetInstanceDescriptor()
+    {
+        ck::tensor_operation::device::DeviceGemmInstanceDescriptor desc;
+
+        desc.family_      = "MockModuleOp";
+        desc.m_per_block_ = MPerBlock;
+
+        return desc;
+    }
+};
+
+using mock_module_instances = std::tuple<MockModuleOp<32>, MockModuleOp<64>, MockModuleOp<128>>;
@@ -0,0 +1,72 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <stdexcept>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/tensor_operation_instance/device_operation_instance_module.hpp"
+
+#include "mock_instance_module.hpp"
+
+namespace ck {
+namespace tensor_operation {
+namespace device {
+namespace instance {
+
+CK_DECLARE_INSTANCE_ENTRIES(mock_instance_module, add_mock_module_entries, MockModuleBaseOp);
+
+CK_DECLARE_INSTANCE_ENTRIES(mock_instance_module,
+                            add_unexported_mock_module_entries,
+                            MockModuleBaseOp);
+
+CK_DECLARE_INSTANCE_ENTRIES(missing_instance_module, add_missing_module_entries, MockModuleBaseOp);
+
+} // namespace instance
+} // namespace device
+} // namespace tensor_operation
+} // namespace ck
+
+using ck::tensor_operation::device::instance::DeviceOperationInstanceCatalog;
+using ck::tensor_operation::device::instance::DeviceOperationInstanceEntry;
+using ck::tensor_operation::device::instance::get_instance_module;
+
+using Entries = std::vector<DeviceOperationInstanceEntry<MockModuleBaseOp>>;
+
+TEST(InstanceModule, LoadsEntriesOnFirstUse)
+{
+    Entries entries;
+    ck::tensor_operation::device::instance::add_mock_module_entries(entries);
+
+    const DeviceOperationInstanceCatalog<MockModuleBaseOp> catalog(std::move(entries));
+
+    ASSERT_EQ(catalog.GetNumInstance(), 3);
+    EXPECT_STREQ(catalog.GetDescriptor(0).family_, "MockModuleOp");
+    EXPECT_EQ(catalog.GetDescriptor(2).m_per_block_, 128);
+    EXPECT_EQ(catalog.MakeInstance(1)->GetMPerBlock(), 64);
+
+    // the module is opened once and stays loaded
+    void* handle = get_instance_module("mock_instance_module");
+    ASSERT_NE(handle, nullptr);
+    EXPECT_EQ(get_instance_module("mock_instance_module"), handle);
+}
+
+TEST(InstanceModule, MissingModuleAddsNoEntries)
+{
+    Entries entries;
+    ck::tensor_operation::device::instance::add_mock_module_entries(entries);
+    ck::tensor_operation::device::instance::add_missing_module_entries(entries);
+
+    EXPECT_EQ(entries.size(), 3);
+
+    EXPECT_EQ(get_instance_module("missing_instance_module"), nullptr);
+}
+
+TEST(InstanceModule, MissingSymbolThrows)
+{
+    Entries entries;
+    EXPECT_THROW(
+        ck::tensor_operation::device::instance::add_unexported_mock_module_entries(entries),
+        std::runtime_error);
+    EXPECT_TRUE(entries.empty());
+}
@@ -0,0 +1,161 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/library/tensor_operation_instance/gemm_instance_prefilter.hpp"
+
+using ck::tensor_operation::device::DeviceGemmInstanceDescriptor;
+using ck::tensor_operation::device::GemmSpecialization;
+using ck::tensor_operation::device::instance::DeviceOperationInstanceCatalog;
+using ck::tensor_operation::device::instance::DeviceOperationInstanceEntry;
+using ck::tensor_operation::device::instance::GemmInstancePrefilter;
+using ck::tensor_operation::device::instance::GemmPrefilterProblem;
+using ck::tensor_operation::device::instance::GemmRejection;
+using ck::tensor_operation::device::instance::prefilter_gemm_instance;
+
+namespace {
+
+struct BaseOp
+{
+    virtual ~BaseOp() = default;
+};
+
+// row major A and C, column major B, as the mk_nk_mn universal GEMM instances
+DeviceGemmInstanceDescriptor make_desc(GemmSpecialization gemm_spec = GemmSpecialization::Default,
+                                       int m_per_block              = 256,
+                                       int n_per_block              = 128)
+{
+    DeviceGemmInstanceDescriptor desc;
+
+    desc.family_                  = "MockOp";
+    desc.gemm_spec_               = gemm_spec;
+    desc.block_size_              = 256;
+    desc.m_per_block_             = m_per_block;
+    desc.n_per_block_             = n_per_block;
+    desc.k_per_block_             = 64;
+    desc.ak1_                     = 8;
+    desc.bk1_                     = 8;
+    desc.a_row_major_             = true;
+    desc.b_row_major_             = false;
+    desc.c_row_major_             = true;
+    desc.a_src_scalar_per_vector_ = 8;
+    desc.b_src_scalar_per_vector_ = 8;
+    desc.c_dst_scalar_per_vector_ = 8;
+    desc.pipeline_version_        = 3;
+    desc.pipeline_prefetch_       = 2;
+    desc.xdl_                     = true;
+
+    return desc;
+}
+
+GemmPrefilterProblem make_problem(long M, long N, long K, int k_batch = 1)
+{
+    GemmPrefilterProblem problem;
+
+    problem.M_       = M;
+    problem.N_       = N;
+    problem.K_       = K;
+    problem.k_batch_ = k_batch;
+
+    return problem;
+}
+
+DeviceOperationInstanceCatalog<BaseOp> make_catalog()
+{
+    std::vector<DeviceOperationInstanceEntry<BaseOp>> entries(3);
+
+    entries[0].descriptor_ = make_desc(GemmSpecialization::Default, 256, 128);
+    entries[1].descriptor_ = make_desc(GemmSpecialization::Default, 128, 256);
+    entries[2].descriptor_ = make_desc(GemmSpecialization::MNKPadding, 128, 128);
+
+    return DeviceOperationInstanceCatalog<BaseOp>(std::move(entries));
+}
+
+} // namespace
+
+TEST(GemmInstancePrefilter, Rejections)
+{
+    const auto desc   = make_desc();
+    const auto padded = make_desc(GemmSpecialization::MNKPadding);
+
+    EXPECT_EQ(prefilter_gemm_instance(desc, make_problem(4096, 4096, 4096)), GemmRejection::None);
+
+    auto no_xdl           = make_problem(4096, 4096, 4096);
+    no_xdl.xdl_supported_ = false;
+    EXPECT_EQ(prefilter_gemm_instance(desc, no_xdl), GemmRejection::Arch);
+
+    EXPECT_EQ(prefilter_gemm_instance(desc, make_problem(4096, 4096, 4100)),
+              GemmRejection::KVector);
+    EXPECT_EQ(prefilter_gemm_instance(desc, make_problem(4096, 4096, 4096, 3)),
+              GemmRejection::KSplit);
+    EXPECT_EQ(prefilter_gemm_instance(desc, make_problem(4096, 4096, 128)),
+              GemmRejection::PipelineDepth);
+
+    // M and N tiles are checked only for a column major A and a row major B
+    EXPECT_EQ(prefilter_gemm_instance(desc, make_problem(1000, 1000, 4096)), GemmRejection::None);
+
+    auto col_a         = desc;
+    col_a.a_row_major_ = false;
+    EXPECT_EQ(prefilter_gemm_instance(col_a, make_problem(1000, 4096, 4096)),
+              GemmRejection::MPadding);
+
+    auto row_b         = desc;
+    row_b.b_row_major_ = true;
+    EXPECT_EQ(prefilter_gemm_instance(row_b, make_problem(4096, 1000, 4096)),
+              GemmRejection::NPadding);
+
+    // padding lifts the tile checks, not the vector widths
+    EXPECT_EQ(prefilter_gemm_instance(padded, make_problem(4096, 4096, 4100)),
+              GemmRejection::AVectorWidth);
+    EXPECT_EQ(prefilter_gemm_instance(padded, make_problem(4096, 4100, 4096)),
+              GemmRejection::CVectorWidth);
+    EXPECT_EQ(prefilter_gemm_instance(padded, make_problem(4096, 4096, 16, 4)),
+              GemmRejection::KSplit);
+
+    // nothing is known of a default descriptor
+    EXPECT_EQ(prefilter_gemm_instance(DeviceGemmInstanceDescriptor{}, make_problem(7, 11, 13)),
+              GemmRejection::None);
+}
+
+TEST(GemmInstancePrefilter, CandidatesCachedBySignature)
+{
+    const auto catalog = make_catalog();
+    const GemmInstancePrefilter<BaseOp> prefilter(catalog);
+
+    const auto aligned = make_problem(4096, 4096, 4096);
+    EXPECT_EQ(prefilter.GetCandidates(aligned), (std::vector<std::size_t>{0, 1, 2}));
+    EXPECT_EQ(prefilter.GetNumSignature(), 1);
+
+    // the M of another group with the same divisibility
+    EXPECT_EQ(prefilter.GetCandidates(make_problem(4096 + 256 * 5, 4096, 4096)),
+              (std::vector<std::size_t>{0, 1, 2}));
+    EXPECT_EQ(prefilter.GetNumSignature(), 1);
+
+    // no instance writes rows of C of an unaligned N, not even the padded one
+    const auto unaligned = make_problem(4096, 4100, 4096);
+    EXPECT_EQ(prefilter.GetCandidates(unaligned), std::vector<std::size_t>{});
+    EXPECT_EQ(prefilter.GetNumSignature(), 2);
+
+    const auto rejections = prefilter.GetRejections(unaligned);
+    ASSERT_EQ(rejections.size(), 3);
+    EXPECT_EQ(rejections[2], GemmRejection::CVectorWidth);
+}
+
+TEST(GemmInstancePrefilter, LogsRejections)
+{
+    const auto catalog = make_catalog();
+    const GemmInstancePrefilter<BaseOp> prefilter(catalog);
+
+    ck::UpdateEnvVar(CK_ENV(CK_LOGGING), true);
+    testing::internal::CaptureStdout();
+    prefilter.GetCandidates(make_problem(4096, 4096, 4100));
+    const std::string log = testing::internal::GetCapturedStdout();
+    ck::UpdateEnvVar(CK_ENV(CK_LOGGING), false);
+
+    EXPECT_NE(log.find("instance 0 (MockOp)"), std::string::npos);
+    EXPECT_NE(log.find("K is not a multiple of AK1 and BK1"), std::string::npos);
+    EXPECT_NE(log.find("A is not a multiple of its read width"), std::string::npos);
+}
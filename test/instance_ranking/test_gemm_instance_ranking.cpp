@@ -0,0 +1,409 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/library/tensor_operation_instance/gemm_instance_ranking.hpp"
+
+// csv written by ckProfiler gemm_universal --output-file, see the recorded results test below
+CK_DECLARE_ENV_VAR_STR(CK_GEMM_RANKING_RECORDED_RESULTS)
+
+using ck::tensor_operation::device::DeviceGemmInstanceDescriptor;
+using ck::tensor_operation::device::GemmSpecialization;
+using ck::tensor_operation::device::instance::estimate_gemm_instance;
+using ck::tensor_operation::device::instance::get_gemm_peak_tflops;
+using ck::tensor_operation::device::instance::GemmRankingComputeType;
+using ck::tensor_operation::device::instance::GemmRankingDevice;
+using ck::tensor_operation::device::instance::GemmRankingProblem;
+using ck::tensor_operation::device::instance::rank_gemm_instances;
+
+namespace {
+
+DeviceGemmInstanceDescriptor make_desc(int m_per_block,
+                                       int n_per_block,
+                                       int k_per_block,
+                                       GemmSpecialization gemm_spec = GemmSpecialization::Default,
+                                       int lds_bytes                = 32 * 1024)
+{
+    DeviceGemmInstanceDescriptor desc;
+
+    desc.gemm_spec_               = gemm_spec;
+    desc.block_size_              = 256;
+    desc.m_per_block_             = m_per_block;
+    desc.n_per_block_             = n_per_block;
+    desc.k_per_block_             = k_per_block;
+    desc.a_src_scalar_per_vector_ = 8;
+    desc.b_src_scalar_per_vector_ = 8;
+    desc.pipeline_prefetch_       = 1;
+    desc.lds_bytes_               = lds_bytes;
+
+    return desc;
+}
+
+GemmRankingProblem make_problem(long M, long N, long K)
+{
+    GemmRankingProblem problem;
+
+    problem.M_ = M;
+    problem.N_ = N;
+    problem.K_ = K;
+
+    return problem;
+}
+
+constexpr GemmSpecialization kGemmSpecs[] = {GemmSpecialization::Default,
+                                             GemmSpecialization::MPadding,
+                                             GemmSpecialization::NPadding,
+                                             GemmSpecialization::KPadding,
+                                             GemmSpecialization::MNPadding,
+                                             GemmSpecialization::MKPadding,
+                                             GemmSpecialization::NKPadding,
+                                             GemmSpecialization::MNKPadding};
+
+// fields of a csv line, text fields quoted with "" for a quote
+std::vector<std::string> split_csv_line(const std::string& line)
+{
+    std::vector<std::string> fields(1);
+    bool quoted = false;
+
+    for(std::size_t i = 0; i < line.size(); ++i)
+    {
+        const char c = line[i];
+
+        if(c == '"' && quoted && i + 1 < line.size() && line[i + 1] == '"')
+            fields.back() += line[++i];
+        else if(c == '"')
+            quoted = !quoted;
+        else if(c == ',' && !quoted)
+            fields.emplace_back();
+        else
+            fields.back() += c;
+    }
+
+    return fields;
+}
+
+// descriptor of a DeviceGemmXdlUniversal instance from its type string, e.g.
+//   DeviceGemmXdlUniversal<MNKPadding, RRR> BlkSize: 256, BlkTile: 128x128x64, WaveTile: 32x32,
+//   WaveMap: 2x2, VmemReadVec: 8x8, BlkGemmPipelineScheduler: Intrawave, BlkGemmPipelineVersion:
+//   v3, BlkGemmPipelinePrefetchStages: 2
+// The LDS of the instance is not in the type string and is left 0, i.e. not checked.
+std::optional<DeviceGemmInstanceDescriptor>
+parse_gemm_universal_type_string(const std::string& type_string)
+{
+    char spec[32]  = {};
+    char layout[4] = {};
+    char sched[16] = {};
+
+    DeviceGemmInstanceDescriptor desc;
+
+    if(std::sscanf(type_string.c_str(),
+                   "DeviceGemmXdlUniversal<%31[^,], %3[RC]> BlkSize: %d, BlkTile: %dx%dx%d, "
+                   "WaveTile: %dx%d, WaveMap: %dx%d, VmemReadVec: %dx%d, "
+                   "BlkGemmPipelineScheduler: %15[^,], BlkGemmPipelineVersion: v%d, "
+                   "BlkGemmPipelinePrefetchStages: %d",
+                   spec,
+                   layout,
+                   &desc.block_size_,
+                   &desc.m_per_block_,
+                   &desc.n_per_block_,
+                   &desc.k_per_block_,
+                   &desc.m_per_xdl_,
+                   &desc.n_per_xdl_,
+                   &desc.m_xdl_per_wave_,
+                   &desc.n_xdl_per_wave_,
+                   &desc.a_src_scalar_per_vector_,
+                   &desc.b_src_scalar_per_vector_,
+                   sched,
+                   &desc.pipeline_version_,
+                   &desc.pipeline_prefetch_) != 15)
+        return std::nullopt;
+
+    const auto spec_it = std::find_if(
+        std::begin(kGemmSpecs), std::end(kGemmSpecs), [&](GemmSpecialization gemm_spec) {
+            return ck::tensor_operation::device::getGemmSpecializationString(gemm_spec) == spec;
+        });
+    if(spec_it == std::end(kGemmSpecs))
+        return std::nullopt;
+
+    desc.family_             = "DeviceGemmXdlUniversal";
+    desc.gemm_spec_          = *spec_it;
+    desc.a_row_major_        = layout[0] == 'R';
+    desc.b_row_major_        = layout[1] == 'R';
+    desc.c_row_major_        = layout[2] == 'R';
+    desc.pipeline_interwave_ = std::string(sched) == "Interwave";
+    desc.xdl_                = true;
+
+    return desc;
+}
+
+} // namespace
+
+TEST(GemmInstanceRanking, Coverage)
+{
+    const GemmRankingDevice device;
+    const auto problem = make_problem(1000, 1024, 1024);
+
+    EXPECT_FALSE(estimate_gemm_instance(make_desc(128, 128, 64), problem, device).covers_problem_);
+    EXPECT_TRUE(estimate_gemm_instance(make_desc(128, 128, 64, GemmSpecialization::MPadding),
+                                       problem,
+                                       device)
+                    .covers_problem_);
+
+    // more LDS than a CU has
+    const auto too_large = make_desc(128, 128, 64, GemmSpecialization::MNKPadding, 80 * 1024);
+    EXPECT_FALSE(estimate_gemm_instance(too_large, problem, device).covers_problem_);
+
+    const auto ranked = rank_gemm_instances(
+        {make_desc(128, 128, 64), too_large, make_desc(64, 64, 64, GemmSpecialization::MNPadding)},
+        problem,
+        device,
+        10);
+    ASSERT_EQ(ranked.size(), 1);
+    EXPECT_EQ(ranked[0].index_, 2);
+}
+
+TEST(GemmInstanceRanking, PaddingWaste)
+{
+    const GemmRankingDevice device;
+    const auto problem = make_problem(384, 384, 4096);
+
+    const auto large = estimate_gemm_instance(
+        make_desc(256, 256, 64, GemmSpecialization::MNPadding), problem, device);
+    const auto small = estimate_gemm_instance(make_desc(128, 128, 64), problem, device);
+
+    EXPECT_DOUBLE_EQ(large.padding_efficiency_, 384. * 384. / (512. * 512.));
+    EXPECT_DOUBLE_EQ(small.padding_efficiency_, 1.);
+    EXPECT_LT(small.time_ms_, large.time_ms_);
+}
+
+TEST(GemmInstanceRanking, WaveQuantization)
+{
+    const GemmRankingDevice device;
+
+    // one tile more than there are CUs takes a second round
+    const auto e =
+        estimate_gemm_instance(make_desc(128, 128, 64), make_problem(128 * 305, 128, 64), device);
+    EXPECT_DOUBLE_EQ(e.wave_efficiency_, 305. / 608.);
+
+    const auto full =
+        estimate_gemm_instance(make_desc(128, 128, 64), make_problem(128 * 304, 128, 64), device);
+    EXPECT_DOUBLE_EQ(full.wave_efficiency_, 1.);
+}
+
+TEST(GemmInstanceRanking, SkinnyProblemPrefersSmallTiles)
+{
+    const GemmRankingDevice device;
+    const auto problem = make_problem(16, 8192, 8192);
+
+    const auto ranked = rank_gemm_instances(
+        {make_desc(256, 128, 64, GemmSpecialization::MNKPadding), make_desc(16, 64, 256)},
+        problem,
+        device,
+        2);
+
+    ASSERT_EQ(ranked.size(), 2);
+    EXPECT_EQ(ranked[0].index_, 1);
+    EXPECT_GT(ranked[0].arithmetic_intensity_, 0.);
+    EXPECT_LT(ranked[0].arithmetic_intensity_, ranked[1].arithmetic_intensity_);
+}
+
+TEST(GemmInstanceRanking, OccupancyHidesLatency)
+{
+    const GemmRankingDevice device;
+    const auto problem = make_problem(4096, 4096, 256);
+
+    const auto one = estimate_gemm_instance(
+        make_desc(64, 64, 64, GemmSpecialization::Default, 64 * 1024), problem, device);
+    const auto two = estimate_gemm_instance(
+        make_desc(64, 64, 64, GemmSpecialization::Default, 32 * 1024), problem, device);
+
+    EXPECT_EQ(one.occupancy_, 1);
+    EXPECT_EQ(two.occupancy_, 2);
+    EXPECT_LT(two.time_ms_, one.time_ms_);
+}
+
+TEST(GemmInstanceRanking, TopK)
+{
+    const GemmRankingDevice device;
+    const auto problem = make_problem(4096, 4096, 4096);
+
+    // the larger tile reads A and B half as often
+    std::vector<DeviceGemmInstanceDescriptor> descs{make_desc(128, 128, 32)};
+    descs.resize(5, make_desc(256, 256, 64));
+
+    const auto ranked = rank_gemm_instances(descs, problem, device, 3);
+
+    // equal estimates keep their order
+    ASSERT_EQ(ranked.size(), 3);
+    EXPECT_EQ(ranked[0].index_, 1);
+    EXPECT_EQ(ranked[1].index_, 2);
+    EXPECT_EQ(ranked[2].index_, 3);
+    EXPECT_EQ(ranked[0].time_ms_, ranked[2].time_ms_);
+
+    EXPECT_GT(estimate_gemm_instance(descs[0], problem, device).time_ms_, ranked[0].time_ms_);
+}
+
+TEST(GemmInstanceRanking, PeakFromArchTable)
+{
+    GemmRankingDevice device;
+
+    // MI300X: 304 CUs at 2.1 GHz
+    EXPECT_NEAR(get_gemm_peak_tflops(device, GemmRankingComputeType::F16), 1307.4, 0.1);
+    EXPECT_NEAR(get_gemm_peak_tflops(device, GemmRankingComputeType::F8), 2614.9, 0.1);
+    EXPECT_NEAR(get_gemm_peak_tflops(device, GemmRankingComputeType::F32), 163.4, 0.1);
+
+    // one die of an MI250X: 110 CUs at 1.7 GHz
+    device.arch_      = "gfx90a";
+    device.num_cu_    = 110;
+    device.clock_mhz_ = 1700;
+    EXPECT_NEAR(get_gemm_peak_tflops(device, GemmRankingComputeType::F16), 191.5, 0.1);
+    EXPECT_NEAR(get_gemm_peak_tflops(device, GemmRankingComputeType::F64), 47.9, 0.1);
+
+    // the compute type sets the compute bound of the estimate, f32 at a quarter of the f16 rate
+    const auto problem = make_problem(8192, 8192, 8192);
+    auto f32_problem   = problem;
+    f32_problem.compute_type_ = GemmRankingComputeType::F32;
+
+    const auto desc = make_desc(256, 256, 64);
+    EXPECT_NEAR(estimate_gemm_instance(desc, f32_problem, device).time_ms_,
+                4 * estimate_gemm_instance(desc, problem, device).time_ms_,
+                1e-9);
+}
+
+TEST(GemmInstanceRanking, OccupancyFillsSimds)
+{
+    const GemmRankingDevice device;
+    const auto problem = make_problem(64 * 304 * 4, 64, 4096);
+
+    // one wave per workgroup: a single workgroup keeps one of the four SIMDs of a CU busy
+    auto one_wave        = make_desc(64, 64, 64, GemmSpecialization::Default, 64 * 1024);
+    one_wave.block_size_ = 64;
+
+    auto four_per_cu       = one_wave;
+    four_per_cu.lds_bytes_ = 16 * 1024;
+
+    const auto serial     = estimate_gemm_instance(one_wave, problem, device);
+    const auto concurrent = estimate_gemm_instance(four_per_cu, problem, device);
+
+    EXPECT_EQ(serial.occupancy_, 1);
+    EXPECT_EQ(concurrent.occupancy_, 4);
+    EXPECT_DOUBLE_EQ(serial.wave_efficiency_, 0.25);
+    EXPECT_DOUBLE_EQ(concurrent.wave_efficiency_, 1.);
+    EXPECT_LT(concurrent.time_ms_, serial.time_ms_);
+
+    // the last round holds a tile on one CU only
+    const auto tail =
+        estimate_gemm_instance(four_per_cu, make_problem(64 * (304 * 4 + 1), 64, 4096), device);
+    EXPECT_DOUBLE_EQ(tail.wave_efficiency_, (304. * 4 + 1) / 304 / (4 + 4));
+}
+
+TEST(GemmInstanceRanking, ParsesUniversalTypeString)
+{
+    const auto desc = parse_gemm_universal_type_string(
+        "DeviceGemmXdlUniversal<MNKPadding, RCR> BlkSize: 256, BlkTile: 224x256x64, "
+        "WaveTile: 16x16, WaveMap: 7x8, VmemReadVec: 8x8, BlkGemmPipelineScheduler: Intrawave, "
+        "BlkGemmPipelineVersion: v3, BlkGemmPipelinePrefetchStages: 2");
+
+    ASSERT_TRUE(desc);
+    EXPECT_EQ(desc->gemm_spec_, GemmSpecialization::MNKPadding);
+    EXPECT_TRUE(desc->a_row_major_);
+    EXPECT_FALSE(desc->b_row_major_);
+    EXPECT_EQ(desc->m_per_block_, 224);
+    EXPECT_EQ(desc->n_per_block_, 256);
+    EXPECT_EQ(desc->k_per_block_, 64);
+    EXPECT_EQ(desc->m_xdl_per_wave_, 7);
+    EXPECT_EQ(desc->pipeline_version_, 3);
+    EXPECT_EQ(desc->pipeline_prefetch_, 2);
+    EXPECT_FALSE(desc->pipeline_interwave_);
+
+    EXPECT_FALSE(parse_gemm_universal_type_string("DeviceGemmXdl<256, 128, 128>"));
+}
+
+// The ranking against recorded ckProfiler results: a csv written by
+//   ckProfiler gemm_universal <data type> <layout> 1 2 0 1 M N K ... --output-file results.csv
+// for f16 or bf16 problems on the device GemmRankingDevice describes by default, an MI300X,
+// named by $CK_GEMM_RANKING_RECORDED_RESULTS. For every problem profiled with KBatch 1 the
+// fastest verified instance must be in the top kTopK of the ranking, as CK_PROFILER_TOP_K=8
+// relies on.
+TEST(GemmInstanceRanking, RecordedResults)
+{
+    constexpr std::size_t kTopK = 8;
+
+    const std::string file = ck::EnvGetString(CK_ENV(CK_GEMM_RANKING_RECORDED_RESULTS));
+    if(file.empty())
+        GTEST_SKIP() << "CK_GEMM_RANKING_RECORDED_RESULTS is not set";
+
+    std::ifstream is(file);
+    ASSERT_TRUE(is) << "cannot open " << file;
+
+    struct Record
+    {
+        DeviceGemmInstanceDescriptor desc_;
+        double time_ms_;
+    };
+
+    // recorded instances by problem
+    std::map<std::tuple<long, long, long>, std::vector<Record>> problems;
+
+    std::string line;
+    std::getline(is, line); // header
+    while(std::getline(is, line))
+    {
+        // operation, arguments, exit_code, instance, instance_id, supported, time_ms, tflops,
+        // gb_per_sec, verification, problem
+        const auto fields = split_csv_line(line);
+        if(fields.size() != 11 || fields[0] != "gemm_universal" || fields[5] != "1" ||
+           fields[9] == "fail" || fields[6].empty())
+            continue;
+
+        long M = 0, N = 0, K = 0;
+        int k_batch = 0;
+        if(std::sscanf(fields[10].c_str(), "M=%ld N=%ld K=%ld", &M, &N, &K) != 3 ||
+           std::sscanf(fields[10].c_str() + fields[10].find("KBatch="), "KBatch=%d", &k_batch) !=
+               1 ||
+           k_batch != 1)
+            continue;
+
+        const auto desc = parse_gemm_universal_type_string(fields[3]);
+        const double time_ms = std::stod(fields[6]);
+        if(desc && time_ms > 0)
+            problems[{M, N, K}].push_back({*desc, time_ms});
+    }
+
+    ASSERT_FALSE(problems.empty()) << "no gemm_universal records with KBatch 1 in " << file;
+
+    const GemmRankingDevice device;
+
+    for(const auto& [mnk, records] : problems)
+    {
+        const auto [M, N, K] = mnk;
+
+        std::vector<DeviceGemmInstanceDescriptor> descs;
+        for(const auto& record : records)
+            descs.push_back(record.desc_);
+
+        const auto fastest = static_cast<std::size_t>(std::distance(
+            records.begin(),
+            std::min_element(records.begin(), records.end(), [](const auto& x, const auto& y) {
+                return x.time_ms_ < y.time_ms_;
+            })));
+
+        const auto ranked = rank_gemm_instances(descs, make_problem(M, N, K), device, kTopK);
+
+        EXPECT_TRUE(std::any_of(ranked.begin(),
+                                ranked.end(),
+                                [&](const auto& e) { return e.index_ == fastest; }))
+            << "M=" << M << " N=" << N << " K=" << K << ": the fastest recorded instance "
+            << fastest << " is not in the top " << kTopK << " of the ranking";
+    }
+}
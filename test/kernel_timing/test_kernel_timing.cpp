@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/host_utility/kernel_timing.hpp"
+
+using ck::KernelTimingStatistics;
+using ck::run_kernel_timing;
+using ck::summarize_kernel_timing;
+
+namespace {
+
+// mocked timer backend that replays a fixed sequence of iteration times
+struct ReplayTimer
+{
+    explicit ReplayTimer(std::vector<float> times) : times_(std::move(times)) {}
+
+    std::vector<float> operator()(int n)
+    {
+        batches_.push_back(n);
+
+        std::vector<float> result;
+        for(int i = 0; i < n; ++i)
+            result.push_back(times_[next_++ % times_.size()]);
+        return result;
+    }
+
+    std::vector<float> times_;
+    std::size_t next_ = 0;
+    std::vector<int> batches_;
+};
+
+} // namespace
+
+TEST(KernelTiming, Percentiles)
+{
+    std::vector<float> samples;
+    for(int i = 100; i >= 1; --i)
+        samples.push_back(static_cast<float>(i));
+
+    const auto s = summarize_kernel_timing(samples);
+
+    EXPECT_EQ(s.num_sample_, 100);
+    EXPECT_EQ(s.num_outlier_, 0);
+    EXPECT_EQ(s.min_, 1.f);
+    EXPECT_EQ(s.max_, 100.f);
+    EXPECT_EQ(s.median_, 50.5f);
+    EXPECT_EQ(s.p90_, 90.f);
+    EXPECT_EQ(s.p99_, 99.f);
+    EXPECT_FLOAT_EQ(s.mean_, 50.5f);
+    EXPECT_NEAR(s.stddev_, std::sqrt(100.f * 101.f / 12.f), 1e-3);
+}
+
+TEST(KernelTiming, OutliersAreRejectedFromMean)
+{
+    // a slow first iteration, e.g. while the clocks ramp up
+    std::vector<float> samples{50.f, 1.0f, 1.1f, 0.9f, 1.0f, 1.05f, 0.95f, 1.0f, 1.0f};
+
+    const auto s = summarize_kernel_timing(samples);
+
+    EXPECT_EQ(s.num_outlier_, 1);
+    EXPECT_EQ(s.max_, 50.f);
+    EXPECT_EQ(s.p99_, 50.f);
+    EXPECT_FLOAT_EQ(s.mean_, 1.f);
+    EXPECT_LT(s.stddev_, 0.1f);
+}
+
+TEST(KernelTiming, EqualSamples)
+{
+    const auto s = summarize_kernel_timing(std::vector<float>(10, 2.f));
+
+    EXPECT_EQ(s.num_outlier_, 0);
+    EXPECT_EQ(s.mean_, 2.f);
+    EXPECT_EQ(s.stddev_, 0.f);
+    EXPECT_EQ(s.GetRelativeError(), 0.f);
+}
+
+TEST(KernelTiming, StableKernelStopsAfterFirstBatch)
+{
+    ReplayTimer timer({1.0f, 1.001f, 0.999f});
+
+    const auto s = run_kernel_timing(10, 1000, 0.01f, timer);
+
+    EXPECT_TRUE(s.converged_);
+    EXPECT_EQ(s.num_sample_, 10);
+    EXPECT_EQ(timer.batches_, std::vector<int>{10});
+}
+
+TEST(KernelTiming, NoisyKernelDoublesIterations)
+{
+    ReplayTimer timer({1.0f, 1.5f, 0.7f, 1.2f, 0.8f});
+
+    const auto s = run_kernel_timing(10, 1000, 0.05f, timer);
+
+    // the confidence interval shrinks with the square root of the sample count
+    EXPECT_TRUE(s.converged_);
+    EXPECT_LE(s.GetRelativeError(), 0.05f);
+    EXPECT_GT(s.num_sample_, 10);
+    EXPECT_EQ(timer.batches_.front(), 10);
+    for(std::size_t i = 1; i < timer.batches_.size(); ++i)
+        EXPECT_EQ(timer.batches_[i], 10 << (i - 1));
+}
+
+TEST(KernelTiming, StopsAtMaxIterations)
+{
+    ReplayTimer timer({1.0f, 3.0f});
+
+    const auto s = run_kernel_timing(8, 50, 1e-6f, timer);
+
+    EXPECT_FALSE(s.converged_);
+    EXPECT_EQ(s.num_sample_, 50);
+    EXPECT_EQ(timer.batches_, (std::vector<int>{8, 8, 16, 18}));
+}
@@ -0,0 +1,94 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/filesystem.hpp"
+
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/reference_cache.hpp"
+
+using ck::utils::ReferenceCache;
+using ck::utils::ReferenceCacheKey;
+
+namespace {
+
+struct ReferenceCacheTest : public ::testing::Test
+{
+    void SetUp() override
+    {
+        dir_ = ::testing::TempDir() + "test_reference_cache_" + std::to_string(getpid());
+        CK::fs::remove_all(dir_);
+    }
+
+    void TearDown() override { CK::fs::remove_all(dir_); }
+
+    std::string dir_;
+};
+
+Tensor<float> make_tensor(std::size_t rows, std::size_t cols)
+{
+    Tensor<float> t(HostTensorDescriptor(std::vector<std::size_t>{rows, cols},
+                                         std::vector<std::size_t>{cols, 1}));
+    for(std::size_t i = 0; i < t.mData.size(); ++i)
+        t.mData[i] = static_cast<float>(i % 1000) * 0.5f;
+    return t;
+}
+
+ReferenceCacheKey make_key() { return ReferenceCacheKey("test", 1); }
+
+} // namespace
+
+TEST_F(ReferenceCacheTest, DigestDependsOnContents)
+{
+    // larger than one hash chunk
+    auto a = make_tensor(1024, 1031);
+
+    const auto digest = make_key().Add("gemm").Add(a).GetDigest();
+
+    EXPECT_EQ(digest.size(), 32);
+    EXPECT_EQ(digest, make_key().Add(std::string("gemm")).Add(a).GetDigest());
+    EXPECT_NE(digest, make_key().Add("conv").Add(a).GetDigest());
+
+    a.mData.back() += 1.f;
+    EXPECT_NE(digest, make_key().Add("gemm").Add(a).GetDigest());
+
+    // same bytes, different descriptor
+    const Tensor<float> b(HostTensorDescriptor({1031, 1024}, {1024, 1}));
+    const Tensor<float> c(HostTensorDescriptor({1024, 1031}, {1031, 1}));
+    EXPECT_NE(make_key().Add(b).GetDigest(), make_key().Add(c).GetDigest());
+
+    // a new version of the reference misses the results of the old one
+    EXPECT_NE(make_key().Add(c).GetDigest(), ReferenceCacheKey("test", 2).Add(c).GetDigest());
+    EXPECT_NE(ReferenceCacheKey("gemm", 1).Add(c).GetDigest(),
+              ReferenceCacheKey("conv", 1).Add(c).GetDigest());
+
+    // field boundaries are part of the key
+    EXPECT_NE(make_key().Add("ab").Add("c").GetDigest(), make_key().Add("a").Add("bc").GetDigest());
+}
+
+TEST_F(ReferenceCacheTest, StoreAndLoad)
+{
+    const ReferenceCache cache(dir_);
+
+    const auto out    = make_tensor(777, 1500);
+    const auto digest = make_key().Add("test").Add(out).GetDigest();
+
+    auto loaded = make_tensor(777, 1500);
+    loaded.SetZero();
+
+    EXPECT_FALSE(cache.Load(digest, loaded));
+    ASSERT_TRUE(cache.Store(digest, out));
+    ASSERT_TRUE(cache.Load(digest, loaded));
+
+    EXPECT_EQ(loaded.mData, out.mData);
+
+    // a result of a different size is never returned
+    auto smaller = make_tensor(777, 1499);
+    EXPECT_FALSE(cache.Load(digest, smaller));
+}
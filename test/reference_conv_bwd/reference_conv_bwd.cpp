@@ -0,0 +1,356 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+
+#include "ck/library/utility/algorithm.hpp"
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/fill.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/convolution_parameter.hpp"
+#include "ck/library/utility/convolution_host_tensor_descriptor_helper.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_data.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_conv_bwd_weight.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using Scale       = ck::tensor_operation::element_wise::Scale;
+
+using ck::tensor_operation::host::ReferenceConvBwdDataMode;
+using ck::tensor_operation::host::ReferenceConvBwdWeightMode;
+
+template <ck::index_t NDimSpatial, typename InLayout, typename WeiLayout, typename OutLayout>
+struct ConvTensors
+{
+    explicit ConvTensors(const ck::utils::conv::ConvParam& conv_param)
+        : input(ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(
+              conv_param)),
+          weight(ck::utils::conv::make_weight_host_tensor_descriptor_g_k_c_xs_packed<WeiLayout>(
+              conv_param)),
+          output(ck::utils::conv::make_output_host_tensor_descriptor_g_n_k_wos_packed<OutLayout>(
+              conv_param))
+    {
+    }
+
+    Tensor<float> input;
+    Tensor<float> weight;
+    Tensor<float> output;
+};
+
+template <ck::index_t NDimSpatial,
+          typename InLayout,
+          typename WeiLayout,
+          typename OutLayout,
+          typename OutElementOp = PassThrough>
+Tensor<float> run_reference_convolution_backward_data(const ck::utils::conv::ConvParam& conv_param,
+                                                      ReferenceConvBwdDataMode mode,
+                                                      OutElementOp out_element_op = {})
+{
+    ConvTensors<NDimSpatial, InLayout, WeiLayout, OutLayout> tensors(conv_param);
+
+    ck::utils::FillUniformDistribution<float>{-1.f, 1.f}(tensors.output);
+    ck::utils::FillUniformDistribution<float>{-0.5f, 0.5f}(tensors.weight);
+    ck::ranges::fill<float>(tensors.input, 0.f);
+
+    auto ref_conv     = ck::tensor_operation::host::ReferenceConvBwdData<NDimSpatial,
+                                                                     float,
+                                                                     float,
+                                                                     float,
+                                                                     PassThrough,
+                                                                     PassThrough,
+                                                                     OutElementOp>();
+    auto ref_invoker  = ref_conv.MakeInvoker();
+    auto ref_argument = ref_conv.MakeArgument(tensors.input,
+                                              tensors.weight,
+                                              tensors.output,
+                                              conv_param.conv_filter_strides_,
+                                              conv_param.conv_filter_dilations_,
+                                              conv_param.input_left_pads_,
+                                              conv_param.input_right_pads_,
+                                              PassThrough{},
+                                              PassThrough{},
+                                              out_element_op,
+                                              {},
+                                              {},
+                                              {},
+                                              mode);
+
+    ref_invoker.Run(ref_argument);
+    return tensors.input;
+}
+
+// the stride-phase GEMMs accumulate in the same order as the direct loop
+template <ck::index_t NDimSpatial, typename InLayout, typename WeiLayout, typename OutLayout>
+void compare_exact_and_fast_bwd_data(const ck::utils::conv::ConvParam& conv_param)
+{
+    const auto in_exact =
+        run_reference_convolution_backward_data<NDimSpatial, InLayout, WeiLayout, OutLayout>(
+            conv_param, ReferenceConvBwdDataMode::Exact, Scale{0.5f});
+    const auto in_fast =
+        run_reference_convolution_backward_data<NDimSpatial, InLayout, WeiLayout, OutLayout>(
+            conv_param, ReferenceConvBwdDataMode::Fast, Scale{0.5f});
+
+    EXPECT_TRUE(ck::utils::check_err(in_fast, in_exact, "Error: fast mode differs!", 0., 0.));
+}
+
+template <ck::index_t NDimSpatial,
+          typename InLayout,
+          typename WeiLayout,
+          typename OutLayout,
+          typename FillOp>
+Tensor<float> run_reference_convolution_backward_weight(
+    const ck::utils::conv::ConvParam& conv_param, ReferenceConvBwdWeightMode mode, FillOp fill)
+{
+    ConvTensors<NDimSpatial, InLayout, WeiLayout, OutLayout> tensors(conv_param);
+
+    fill(tensors.input);
+    fill(tensors.output);
+    ck::ranges::fill<float>(tensors.weight, 0.f);
+
+    auto ref_conv     = ck::tensor_operation::host::ReferenceConvBwdWeight<NDimSpatial,
+                                                                       float,
+                                                                       float,
+                                                                       float,
+                                                                       PassThrough,
+                                                                       PassThrough,
+                                                                       PassThrough>();
+    auto ref_invoker  = ref_conv.MakeInvoker();
+    auto ref_argument = ref_conv.MakeArgument(tensors.input,
+                                              tensors.weight,
+                                              tensors.output,
+                                              conv_param.conv_filter_strides_,
+                                              conv_param.conv_filter_dilations_,
+                                              conv_param.input_left_pads_,
+                                              conv_param.input_right_pads_,
+                                              PassThrough{},
+                                              PassThrough{},
+                                              PassThrough{},
+                                              {},
+                                              {},
+                                              {},
+                                              mode);
+
+    ref_invoker.Run(ref_argument);
+    return tensors.weight;
+}
+
+// Without a split-K the GEMM accumulates in the same order as the direct loop. With a split,
+// small integers keep every partial sum exact, so the order does not matter either.
+template <ck::index_t NDimSpatial,
+          typename InLayout,
+          typename WeiLayout,
+          typename OutLayout,
+          typename FillOp>
+void compare_exact_and_fast_bwd_weight(const ck::utils::conv::ConvParam& conv_param, FillOp fill)
+{
+    const auto wei_exact =
+        run_reference_convolution_backward_weight<NDimSpatial, InLayout, WeiLayout, OutLayout>(
+            conv_param, ReferenceConvBwdWeightMode::Exact, fill);
+    const auto wei_fast =
+        run_reference_convolution_backward_weight<NDimSpatial, InLayout, WeiLayout, OutLayout>(
+            conv_param, ReferenceConvBwdWeightMode::Fast, fill);
+
+    EXPECT_TRUE(ck::utils::check_err(wei_fast, wei_exact, "Error: fast mode differs!", 0., 0.));
+}
+
+const auto fill_float = ck::utils::FillUniformDistribution<float>{-1.f, 1.f};
+
+} // anonymous namespace
+
+TEST(ReferenceConvolutionBwdData, FastModeConv1D)
+{
+    ck::utils::conv::ConvParam conv_param(1,
+                                          2,
+                                          3,
+                                          5,
+                                          7,
+                                          std::vector<ck::index_t>{3},
+                                          std::vector<ck::index_t>{17},
+                                          std::vector<ck::index_t>{2},
+                                          std::vector<ck::index_t>{2},
+                                          std::vector<ck::index_t>{1},
+                                          std::vector<ck::index_t>{2});
+
+    compare_exact_and_fast_bwd_data<1,
+                                    ck::tensor_layout::convolution::GNWC,
+                                    ck::tensor_layout::convolution::GKXC,
+                                    ck::tensor_layout::convolution::GNWK>(conv_param);
+}
+
+TEST(ReferenceConvolutionBwdData, FastModeConv2D)
+{
+    // stride 3 with dilation 2 leaves phases without taps, which still write zeros
+    ck::utils::conv::ConvParam conv_param(2,
+                                          2,
+                                          2,
+                                          9,
+                                          6,
+                                          std::vector<ck::index_t>{3, 1},
+                                          std::vector<ck::index_t>{11, 9},
+                                          std::vector<ck::index_t>{1, 3},
+                                          std::vector<ck::index_t>{2, 2},
+                                          std::vector<ck::index_t>{1, 0},
+                                          std::vector<ck::index_t>{2, 1});
+
+    compare_exact_and_fast_bwd_data<2,
+                                    ck::tensor_layout::convolution::NHWGC,
+                                    ck::tensor_layout::convolution::GKYXC,
+                                    ck::tensor_layout::convolution::NHWGK>(conv_param);
+}
+
+TEST(ReferenceConvolutionBwdData, FastModeConv3D)
+{
+    ck::utils::conv::ConvParam conv_param(3,
+                                          1,
+                                          2,
+                                          4,
+                                          3,
+                                          std::vector<ck::index_t>{3, 3, 3},
+                                          std::vector<ck::index_t>{7, 8, 6},
+                                          std::vector<ck::index_t>{2, 1, 2},
+                                          std::vector<ck::index_t>{1, 2, 2},
+                                          std::vector<ck::index_t>{1, 1, 1},
+                                          std::vector<ck::index_t>{1, 1, 1});
+
+    compare_exact_and_fast_bwd_data<3,
+                                    ck::tensor_layout::convolution::GNCDHW,
+                                    ck::tensor_layout::convolution::GKCZYX,
+                                    ck::tensor_layout::convolution::GNKDHW>(conv_param);
+}
+
+TEST(ReferenceConvolutionBwdData, FastModeNotSupported)
+{
+    using ReferenceConvBwdData = ck::tensor_operation::host::ReferenceConvBwdData<
+        1,
+        float,
+        float,
+        float,
+        PassThrough,
+        PassThrough,
+        ck::tensor_operation::element_wise::Relu>;
+
+    static_assert(!ReferenceConvBwdData::IsFastModeSupported);
+
+    Tensor<float> input({1, 1, 1, 4}), weight({1, 1, 1, 1}), output({1, 1, 1, 4});
+
+    auto ref_conv     = ReferenceConvBwdData{};
+    auto ref_argument = ref_conv.MakeArgument(input,
+                                              weight,
+                                              output,
+                                              {1},
+                                              {1},
+                                              {0},
+                                              {0},
+                                              PassThrough{},
+                                              PassThrough{},
+                                              ck::tensor_operation::element_wise::Relu{},
+                                              {},
+                                              {},
+                                              {},
+                                              ReferenceConvBwdDataMode::Fast);
+
+    EXPECT_THROW(ref_conv.MakeInvoker().Run(ref_argument), std::runtime_error);
+}
+
+TEST(ReferenceConvolutionBwdWeight, FastModeConv1D)
+{
+    ck::utils::conv::ConvParam conv_param(1,
+                                          2,
+                                          3,
+                                          5,
+                                          7,
+                                          std::vector<ck::index_t>{3},
+                                          std::vector<ck::index_t>{17},
+                                          std::vector<ck::index_t>{2},
+                                          std::vector<ck::index_t>{2},
+                                          std::vector<ck::index_t>{1},
+                                          std::vector<ck::index_t>{2});
+
+    compare_exact_and_fast_bwd_weight<1,
+                                      ck::tensor_layout::convolution::GNWC,
+                                      ck::tensor_layout::convolution::GKXC,
+                                      ck::tensor_layout::convolution::GNWK>(conv_param,
+                                                                            fill_float);
+}
+
+TEST(ReferenceConvolutionBwdWeight, FastModeConv2D)
+{
+    ck::utils::conv::ConvParam conv_param(2,
+                                          2,
+                                          2,
+                                          9,
+                                          6,
+                                          std::vector<ck::index_t>{3, 2},
+                                          std::vector<ck::index_t>{11, 9},
+                                          std::vector<ck::index_t>{1, 2},
+                                          std::vector<ck::index_t>{2, 1},
+                                          std::vector<ck::index_t>{1, 0},
+                                          std::vector<ck::index_t>{2, 1});
+
+    compare_exact_and_fast_bwd_weight<2,
+                                      ck::tensor_layout::convolution::NHWGC,
+                                      ck::tensor_layout::convolution::GKYXC,
+                                      ck::tensor_layout::convolution::NHWGK>(conv_param,
+                                                                             fill_float);
+}
+
+TEST(ReferenceConvolutionBwdWeight, FastModeConv3D)
+{
+    ck::utils::conv::ConvParam conv_param(3,
+                                          1,
+                                          2,
+                                          4,
+                                          3,
+                                          std::vector<ck::index_t>{3, 3, 3},
+                                          std::vector<ck::index_t>{7, 8, 6},
+                                          std::vector<ck::index_t>{2, 1, 1},
+                                          std::vector<ck::index_t>{1, 1, 2},
+                                          std::vector<ck::index_t>{1, 1, 1},
+                                          std::vector<ck::index_t>{1, 1, 1});
+
+    compare_exact_and_fast_bwd_weight<3,
+                                      ck::tensor_layout::convolution::GNCDHW,
+                                      ck::tensor_layout::convolution::GKCZYX,
+                                      ck::tensor_layout::convolution::GNKDHW>(conv_param,
+                                                                              fill_float);
+}
+
+TEST(ReferenceConvolutionBwdWeight, FastModeSplitK)
+{
+    // 4 x 64 x 64 output pixels make a reduction long enough to be split
+    ck::utils::conv::ConvParam conv_param(2,
+                                          1,
+                                          4,
+                                          3,
+                                          2,
+                                          std::vector<ck::index_t>{3, 3},
+                                          std::vector<ck::index_t>{64, 64},
+                                          std::vector<ck::index_t>{1, 1},
+                                          std::vector<ck::index_t>{1, 1},
+                                          std::vector<ck::index_t>{1, 1},
+                                          std::vector<ck::index_t>{1, 1});
+
+    using ReferenceConvBwdWeight = ck::tensor_operation::host::
+        ReferenceConvBwdWeight<2, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    EXPECT_GT(ReferenceConvBwdWeight::GetNumSplitK(1, 3, 2 * 9, 4 * 64 * 64), 1);
+
+    // a long reduction of one full tile is split only as far as the partial sums fit
+    constexpr std::size_t M = 96, N = 256;
+    const std::size_t num_split =
+        ReferenceConvBwdWeight::GetNumSplitK(1, M, N, std::size_t{1} << 30);
+    EXPECT_GT(num_split, 1);
+    EXPECT_LE(num_split * M * N * sizeof(float), ReferenceConvBwdWeight::SplitKMaxWorkspaceBytes);
+
+    compare_exact_and_fast_bwd_weight<2,
+                                      ck::tensor_layout::convolution::GNHWC,
+                                      ck::tensor_layout::convolution::GKYXC,
+                                      ck::tensor_layout::convolution::GNHWK>(
+        conv_param, ck::utils::FillUniformDistributionIntegerValue<float>{-3.f, 3.f});
+}
@@ -3,6 +3,8 @@
 
 #include <cmath>
 #include <cstdlib>
+#include <iterator>
+#include <limits>
 #include <numeric>
 #include <type_traits>
 #include <vector>
@@ -38,7 +40,9 @@ template <ck::index_t NDimSpatial,
 Tensor<OutDataType>
 run_reference_convolution_forward(const ck::utils::conv::ConvParam& conv_param,
                                   const FillInputOp& fill_input_op     = FillInputOp{},
-                                  const FillWeightsOp& fill_weights_op = FillWeightsOp{0.5f})
+                                  const FillWeightsOp& fill_weights_op = FillWeightsOp{0.5f},
+                                  ck::tensor_operation::host::ReferenceConvFwdMode mode =
+                                      ck::tensor_operation::host::ReferenceConvFwdMode::Default)
 {
     const auto in_g_n_c_wis_desc =
         ck::utils::conv::make_input_host_tensor_descriptor_g_n_c_wis_packed<InLayout>(conv_param);
@@ -74,12 +78,45 @@ run_reference_convolution_forward(const ck::utils::conv::ConvParam& conv_param,
                                               conv_param.input_right_pads_,
                                               InElementOp{},
                                               WeiElementOp{},
-                                              OutElementOp{});
+                                              OutElementOp{},
+                                              {},
+                                              {},
+                                              {},
+                                              mode);
 
     ref_invoker.Run(ref_argument);
     return host_output;
 }
 
+// the im2col + GEMM engine accumulates in the same order as the direct loop
+template <ck::index_t NDimSpatial, typename InLayout, typename WeiLayout, typename OutLayout>
+void compare_exact_and_fast_mode(const ck::utils::conv::ConvParam& conv_param)
+{
+    using ck::tensor_operation::host::ReferenceConvFwdMode;
+
+    const auto fill_input   = ck::utils::FillUniformDistribution<float>{-1.f, 1.f};
+    const auto fill_weights = ck::utils::FillUniformDistribution<float>{-0.5f, 0.5f};
+
+    auto out_exact = run_reference_convolution_forward<NDimSpatial,
+                                                       float,
+                                                       float,
+                                                       float,
+                                                       InLayout,
+                                                       WeiLayout,
+                                                       OutLayout>(
+        conv_param, fill_input, fill_weights, ReferenceConvFwdMode::Exact);
+    auto out_fast = run_reference_convolution_forward<NDimSpatial,
+                                                      float,
+                                                      float,
+                                                      float,
+                                                      InLayout,
+                                                      WeiLayout,
+                                                      OutLayout>(
+        conv_param, fill_input, fill_weights, ReferenceConvFwdMode::Fast);
+
+    EXPECT_TRUE(ck::utils::check_err(out_fast, out_exact, "Error: fast mode differs!", 0., 0.));
+}
+
 } // anonymous namespace
 
 // Eeference convolution assume dimensions of tensor descriptors are in GNCDHW/GKCZYX/GNKDHW order,
@@ -390,3 +427,117 @@ TEST(ReferenceConvolutionFWD, Conv3DGNCDHWStridesDilations)
     EXPECT_TRUE(ck::utils::check_err(
         out_tensor, ref_data, "Error [case 2]: incorrect results!", 1e-4f, 1e-6f));
 }
+
+TEST(ReferenceConvolutionFWD, FastModeConv1D)
+{
+    ck::utils::conv::ConvParam conv_param(1,
+                                          2,
+                                          3,
+                                          5,
+                                          7,
+                                          std::vector<ck::index_t>{3},
+                                          std::vector<ck::index_t>{17},
+                                          std::vector<ck::index_t>{2},
+                                          std::vector<ck::index_t>{2},
+                                          std::vector<ck::index_t>{1},
+                                          std::vector<ck::index_t>{2});
+
+    compare_exact_and_fast_mode<1,
+                                ck::tensor_layout::convolution::GNWC,
+                                ck::tensor_layout::convolution::GKXC,
+                                ck::tensor_layout::convolution::GNWK>(conv_param);
+}
+
+TEST(ReferenceConvolutionFWD, FastModeConv2D)
+{
+    ck::utils::conv::ConvParam conv_param(2,
+                                          2,
+                                          2,
+                                          9,
+                                          6,
+                                          std::vector<ck::index_t>{3, 2},
+                                          std::vector<ck::index_t>{11, 9},
+                                          std::vector<ck::index_t>{1, 2},
+                                          std::vector<ck::index_t>{2, 1},
+                                          std::vector<ck::index_t>{1, 0},
+                                          std::vector<ck::index_t>{2, 1});
+
+    compare_exact_and_fast_mode<2,
+                                ck::tensor_layout::convolution::NHWGC,
+                                ck::tensor_layout::convolution::GKYXC,
+                                ck::tensor_layout::convolution::NHWGK>(conv_param);
+}
+
+TEST(ReferenceConvolutionFWD, FastModeConv3D)
+{
+    ck::utils::conv::ConvParam conv_param(3,
+                                          1,
+                                          2,
+                                          4,
+                                          3,
+                                          std::vector<ck::index_t>{3, 3, 3},
+                                          std::vector<ck::index_t>{7, 8, 6},
+                                          std::vector<ck::index_t>{2, 1, 1},
+                                          std::vector<ck::index_t>{1, 1, 2},
+                                          std::vector<ck::index_t>{1, 1, 1},
+                                          std::vector<ck::index_t>{1, 1, 1});
+
+    compare_exact_and_fast_mode<3,
+                                ck::tensor_layout::convolution::GNCDHW,
+                                ck::tensor_layout::convolution::GKCZYX,
+                                ck::tensor_layout::convolution::GNKDHW>(conv_param);
+}
+
+TEST(ReferenceConvolutionFWD, FastModeSkipsPaddedTaps)
+{
+    using ck::tensor_operation::host::ReferenceConvFwdMode;
+
+    // the first tap of every filter is infinite; it only reaches the outputs whose window does
+    // not start in the left padding, the others stay finite as long as padded taps are skipped
+    ck::utils::conv::ConvParam conv_param(1,
+                                          1,
+                                          2,
+                                          3,
+                                          4,
+                                          std::vector<ck::index_t>{3},
+                                          std::vector<ck::index_t>{8},
+                                          std::vector<ck::index_t>{1},
+                                          std::vector<ck::index_t>{1},
+                                          std::vector<ck::index_t>{2},
+                                          std::vector<ck::index_t>{2});
+
+    const auto fill_input = ck::utils::FillUniformDistribution<float>{0.5f, 1.f};
+    const auto fill_weights = [](auto begin, auto end) {
+        constexpr float inf = std::numeric_limits<float>::infinity();
+        for(auto it = begin; it != end; ++it)
+            *it = std::distance(begin, it) % 3 == 0 ? inf : 0.25f;
+    };
+
+    auto out_exact = run_reference_convolution_forward<1,
+                                                       float,
+                                                       float,
+                                                       float,
+                                                       ck::tensor_layout::convolution::GNCW,
+                                                       ck::tensor_layout::convolution::GKCX,
+                                                       ck::tensor_layout::convolution::GNKW>(
+        conv_param, fill_input, fill_weights, ReferenceConvFwdMode::Exact);
+    auto out_fast = run_reference_convolution_forward<1,
+                                                      float,
+                                                      float,
+                                                      float,
+                                                      ck::tensor_layout::convolution::GNCW,
+                                                      ck::tensor_layout::convolution::GKCX,
+                                                      ck::tensor_layout::convolution::GNKW>(
+        conv_param, fill_input, fill_weights, ReferenceConvFwdMode::Fast);
+
+    for(std::size_t i = 0; i < out_exact.mData.size(); ++i)
+    {
+        ASSERT_FALSE(std::isnan(out_fast.mData[i]));
+        EXPECT_EQ(out_fast.mData[i], out_exact.mData[i]);
+    }
+
+    // the first two outputs of every image and channel only see the first tap through padding
+    EXPECT_TRUE(std::isfinite(out_fast(0, 0, 0, 0)));
+    EXPECT_TRUE(std::isfinite(out_fast(0, 0, 0, 1)));
+    EXPECT_TRUE(std::isinf(out_fast(0, 0, 0, 2)));
+}
@@ -0,0 +1,222 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdlib>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_batched_gemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_cgemm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_contraction.hpp"
+
+#include "reference_gemm_util.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using Scale       = ck::tensor_operation::element_wise::Scale;
+
+template <typename DataType, typename AElementOp = PassThrough>
+void run_batched_test(std::size_t G,
+                      std::size_t M,
+                      std::size_t N,
+                      std::size_t K,
+                      bool b_col_major,
+                      AElementOp a_element_op = AElementOp{})
+{
+    auto a_g_m_k = ck::test::make_gemm_operand<DataType>({G}, M, K, false);
+    auto b_g_k_n = ck::test::make_gemm_operand<DataType>({G}, K, N, b_col_major);
+    Tensor<float> c_g_m_n({G, M, N});
+    Tensor<float> c_g_m_n_ref({G, M, N});
+
+    a_g_m_k.GenerateTensorValue(GeneratorTensor_2<DataType>{-5, 5});
+    b_g_k_n.GenerateTensorValue(GeneratorTensor_2<DataType>{-5, 5});
+
+    using ReferenceBatchedGemm = ck::tensor_operation::host::ReferenceBatchedGemm<DataType,
+                                                                                  DataType,
+                                                                                  float,
+                                                                                  float,
+                                                                                  AElementOp,
+                                                                                  PassThrough,
+                                                                                  PassThrough>;
+
+    auto ref_gemm     = ReferenceBatchedGemm{};
+    auto ref_invoker  = ref_gemm.MakeInvoker();
+    auto ref_argument = ref_gemm.MakeArgument(
+        a_g_m_k, b_g_k_n, c_g_m_n, a_element_op, PassThrough{}, PassThrough{});
+    ref_invoker.Run(ref_argument);
+
+    ck::test::naive_batched_gemm(
+        G,
+        M,
+        N,
+        K,
+        [&](std::size_t g, std::size_t m, std::size_t k) {
+            DataType v_a;
+            a_element_op(v_a, a_g_m_k(g, m, k));
+            return ck::type_convert<float>(v_a);
+        },
+        [&](std::size_t g, std::size_t k, std::size_t n) {
+            return ck::type_convert<float>(b_g_k_n(g, k, n));
+        },
+        [&](std::size_t g, std::size_t m, std::size_t n, float v) { c_g_m_n_ref(g, m, n) = v; });
+
+    EXPECT_TRUE(ck::utils::check_err(c_g_m_n, c_g_m_n_ref, "Error: incorrect results!", 0., 0.));
+}
+
+// batched GEMM of heads sharing a B: G0 x G1 heads of A and C, G0 x GB batches of B
+template <typename ReferenceGemm>
+void run_shared_b_test(std::size_t G0, std::size_t G1, std::size_t GB)
+{
+    const std::size_t M = 9, N = 11, K = 17;
+
+    Tensor<float> a({G0, G1, M, K});
+    Tensor<float> b({G0, GB, K, N});
+    Tensor<float> c({G0, G1, M, N});
+    Tensor<float> c_ref({G0, G1, M, N});
+
+    a.GenerateTensorValue(GeneratorTensor_2<float>{-5, 5});
+    b.GenerateTensorValue(GeneratorTensor_2<float>{-5, 5});
+
+    auto ref_gemm = ReferenceGemm{};
+    ref_gemm.MakeInvoker().Run(
+        ref_gemm.MakeArgument(a, b, c, PassThrough{}, PassThrough{}, PassThrough{}));
+
+    ck::test::naive_batched_gemm(
+        G0 * G1,
+        M,
+        N,
+        K,
+        [&](std::size_t g, std::size_t m, std::size_t k) { return a(g / G1, g % G1, m, k); },
+        [&](std::size_t g, std::size_t k, std::size_t n) {
+            return b(g / G1, g % G1 * GB / G1, k, n);
+        },
+        [&](std::size_t g, std::size_t m, std::size_t n, float v) {
+            c_ref(g / G1, g % G1, m, n) = v;
+        });
+
+    EXPECT_TRUE(ck::utils::check_err(c, c_ref, "Error: incorrect results!", 0., 0.));
+}
+
+} // anonymous namespace
+
+TEST(ReferenceBatchedGemm, ManySmallBatches) { run_batched_test<float>(500, 7, 9, 13, false); }
+
+TEST(ReferenceBatchedGemm, FewLargeBatches)
+{
+    run_batched_test<ck::half_t>(3, 100, 270, 150, true);
+}
+
+TEST(ReferenceBatchedGemm, ElementOp) { run_batched_test<float>(4, 20, 30, 40, true, Scale{2.f}); }
+
+TEST(ReferenceBatchedGemm, MultiQuery)
+{
+    using ReferenceGemm = ck::tensor_operation::host::ReferenceBatchedGemm_MQA<float,
+                                                                               float,
+                                                                               float,
+                                                                               float,
+                                                                               PassThrough,
+                                                                               PassThrough,
+                                                                               PassThrough>;
+
+    run_shared_b_test<ReferenceGemm>(3, 4, 1);
+}
+
+TEST(ReferenceBatchedGemm, GroupedQueries)
+{
+    constexpr ck::index_t QueryGroupNumber = 2;
+
+    using ReferenceGemm = ck::tensor_operation::host::ReferenceBatchedGemm_GQA<float,
+                                                                               float,
+                                                                               float,
+                                                                               float,
+                                                                               PassThrough,
+                                                                               PassThrough,
+                                                                               PassThrough,
+                                                                               QueryGroupNumber>;
+
+    run_shared_b_test<ReferenceGemm>(2, 4, QueryGroupNumber);
+}
+
+TEST(ReferenceCGemm, Blocked)
+{
+    const std::size_t M = 33, N = 20, K = 70;
+
+    Tensor<float> a_real({M, K}), a_imag({M, K});
+    Tensor<float> b_real({K, N}), b_imag({K, N});
+    Tensor<float> c_real({M, N}), c_imag({M, N});
+
+    a_real.GenerateTensorValue(GeneratorTensor_2<float>{-5, 5});
+    a_imag.GenerateTensorValue(GeneratorTensor_2<float>{-5, 5});
+    b_real.GenerateTensorValue(GeneratorTensor_2<float>{-5, 5});
+    b_imag.GenerateTensorValue(GeneratorTensor_2<float>{-5, 5});
+
+    using ReferenceCGemm = ck::tensor_operation::host::
+        ReferenceCGemm<float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    auto ref_gemm = ReferenceCGemm{};
+    ref_gemm.MakeInvoker().Run(ref_gemm.MakeArgument(a_real,
+                                                     a_imag,
+                                                     b_real,
+                                                     b_imag,
+                                                     c_real,
+                                                     c_imag,
+                                                     PassThrough{},
+                                                     PassThrough{},
+                                                     PassThrough{}));
+
+    // small integers, so every partial sum is exact
+    for(std::size_t m = 0; m < M; ++m)
+        for(std::size_t n = 0; n < N; ++n)
+        {
+            float v_real = 0, v_imag = 0;
+            for(std::size_t k = 0; k < K; ++k)
+            {
+                v_real += a_real(m, k) * b_real(k, n) - a_imag(m, k) * b_imag(k, n);
+                v_imag += a_real(m, k) * b_imag(k, n) + a_imag(m, k) * b_real(k, n);
+            }
+            EXPECT_EQ(c_real(m, n), v_real);
+            EXPECT_EQ(c_imag(m, n), v_imag);
+        }
+}
+
+TEST(ReferenceContraction, Blocked)
+{
+    const std::size_t M0 = 3, M1 = 5, N0 = 4, N1 = 6, K0 = 7, K1 = 9;
+
+    // B in a permuted layout
+    Tensor<float> a({M0, M1, K0, K1});
+    Tensor<float> b(std::vector<std::size_t>{N0, N1, K0, K1},
+                    std::vector<std::size_t>{K0 * K1 * N1, K0 * K1, 1, K0});
+    Tensor<float> c({M0, M1, N0, N1});
+
+    a.GenerateTensorValue(GeneratorTensor_3<float>{-1, 1});
+    b.GenerateTensorValue(GeneratorTensor_3<float>{-1, 1});
+
+    using ReferenceContraction = ck::tensor_operation::host::
+        ReferenceContraction_M2_N2_K2<2, 2, 2, float, float, float, float, float, Scale, Scale>;
+
+    auto ref_op = ReferenceContraction{};
+    ref_op.MakeInvoker().Run(ref_op.MakeArgument(a, b, c, Scale{0.5f}, Scale{3.f}));
+
+    for(std::size_t m0 = 0; m0 < M0; ++m0)
+        for(std::size_t m1 = 0; m1 < M1; ++m1)
+            for(std::size_t n0 = 0; n0 < N0; ++n0)
+                for(std::size_t n1 = 0; n1 < N1; ++n1)
+                {
+                    float v_acc = 0;
+                    for(std::size_t k0 = 0; k0 < K0; ++k0)
+                        for(std::size_t k1 = 0; k1 < K1; ++k1)
+                        {
+                            const float p = (0.5f * a(m0, m1, k0, k1)) * (3.f * b(n0, n1, k0, k1));
+                            v_acc += p;
+                        }
+                    EXPECT_EQ(c(m0, m1, n0, n1), v_acc);
+                }
+}
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdlib>
+#include <tuple>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/host_tensor_generator.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_gemm.hpp"
+
+#include "reference_gemm_util.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+using Scale       = ck::tensor_operation::element_wise::Scale;
+
+template <typename DataType, typename AElementOp = PassThrough>
+void run_test(std::size_t M,
+              std::size_t N,
+              std::size_t K,
+              bool b_col_major,
+              AElementOp a_element_op = AElementOp{})
+{
+    auto a_m_k = ck::test::make_gemm_operand<DataType>({}, M, K, false);
+    auto b_k_n = ck::test::make_gemm_operand<DataType>({}, K, N, b_col_major);
+    Tensor<float> c_m_n({M, N});
+    Tensor<float> c_m_n_ref({M, N});
+
+    a_m_k.GenerateTensorValue(GeneratorTensor_2<DataType>{-5, 5});
+    b_k_n.GenerateTensorValue(GeneratorTensor_2<DataType>{-5, 5});
+
+    using ReferenceGemm = ck::tensor_operation::host::
+        ReferenceGemm<DataType, DataType, float, float, AElementOp, PassThrough, PassThrough>;
+    static_assert(ReferenceGemm::UseBlockedGemm);
+
+    auto ref_gemm     = ReferenceGemm{};
+    auto ref_invoker  = ref_gemm.MakeInvoker();
+    auto ref_argument = ref_gemm.MakeArgument(
+        a_m_k, b_k_n, c_m_n, a_element_op, PassThrough{}, PassThrough{});
+    ref_invoker.Run(ref_argument);
+
+    ck::test::naive_batched_gemm(
+        1,
+        M,
+        N,
+        K,
+        [&](std::size_t, std::size_t m, std::size_t k) {
+            DataType v_a;
+            a_element_op(v_a, a_m_k(m, k));
+            return ck::type_convert<float>(v_a);
+        },
+        [&](std::size_t, std::size_t k, std::size_t n) {
+            return ck::type_convert<float>(b_k_n(k, n));
+        },
+        [&](std::size_t, std::size_t m, std::size_t n, float v) { c_m_n_ref(m, n) = v; });
+
+    EXPECT_TRUE(ck::utils::check_err(c_m_n, c_m_n_ref, "Error: incorrect results!", 0., 0.));
+}
+
+} // anonymous namespace
+
+TEST(ReferenceGemm, BlockedF32)
+{
+    for(auto [M, N, K] : std::vector<std::tuple<std::size_t, std::size_t, std::size_t>>{
+            {1, 1, 1}, {7, 17, 3}, {97, 255, 300}, {130, 33, 700}})
+    {
+        run_test<float>(M, N, K, false);
+        run_test<float>(M, N, K, true);
+    }
+}
+
+TEST(ReferenceGemm, BlockedF16) { run_test<ck::half_t>(67, 129, 257, true); }
+
+TEST(ReferenceGemm, BlockedBF16) { run_test<ck::bhalf_t>(67, 129, 257, false); }
+
+TEST(ReferenceGemm, BlockedI8) { run_test<int8_t>(67, 129, 257, true); }
+
+TEST(ReferenceGemm, BlockedElementOp) { run_test<float>(40, 50, 60, false, Scale{0.5f}); }
+
+TEST(ReferenceGemm, BlockedEmptyK) { run_test<float>(5, 6, 0, false); }
+
+TEST(ReferenceGemm, Slabs)
+{
+    using ReferenceGemm = ck::tensor_operation::host::
+        ReferenceGemm<float, float, float, float, PassThrough, PassThrough, PassThrough>;
+
+    const std::size_t M = 70, N = 45, K = 130;
+
+    auto a_m_k = ck::test::make_gemm_operand<float>({}, M, K, false);
+    auto b_k_n = ck::test::make_gemm_operand<float>({}, K, N, true);
+    Tensor<float> c_m_n({M, N});
+    Tensor<float> c_m_n_slabs({M, N});
+
+    a_m_k.GenerateTensorValue(GeneratorTensor_2<float>{-5, 5});
+    b_k_n.GenerateTensorValue(GeneratorTensor_2<float>{-5, 5});
+
+    ReferenceGemm::MakeInvoker().Run(ReferenceGemm::MakeArgument(
+        a_m_k, b_k_n, c_m_n, PassThrough{}, PassThrough{}, PassThrough{}));
+
+    auto slab_invoker = ReferenceGemm::MakeSlabInvoker(
+        a_m_k, b_k_n, PassThrough{}, PassThrough{}, PassThrough{});
+
+    // row slabs, then column slabs of the same invoker
+    for(std::size_t dim : {0, 1})
+    {
+        c_m_n_slabs.SetZero();
+
+        const std::size_t length = dim == 0 ? M : N;
+        for(std::size_t begin = 0; begin < length; begin += 16)
+        {
+            const std::size_t end = std::min(begin + 16, length);
+
+            slab_invoker.Run(make_tensor_view(c_m_n_slabs).Slice(dim, begin, end), dim, begin, end);
+        }
+
+        EXPECT_TRUE(
+            ck::utils::check_err(c_m_n_slabs, c_m_n, "Error: incorrect results!", 0., 0.));
+    }
+}
@@ -0,0 +1,75 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ck/ck.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+
+namespace ck {
+namespace test {
+
+// packed GEMM operand of batch_lengths batches of rows x cols, the batches outermost and the
+// matrices row or column major
+template <typename DataType>
+Tensor<DataType> make_gemm_operand(std::vector<std::size_t> batch_lengths,
+                                   std::size_t rows,
+                                   std::size_t cols,
+                                   bool col_major)
+{
+    std::vector<std::size_t> lengths = batch_lengths;
+    lengths.push_back(rows);
+    lengths.push_back(cols);
+
+    std::vector<std::size_t> strides(lengths.size());
+
+    std::size_t stride = rows * cols;
+    for(std::size_t d = batch_lengths.size(); d-- > 0;)
+    {
+        strides[d] = stride;
+        stride *= lengths[d];
+    }
+
+    strides[lengths.size() - 2] = col_major ? 1 : cols;
+    strides[lengths.size() - 1] = col_major ? rows : 1;
+
+    return Tensor<DataType>(lengths, strides);
+}
+
+// C[g, m, n] = sum_k A[g, m, k] * B[g, k, n] as a scalar k loop, in the accumulation order of
+// the blocked CPU GEMM: load_a(g, m, k) and load_b(g, k, n) return the operands as float,
+// store_c(g, m, n, acc) receives the accumulator
+template <typename LoadA, typename LoadB, typename StoreC>
+void naive_batched_gemm(std::size_t G,
+                        std::size_t M,
+                        std::size_t N,
+                        std::size_t K,
+                        LoadA&& load_a,
+                        LoadB&& load_b,
+                        StoreC&& store_c)
+{
+    for(std::size_t g = 0; g < G; ++g)
+    {
+        for(std::size_t m = 0; m < M; ++m)
+        {
+            for(std::size_t n = 0; n < N; ++n)
+            {
+                float v_acc = 0;
+
+                for(std::size_t k = 0; k < K; ++k)
+                {
+                    const float p = load_a(g, m, k) * load_b(g, k, n);
+                    v_acc += p;
+                }
+
+                store_c(g, m, n, v_acc);
+            }
+        }
+    }
+}
+
+} // namespace test
+} // namespace ck
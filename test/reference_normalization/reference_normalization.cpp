@@ -0,0 +1,291 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/element/element_wise_operation.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_groupnorm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_groupnorm_bwd.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_layernorm.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_layernorm_bwd.hpp"
+
+namespace {
+
+using PassThrough = ck::tensor_operation::element_wise::PassThrough;
+
+constexpr float kEpsilon = 1e-4f;
+
+// x viewed as [rows, row_size] with the rows in the leading dims; row r of a groupnorm is (n, g)
+struct Layout
+{
+    std::size_t num_row;
+    std::size_t row_size;
+    // offset of element i of row r in x and of its gamma
+    std::size_t (*x_offset)(const std::vector<std::size_t>&, std::size_t, std::size_t);
+    std::size_t (*gamma_offset)(const std::vector<std::size_t>&, std::size_t, std::size_t);
+};
+
+// two passes in double over packed tensors
+void naive_forward(const std::vector<std::size_t>& lengths,
+                   const Layout& layout,
+                   const Tensor<float>& x,
+                   const Tensor<float>& gamma,
+                   const Tensor<float>& beta,
+                   Tensor<float>& y,
+                   Tensor<float>& mean,
+                   Tensor<float>& inv_std)
+{
+    for(std::size_t r = 0; r < layout.num_row; ++r)
+    {
+        double sum = 0;
+        for(std::size_t i = 0; i < layout.row_size; ++i)
+            sum += x.mData[layout.x_offset(lengths, r, i)];
+        const double m = sum / layout.row_size;
+
+        double sq = 0;
+        for(std::size_t i = 0; i < layout.row_size; ++i)
+        {
+            const double d = x.mData[layout.x_offset(lengths, r, i)] - m;
+            sq += d * d;
+        }
+        const double rstd = 1 / std::sqrt(sq / layout.row_size + kEpsilon);
+
+        for(std::size_t i = 0; i < layout.row_size; ++i)
+        {
+            const std::size_t offset = layout.x_offset(lengths, r, i);
+            const std::size_t g      = layout.gamma_offset(lengths, r, i);
+
+            y.mData[offset] = static_cast<float>((x.mData[offset] - m) * rstd * gamma.mData[g] +
+                                                 beta.mData[g]);
+        }
+
+        mean.mData[r]    = static_cast<float>(m);
+        inv_std.mData[r] = static_cast<float>(rstd);
+    }
+}
+
+void naive_backward(const std::vector<std::size_t>& lengths,
+                    const Layout& layout,
+                    const Tensor<float>& dy,
+                    const Tensor<float>& x,
+                    const Tensor<float>& gamma,
+                    const Tensor<float>& mean,
+                    const Tensor<float>& inv_std,
+                    Tensor<float>& dgamma,
+                    Tensor<float>& dbeta,
+                    Tensor<float>& dx)
+{
+    std::vector<double> dgamma_acc(dgamma.mData.size(), 0);
+    std::vector<double> dbeta_acc(dbeta.mData.size(), 0);
+
+    for(std::size_t r = 0; r < layout.num_row; ++r)
+    {
+        const double m    = mean.mData[r];
+        const double rstd = inv_std.mData[r];
+        const double k    = static_cast<double>(layout.row_size);
+
+        double ds = 0;
+        double db = 0;
+        for(std::size_t i = 0; i < layout.row_size; ++i)
+        {
+            const std::size_t offset = layout.x_offset(lengths, r, i);
+            const std::size_t g      = layout.gamma_offset(lengths, r, i);
+
+            ds += static_cast<double>(dy.mData[offset]) * gamma.mData[g] * x.mData[offset];
+            db += static_cast<double>(dy.mData[offset]) * gamma.mData[g];
+
+            dgamma_acc[g] += dy.mData[offset] * rstd * (x.mData[offset] - m);
+            dbeta_acc[g] += dy.mData[offset];
+        }
+
+        const double b = (db * m - ds) * rstd * rstd * rstd / k;
+        const double c = -b * m - db * rstd / k;
+
+        for(std::size_t i = 0; i < layout.row_size; ++i)
+        {
+            const std::size_t offset = layout.x_offset(lengths, r, i);
+            const std::size_t g      = layout.gamma_offset(lengths, r, i);
+
+            dx.mData[offset] = static_cast<float>(dy.mData[offset] * gamma.mData[g] * rstd +
+                                                  b * x.mData[offset] + c);
+        }
+    }
+
+    for(std::size_t g = 0; g < dgamma.mData.size(); ++g)
+    {
+        dgamma.mData[g] = static_cast<float>(dgamma_acc[g]);
+        dbeta.mData[g]  = static_cast<float>(dbeta_acc[g]);
+    }
+}
+
+void fill(Tensor<float>& t, std::size_t seed, float offset)
+{
+    for(std::size_t i = 0; i < t.mData.size(); ++i)
+        t.mData[i] = static_cast<float>(((i + seed) * 7919) % 1013) * 0.002f + offset;
+}
+
+// x [M, N] or [N, H, W, C], normalized over all but the first dim
+void run_layernorm(const std::vector<std::size_t>& lengths)
+{
+    const std::vector<std::size_t> reduce_lengths(lengths.begin() + 1, lengths.end());
+
+    std::size_t row_size = 1;
+    for(auto l : reduce_lengths)
+        row_size *= l;
+
+    const Layout layout{lengths[0],
+                        row_size,
+                        [](const std::vector<std::size_t>& l, std::size_t r, std::size_t i) {
+                            std::size_t size = 1;
+                            for(std::size_t d = 1; d < l.size(); ++d)
+                                size *= l[d];
+                            return r * size + i;
+                        },
+                        [](const std::vector<std::size_t>&, std::size_t, std::size_t i) {
+                            return i;
+                        }};
+
+    Tensor<float> x(lengths), y(lengths), y_ref(lengths), dy(lengths), dx(lengths), dx_ref(lengths);
+    Tensor<float> gamma(reduce_lengths), beta(reduce_lengths);
+    Tensor<float> dgamma(reduce_lengths), dbeta(reduce_lengths);
+    Tensor<float> dgamma_ref(reduce_lengths), dbeta_ref(reduce_lengths);
+    Tensor<float> mean({lengths[0]}), inv_std({lengths[0]});
+    Tensor<float> mean_ref({lengths[0]}), inv_std_ref({lengths[0]});
+
+    // a large offset, which a one-pass sum of squares would not survive in float
+    fill(x, 0, 100.f);
+    fill(gamma, 1, -1.f);
+    fill(beta, 2, -1.f);
+    fill(dy, 3, -1.f);
+
+    std::vector<ck::index_t> reduce_dims;
+    for(std::size_t d = 1; d < lengths.size(); ++d)
+        reduce_dims.push_back(static_cast<ck::index_t>(d));
+
+    std::vector<ck::index_t> index_lengths(lengths.begin(), lengths.end());
+
+    if(lengths.size() == 2)
+    {
+        using Ref = ck::tensor_operation::host::
+            ReferenceLayernorm<float, float, float, float, float, float, PassThrough, 2, 1>;
+        auto ref = Ref{};
+        auto arg = ref.MakeArgument(
+            x, gamma, beta, y, mean, inv_std, PassThrough{}, index_lengths, reduce_dims, kEpsilon);
+        ref.MakeInvoker().Run(arg);
+    }
+    else
+    {
+        using Ref = ck::tensor_operation::host::
+            ReferenceLayernorm<float, float, float, float, float, float, PassThrough, 4, 3>;
+        auto ref = Ref{};
+        auto arg = ref.MakeArgument(
+            x, gamma, beta, y, mean, inv_std, PassThrough{}, index_lengths, reduce_dims, kEpsilon);
+        ref.MakeInvoker().Run(arg);
+    }
+
+    naive_forward(lengths, layout, x, gamma, beta, y_ref, mean_ref, inv_std_ref);
+
+    EXPECT_TRUE(ck::utils::check_err(y, y_ref, "Error: y", 1e-4, 1e-4));
+    EXPECT_TRUE(ck::utils::check_err(mean, mean_ref, "Error: mean", 1e-5, 1e-5));
+    EXPECT_TRUE(ck::utils::check_err(inv_std, inv_std_ref, "Error: inv_std", 1e-4, 1e-4));
+
+    if(lengths.size() != 2)
+        return;
+
+    // the backward formula cancels in float for a large mean
+    fill(x, 0, -1.f);
+    naive_forward(lengths, layout, x, gamma, beta, y_ref, mean, inv_std);
+
+    using RefBwd = ck::tensor_operation::host::
+        ReferenceLayernormBwd<float, float, float, float, float, float, float, float>;
+    auto ref_bwd = RefBwd{};
+    auto arg_bwd =
+        ref_bwd.MakeArgument(dy, x, gamma, mean, inv_std, dgamma, dbeta, dx, index_lengths);
+    ref_bwd.MakeInvoker().Run(arg_bwd);
+
+    naive_backward(lengths, layout, dy, x, gamma, mean, inv_std, dgamma_ref, dbeta_ref, dx_ref);
+
+    EXPECT_TRUE(ck::utils::check_err(dx, dx_ref, "Error: dx", 1e-4, 1e-4));
+    EXPECT_TRUE(ck::utils::check_err(dgamma, dgamma_ref, "Error: dgamma", 1e-4, 1e-4));
+    EXPECT_TRUE(ck::utils::check_err(dbeta, dbeta_ref, "Error: dbeta", 1e-4, 1e-4));
+}
+
+// x [N, H, W, G, C]
+void run_groupnorm(std::size_t N, std::size_t H, std::size_t W, std::size_t G, std::size_t C)
+{
+    const std::vector<std::size_t> lengths{N, H, W, G, C};
+
+    // row (n, g), element (h, w, c)
+    const Layout layout{N * G,
+                        H * W * C,
+                        [](const std::vector<std::size_t>& l, std::size_t r, std::size_t i) {
+                            const std::size_t n = r / l[3], g = r % l[3];
+                            const std::size_t c = i % l[4], hw = i / l[4];
+                            return ((n * l[1] * l[2] + hw) * l[3] + g) * l[4] + c;
+                        },
+                        [](const std::vector<std::size_t>& l, std::size_t r, std::size_t i) {
+                            return (r % l[3]) * l[4] + i % l[4];
+                        }};
+
+    Tensor<float> x(lengths), y(lengths), y_ref(lengths), dy(lengths), dx(lengths), dx_ref(lengths);
+    Tensor<float> gamma({G, C}), beta({G, C}), dgamma({G, C}), dbeta({G, C});
+    Tensor<float> dgamma_ref({G, C}), dbeta_ref({G, C});
+    Tensor<float> mean({N, G}), inv_std({N, G}), mean_ref({N, G}), inv_std_ref({N, G});
+
+    fill(x, 0, 100.f);
+    fill(gamma, 1, -1.f);
+    fill(beta, 2, -1.f);
+    fill(dy, 3, -1.f);
+
+    const std::vector<ck::index_t> index_lengths(lengths.begin(), lengths.end());
+
+    using Ref = ck::tensor_operation::host::
+        ReferenceGroupnorm<float, float, float, float, float, float, PassThrough>;
+    auto ref = Ref{};
+    auto arg = ref.MakeArgument(
+        x, gamma, beta, y, mean, inv_std, PassThrough{}, index_lengths, kEpsilon);
+    ref.MakeInvoker().Run(arg);
+
+    naive_forward(lengths, layout, x, gamma, beta, y_ref, mean_ref, inv_std_ref);
+
+    EXPECT_TRUE(ck::utils::check_err(y, y_ref, "Error: y", 1e-4, 1e-4));
+    EXPECT_TRUE(ck::utils::check_err(mean, mean_ref, "Error: mean", 1e-5, 1e-5));
+    EXPECT_TRUE(ck::utils::check_err(inv_std, inv_std_ref, "Error: inv_std", 1e-4, 1e-4));
+
+    // the backward formula cancels in float for a large mean
+    fill(x, 0, -1.f);
+    naive_forward(lengths, layout, x, gamma, beta, y_ref, mean, inv_std);
+
+    using RefBwd = ck::tensor_operation::host::
+        ReferenceGroupnormBwd<float, float, float, float, float, float, float, float>;
+    auto ref_bwd = RefBwd{};
+    auto arg_bwd =
+        ref_bwd.MakeArgument(dy, x, gamma, mean, inv_std, dgamma, dbeta, dx, index_lengths);
+    ref_bwd.MakeInvoker().Run(arg_bwd);
+
+    naive_backward(lengths, layout, dy, x, gamma, mean, inv_std, dgamma_ref, dbeta_ref, dx_ref);
+
+    EXPECT_TRUE(ck::utils::check_err(dx, dx_ref, "Error: dx", 1e-4, 1e-4));
+    EXPECT_TRUE(ck::utils::check_err(dgamma, dgamma_ref, "Error: dgamma", 1e-4, 1e-4));
+    EXPECT_TRUE(ck::utils::check_err(dbeta, dbeta_ref, "Error: dbeta", 1e-4, 1e-4));
+}
+
+} // namespace
+
+TEST(ReferenceNormalization, Layernorm2D) { run_layernorm({67, 1031}); }
+
+// fewer rows than threads, each row is split into chunks
+TEST(ReferenceNormalization, Layernorm2DFewLongRows) { run_layernorm({2, 70000}); }
+
+TEST(ReferenceNormalization, Layernorm4D) { run_layernorm({5, 7, 9, 33}); }
+
+TEST(ReferenceNormalization, Groupnorm) { run_groupnorm(3, 5, 7, 4, 6); }
+
+TEST(ReferenceNormalization, GroupnormLargeGroups) { run_groupnorm(1, 64, 64, 2, 8); }
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/reference_tensor_operation/cpu/reference_softmax.hpp"
+
+namespace {
+
+using ReferenceSoftmax = ck::tensor_operation::host::ReferenceSoftmax<float, float, float>;
+
+// three passes over the full tensor in double, as the reference used to compute it
+void naive_softmax(const Tensor<float>& in,
+                   Tensor<float>& out,
+                   double alpha,
+                   double beta,
+                   const std::vector<ck::index_t>& reduce_dims)
+{
+    auto to_scalar_idx = [&](std::vector<std::size_t> idx) {
+        for(ck::index_t dim : reduce_dims)
+            idx[dim] = 0;
+        return idx;
+    };
+
+    std::vector<std::size_t> scalar_lengths = in.mDesc.GetLengths();
+    for(ck::index_t dim : reduce_dims)
+        scalar_lengths[dim] = 1;
+
+    Tensor<double> max(scalar_lengths);
+    Tensor<double> sum(scalar_lengths);
+    std::fill(max.mData.begin(), max.mData.end(), std::numeric_limits<double>::lowest());
+    std::fill(sum.mData.begin(), sum.mData.end(), 0.0);
+
+    in.ForEach([&](auto& self, auto idx) {
+        max(to_scalar_idx(idx)) = std::max<double>(max(to_scalar_idx(idx)), self(idx));
+    });
+    in.ForEach([&](auto& self, auto idx) {
+        sum(to_scalar_idx(idx)) += std::exp(self(idx) - max(to_scalar_idx(idx)));
+    });
+    out.ForEach([&](auto& self, auto idx) {
+        self(idx) = static_cast<float>(alpha * std::exp(in(idx) - max(to_scalar_idx(idx))) /
+                                           sum(to_scalar_idx(idx)) +
+                                       beta * self(idx));
+    });
+}
+
+void run_case(const std::vector<std::size_t>& lengths,
+              const std::vector<ck::index_t>& reduce_dims,
+              double alpha = 1,
+              double beta  = 0)
+{
+    Tensor<float> in(lengths);
+    for(std::size_t i = 0; i < in.mData.size(); ++i)
+        in.mData[i] = static_cast<float>((i * 7919) % 1009) * 0.01f - 5.f;
+
+    Tensor<float> out(lengths);
+    for(std::size_t i = 0; i < out.mData.size(); ++i)
+        out.mData[i] = static_cast<float>(i % 13) * 0.1f;
+
+    Tensor<float> expected = out;
+    naive_softmax(in, expected, alpha, beta, reduce_dims);
+
+    auto ref     = ReferenceSoftmax{};
+    auto invoker = ref.MakeInvoker();
+    auto arg     = ref.MakeArgument(in, out, alpha, beta, reduce_dims);
+    invoker.Run(arg);
+
+    EXPECT_TRUE(ck::utils::check_err(out, expected, "Error: softmax", 1e-5, 1e-6));
+}
+
+} // namespace
+
+TEST(ReferenceSoftmax, LastDim) { run_case({4, 8, 33}, {2}); }
+
+TEST(ReferenceSoftmax, InnerDims) { run_case({3, 5, 7, 11}, {2, 3}); }
+
+TEST(ReferenceSoftmax, NonContiguousDims) { run_case({6, 5, 4, 3}, {3, 1}); }
+
+TEST(ReferenceSoftmax, AlphaBeta) { run_case({16, 40}, {0}, 0.5, 2.0); }
+
+// too few rows to parallelize over, the rows are split into chunks
+TEST(ReferenceSoftmax, AllDims) { run_case({3, 300, 200}, {0, 1, 2}); }
+
+TEST(ReferenceSoftmax, FewLongRows) { run_case({2, 100000}, {1}); }
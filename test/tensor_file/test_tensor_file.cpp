@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <unistd.h>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+
+#include "ck/library/utility/check_err.hpp"
+#include "ck/library/utility/host_tensor.hpp"
+#include "ck/library/utility/tensor_file.hpp"
+
+using ck::utils::TensorFileDataType;
+using ck::utils::TensorFileWriter;
+
+namespace {
+
+struct TensorFileTest : public ::testing::Test
+{
+    void SetUp() override
+    {
+        path_ = ::testing::TempDir() + "test_tensor_file_" + std::to_string(getpid()) + ".bin";
+    }
+
+    void TearDown() override { std::remove(path_.c_str()); }
+
+    std::string path_;
+};
+
+// a padded layout, so that the element space is larger than the element count
+template <typename T>
+Tensor<T> make_tensor(std::size_t rows, std::size_t cols, std::size_t ld)
+{
+    Tensor<T> t(HostTensorDescriptor(std::vector<std::size_t>{rows, cols},
+                                     std::vector<std::size_t>{ld, 1}));
+    for(std::size_t i = 0; i < t.mData.size(); ++i)
+        t.mData[i] = static_cast<T>(static_cast<int>(i % 251) - 125);
+    return t;
+}
+
+} // namespace
+
+TEST_F(TensorFileTest, RoundTrip)
+{
+    // more than one checksum block
+    const auto tensor = make_tensor<float>(1031, 300, 301);
+    ck::utils::save_tensor(path_, tensor);
+
+    const auto mapped = ck::utils::map_tensor<float>(path_);
+    EXPECT_EQ(mapped.GetLengths(), tensor.GetLengths());
+    EXPECT_EQ(mapped.GetStrides(), tensor.GetStrides());
+    EXPECT_EQ(mapped(17, 5), tensor(17, 5));
+    EXPECT_TRUE(std::equal(mapped.begin(), mapped.end(), tensor.mData.begin(), tensor.mData.end()));
+    EXPECT_TRUE(ck::utils::check_err(mapped, tensor));
+
+    const auto loaded = ck::utils::load_tensor<float>(path_);
+    EXPECT_EQ(loaded.mData, tensor.mData);
+}
+
+TEST_F(TensorFileTest, NarrowTypes)
+{
+    const auto tensor = make_tensor<int8_t>(33, 7, 8);
+    ck::utils::save_tensor(path_, tensor);
+
+    const auto loaded = ck::utils::load_tensor<int8_t>(path_);
+    EXPECT_EQ(loaded.mData, tensor.mData);
+}
+
+TEST_F(TensorFileTest, StreamingWrite)
+{
+    const auto tensor = make_tensor<int32_t>(700, 500, 500);
+    const auto* bytes = reinterpret_cast<const char*>(tensor.mData.data());
+    const std::size_t size = tensor.mData.size() * sizeof(int32_t);
+
+    {
+        TensorFileWriter writer(path_, TensorFileDataType::int32, sizeof(int32_t), tensor.mDesc);
+
+        // odd pieces straddle the checksum blocks
+        std::size_t offset = 0;
+        for(std::size_t piece = 1; offset < size; piece = piece * 3 + 7)
+        {
+            const std::size_t n = std::min(piece, size - offset);
+            writer.Write(bytes + offset, n);
+            offset += n;
+        }
+        writer.Close();
+    }
+
+    std::string saved_path = path_ + ".ref";
+    ck::utils::save_tensor(saved_path, tensor);
+
+    // the checksum does not depend on how the data was split
+    const ck::utils::TensorFileMapping streamed(path_);
+    const ck::utils::TensorFileMapping saved(saved_path);
+    EXPECT_EQ(streamed.GetHeader().checksum_, saved.GetHeader().checksum_);
+
+    std::remove(saved_path.c_str());
+}
+
+TEST_F(TensorFileTest, IncompleteWriteThrows)
+{
+    const auto tensor = make_tensor<float>(4, 4, 4);
+
+    TensorFileWriter writer(path_, TensorFileDataType::fp32, sizeof(float), tensor.mDesc);
+    writer.Write(tensor.mData.data(), sizeof(float));
+
+    EXPECT_THROW(writer.Write(tensor.mData.data(), tensor.mData.size() * sizeof(float)),
+                 std::runtime_error);
+    EXPECT_THROW(writer.Close(), std::runtime_error);
+}
+
+TEST_F(TensorFileTest, CorruptionIsDetected)
+{
+    const auto tensor = make_tensor<float>(64, 64, 64);
+    ck::utils::save_tensor(path_, tensor);
+
+    {
+        std::fstream file(path_, std::ios::in | std::ios::out | std::ios::binary);
+        file.seekp(-3, std::ios::end);
+        file.put('\x7f');
+    }
+
+    EXPECT_THROW(ck::utils::map_tensor<float>(path_), std::runtime_error);
+    EXPECT_NO_THROW(ck::utils::map_tensor<float>(path_, false));
+}
+
+TEST_F(TensorFileTest, DataTypeMismatchThrows)
+{
+    ck::utils::save_tensor(path_, make_tensor<float>(8, 8, 8));
+
+    EXPECT_THROW(ck::utils::map_tensor<int32_t>(path_), std::runtime_error);
+    EXPECT_THROW(ck::utils::load_tensor<double>(path_), std::runtime_error);
+}
@@ -0,0 +1,169 @@
+// SPDX-License-Identifier: MIT
+// Copyright (c) 2024, Advanced Micro Devices, Inc. All rights reserved.
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+#include <gtest/gtest.h>
+
+#include "ck/ck.hpp"
+#include "ck/tensor_operation/gpu/device/tensor_layout.hpp"
+
+#include "ck/library/utility/tuning_db.hpp"
+
+using ck::utils::TuningDb;
+using ck::utils::TuningKey;
+using ck::utils::TuningRecord;
+
+namespace {
+
+struct TuningDbTest : public ::testing::Test
+{
+    void SetUp() override
+    {
+        path_ = ::testing::TempDir() + "test_tuning_db_" + std::to_string(getpid()) + ".db";
+        std::remove(path_.c_str());
+    }
+
+    void TearDown() override { std::remove(path_.c_str()); }
+
+    static TuningKey MakeKey(int M)
+    {
+        using Row = ck::tensor_layout::gemm::RowMajor;
+        using Col = ck::tensor_layout::gemm::ColumnMajor;
+
+        return {"gemm",
+                ck::utils::get_tuning_layout_names<Row, Col, Row>(),
+                ck::utils::get_tuning_data_type_names<ck::half_t, ck::half_t, ck::half_t>(),
+                "M=" + std::to_string(M) + " N=256 K=64",
+                "gfx942"};
+    }
+
+    std::string path_;
+};
+
+} // namespace
+
+TEST_F(TuningDbTest, KeyNames)
+{
+    const auto key = MakeKey(128);
+
+    EXPECT_EQ(key.layouts_, "RowMajor,ColumnMajor,RowMajor");
+    EXPECT_EQ(key.data_types_, "fp16,fp16,fp16");
+}
+
+TEST_F(TuningDbTest, LookupMissing)
+{
+    const TuningDb db(path_);
+
+    EXPECT_TRUE(db.Load().empty());
+    EXPECT_FALSE(db.Lookup(MakeKey(128)).has_value());
+}
+
+TEST_F(TuningDbTest, LookupReturnsFastest)
+{
+    const TuningDb db(path_);
+
+    ASSERT_TRUE(db.Add({MakeKey(128), "Gemm-256-128", "DeviceGemm<256, 128>", 0, 2.f, 10.f}));
+    ASSERT_TRUE(db.Add({MakeKey(128), "Gemm-128-64", "DeviceGemm<128, 64>", 4, 1.f, 20.f}));
+    ASSERT_TRUE(db.Add({MakeKey(256), "Gemm-64-32", "DeviceGemm<64, 32>", 0, 0.5f, 40.f}));
+    ASSERT_TRUE(db.Add({MakeKey(128), "Gemm-64-64", "DeviceGemm<64, 64>", 0, 3.f, 5.f}));
+
+    EXPECT_EQ(db.Load().size(), 4);
+
+    const auto best = db.Lookup(MakeKey(128));
+    ASSERT_TRUE(best.has_value());
+    EXPECT_EQ(best->instance_id_, "Gemm-128-64");
+    EXPECT_EQ(best->instance_, "DeviceGemm<128, 64>");
+    EXPECT_EQ(best->split_k_, 4);
+    EXPECT_FLOAT_EQ(best->ave_time_, 1.f);
+
+    auto other_arch  = MakeKey(128);
+    other_arch.arch_ = "gfx90a";
+    EXPECT_FALSE(db.Lookup(other_arch).has_value());
+}
+
+TEST_F(TuningDbTest, InstanceIdSeparatesEqualTypeStrings)
+{
+    const TuningDb db(path_);
+
+    // instances whose type strings leave out the parameters they differ in
+    ASSERT_TRUE(db.Add({MakeKey(128), "DeviceGemm-0123", "DeviceGemm<128, 64>", 0, 2.f, 10.f}));
+    ASSERT_TRUE(db.Add({MakeKey(128), "DeviceGemm-4567", "DeviceGemm<128, 64>", 0, 1.f, 20.f}));
+
+    db.Reload();
+    EXPECT_EQ(db.Lookup(MakeKey(128))->instance_id_, "DeviceGemm-4567");
+}
+
+TEST_F(TuningDbTest, SkipsInterruptedRecord)
+{
+    const TuningDb db(path_);
+
+    ASSERT_TRUE(db.Add({MakeKey(128), "Gemm-256-128", "DeviceGemm<256, 128>", 0, 2.f, 10.f}));
+
+    // a writer killed in the middle of a record
+    {
+        std::ofstream file(path_, std::ios::app);
+        file << "gfx942\tgemm\tRowMajor";
+    }
+
+    ASSERT_TRUE(db.Add({MakeKey(128), "Gemm-128-64", "DeviceGemm<128, 64>", 0, 1.f, 20.f}));
+
+    EXPECT_EQ(db.Load().size(), 2);
+    EXPECT_EQ(db.Lookup(MakeKey(128))->instance_, "DeviceGemm<128, 64>");
+}
+
+TEST_F(TuningDbTest, LookupUsesIndex)
+{
+    const TuningDb db(path_);
+
+    ASSERT_TRUE(db.Add({MakeKey(128), "Gemm-256-128", "DeviceGemm<256, 128>", 0, 2.f, 10.f}));
+    EXPECT_EQ(db.Lookup(MakeKey(128))->instance_, "DeviceGemm<256, 128>");
+
+    // the index follows the records this object adds
+    ASSERT_TRUE(db.Add({MakeKey(128), "Gemm-128-64", "DeviceGemm<128, 64>", 0, 1.f, 20.f}));
+    EXPECT_EQ(db.Lookup(MakeKey(128))->instance_, "DeviceGemm<128, 64>");
+
+    // but the file is not read again until a reload
+    ASSERT_TRUE(
+        TuningDb(path_).Add({MakeKey(128), "Gemm-64-64", "DeviceGemm<64, 64>", 0, 0.5f, 40.f}));
+    EXPECT_EQ(db.Lookup(MakeKey(128))->instance_, "DeviceGemm<128, 64>");
+
+    db.Reload();
+    EXPECT_EQ(db.Lookup(MakeKey(128))->instance_, "DeviceGemm<64, 64>");
+}
+
+TEST_F(TuningDbTest, ConcurrentWriters)
+{
+    constexpr int kNumThread = 8;
+    constexpr int kNumRecord = 200;
+
+    std::vector<std::thread> threads;
+    for(int t = 0; t < kNumThread; ++t)
+    {
+        threads.emplace_back([&, t] {
+            // every thread opens the file on its own, like separate profiler processes
+            const TuningDb db(path_);
+            for(int i = 0; i < kNumRecord; ++i)
+                db.Add({MakeKey(t),
+                        "id_" + std::to_string(i),
+                        "instance_" + std::to_string(i),
+                        0,
+                        1.f + i,
+                        1.f});
+        });
+    }
+
+    for(auto& thread : threads)
+        thread.join();
+
+    const TuningDb db(path_);
+
+    EXPECT_EQ(db.Load().size(), kNumThread * kNumRecord);
+
+    for(int t = 0; t < kNumThread; ++t)
+        EXPECT_EQ(db.Lookup(MakeKey(t))->instance_, "instance_0");
+}
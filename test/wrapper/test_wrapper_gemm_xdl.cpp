@@ -41,8 +41,8 @@ void CheckResult(const std::vector<DataType>& a_data,
     Tensor<DataType> b_k_n(HostTensorDescriptor({K, N}, {1, K}));
     Tensor<DataType> c_m_n_host_result(HostTensorDescriptor({M, N}));
 
-    a_m_k.mData = a_data;
-    b_k_n.mData = b_data;
+    a_m_k.mData.assign(a_data.begin(), a_data.end());
+    b_k_n.mData.assign(b_data.begin(), b_data.end());
 
     auto ref_op       = ReferenceGemmInstance{};
     auto ref_invoker  = ref_op.MakeInvoker();